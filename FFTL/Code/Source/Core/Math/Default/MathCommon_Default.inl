@@ -108,6 +108,18 @@ inline void V4fStore3(f32* pf, Vec4f_In v)
 	pf[1] = v.y;
 	pf[2] = v.z;
 }
+inline Vec4f V4fLoadF16(const f16* ph)
+{
+	const Vec4f r = { F16ToF32(ph[0]), F16ToF32(ph[1]), F16ToF32(ph[2]), F16ToF32(ph[3]) };
+	return r;
+}
+inline void V4fStoreF16(f16* ph, Vec4f_In v)
+{
+	ph[0] = F32ToF16(v.x);
+	ph[1] = F32ToF16(v.y);
+	ph[2] = F32ToF16(v.z);
+	ph[3] = F32ToF16(v.w);
+}
 inline void V4fScatter(f32* pf, Vec4f_In v, int iA, int iB, int iC, int iD)
 {
 	pf[iA] = v.x;
@@ -459,6 +471,16 @@ inline Vec2d V2dSet(f64 x, f64 y)
 	const Vec2d r = { x, y };
 	return r;
 }
+inline Vec2d V2dSplat(f64 f)
+{
+	const Vec2d r = { f, f };
+	return r;
+}
+inline Vec2d V2dSplat(const f64* pf)
+{
+	const Vec2d r = { *pf, *pf };
+	return r;
+}
 inline Vec2d V2dAnd(Vec2d_In a, Vec2d_In b)
 {
 	const u64* pA = reinterpret_cast<const u64*>(&a);
@@ -507,15 +529,44 @@ inline Vec2d V2dDiv(Vec2d_In a, Vec2d_In b)
 	const Vec2d r = { a.x / b.x, a.y / b.y };
 	return r;
 }
+inline Vec2d V2dAddMul(Vec2d_In a, Vec2d_In b, Vec2d_In c)
+{
+	const Vec2d r = { a.x + b.x * c.x, a.y + b.y * c.y };
+	return r;
+}
+inline Vec2d V2dSubMul(Vec2d_In a, Vec2d_In b, Vec2d_In c)
+{
+	const Vec2d r = { a.x - b.x * c.x, a.y - b.y * c.y };
+	return r;
+}
 inline Vec2d V2dSqrt(Vec2d_In v)
 {
 	const Vec2d r = { Sqrt(v.x), Sqrt(v.y) };
 	return r;
 }
+inline Vec2d V2dReverse(Vec2d_In v)
+{
+	const Vec2d r = { v.y, v.x };
+	return r;
+}
+inline Vec2d V2dInterleaveLo(Vec2d_In a, Vec2d_In b)
+{
+	const Vec2d r = { a.x, b.x };
+	return r;
+}
+inline Vec2d V2dInterleaveHi(Vec2d_In a, Vec2d_In b)
+{
+	const Vec2d r = { a.y, b.y };
+	return r;
+}
 inline bool V2dIsEqual(Vec2d_In a, Vec2d_In b)
 {
 	return a.x == b.x && a.y == b.y;
 }
+inline bool V2dIsAllZero(Vec2d_In v)
+{
+	return v.x == 0 && v.y == 0;
+}
 
 
 constexpr mask32x4::mask32x4(u32 x, u32 y, u32 z, u32 w)
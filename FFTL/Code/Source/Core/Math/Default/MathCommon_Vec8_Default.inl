@@ -122,6 +122,18 @@ FFTL_FORCEINLINE void V8fStore6(f32* pf, Vec8f_In v)
 	V4fStoreU(pf+0, v.a);
 	V4fStore2(pf+4, v.b);
 }
+FFTL_FORCEINLINE Vec8f V8fLoadF16(const f16* ph)
+{
+	Vec8f r;
+	r.a = V4fLoadF16(ph+0);
+	r.b = V4fLoadF16(ph+4);
+	return r;
+}
+FFTL_FORCEINLINE void V8fStoreF16(f16* ph, Vec8f_In v)
+{
+	V4fStoreF16(ph+0, v.a);
+	V4fStoreF16(ph+4, v.b);
+}
 FFTL_FORCEINLINE Vec8f V8fSet(f32 x, f32 y, f32 z, f32 w, f32 a, f32 b, f32 c, f32 d)
 {
 	return Vec8f
@@ -358,6 +370,26 @@ FFTL_FORCEINLINE Vec8f V8fReverse(Vec8f_In v)
 		V4fReverse(v.a),
 	};
 }
+template <int T0, int T1, int T2, int T3>
+FFTL_FORCEINLINE Vec8f V8fPermute(Vec8f_In a, Vec8f_In b)
+{
+	return Vec8f
+	{
+		V4fPermute<T0, T1, T2, T3>(a.a, b.a),
+		V4fPermute<T0, T1, T2, T3>(a.b, b.b),
+	};
+}
+template <int T_LO, int T_HI>
+FFTL_FORCEINLINE Vec8f V8fPermute128(Vec8f_In a, Vec8f_In b)
+{
+	static_assert(T_LO >= 0 && T_LO < 4 && T_HI >= 0 && T_HI < 4, "Permute128 indices out of range");
+	const Vec4f halves[4] = { a.a, a.b, b.a, b.b };
+	return Vec8f
+	{
+		halves[T_LO],
+		halves[T_HI],
+	};
+}
 FFTL_FORCEINLINE Vec4f V8fAsV4f(Vec8f_In v)
 {
 	return v.a;
@@ -513,6 +545,139 @@ inline void V8fSinCos(Vec8f_In r, Vec8f& s, Vec8f& c)
 }
 
 
+
+
+
+
+FFTL_FORCEINLINE Vec4d V4dZero()
+{
+	Vec4d r;
+	r.a = V2dZero();
+	r.b = V2dZero();
+	return r;
+}
+FFTL_FORCEINLINE Vec4d V4dLoadA(const f64* pf)
+{
+	Vec4d r;
+	r.a = V2dLoadA(pf+0);
+	r.b = V2dLoadA(pf+2);
+	return r;
+}
+FFTL_FORCEINLINE Vec4d V4dLoadU(const f64* pf)
+{
+	Vec4d r;
+	r.a = V2dLoadU(pf+0);
+	r.b = V2dLoadU(pf+2);
+	return r;
+}
+FFTL_FORCEINLINE void V4dStoreA(f64* pf, Vec4d_In v)
+{
+	V2dStoreA(pf+0, v.a);
+	V2dStoreA(pf+2, v.b);
+}
+FFTL_FORCEINLINE void V4dStoreU(f64* pf, Vec4d_In v)
+{
+	V2dStoreU(pf+0, v.a);
+	V2dStoreU(pf+2, v.b);
+}
+FFTL_FORCEINLINE Vec4d V4dSet(f64 x, f64 y, f64 z, f64 w)
+{
+	Vec4d r;
+	r.a = V2dSet(x, y);
+	r.b = V2dSet(z, w);
+	return r;
+}
+FFTL_FORCEINLINE Vec4d V4dSet(Vec2d_In a, Vec2d_In b)
+{
+	Vec4d r;
+	r.a = a;
+	r.b = b;
+	return r;
+}
+FFTL_FORCEINLINE Vec4d V4dSplat(f64 f)
+{
+	const Vec2d v = V2dSplat(f);
+	return V4dSet(v, v);
+}
+FFTL_FORCEINLINE Vec4d V4dSplat(const f64* pf)
+{
+	const Vec2d v = V2dSplat(pf);
+	return V4dSet(v, v);
+}
+FFTL_FORCEINLINE Vec4d V4dAnd(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dAnd(a.a, b.a), V2dAnd(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dAndNot(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dAndNot(a.a, b.a), V2dAndNot(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dOr(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dOr(a.a, b.a), V2dOr(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dXOr(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dXOr(a.a, b.a), V2dXOr(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dAdd(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dAdd(a.a, b.a), V2dAdd(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dSub(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dSub(a.a, b.a), V2dSub(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dMul(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dMul(a.a, b.a), V2dMul(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dDiv(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dDiv(a.a, b.a), V2dDiv(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec4d V4dAddMul(Vec4d_In a, Vec4d_In b, Vec4d_In c)
+{
+	return V4dSet(V2dAddMul(a.a, b.a, c.a), V2dAddMul(a.b, b.b, c.b));
+}
+FFTL_FORCEINLINE Vec4d V4dSubMul(Vec4d_In a, Vec4d_In b, Vec4d_In c)
+{
+	return V4dSet(V2dSubMul(a.a, b.a, c.a), V2dSubMul(a.b, b.b, c.b));
+}
+FFTL_FORCEINLINE Vec4d V4dSqrt(Vec4d_In v)
+{
+	return V4dSet(V2dSqrt(v.a), V2dSqrt(v.b));
+}
+FFTL_FORCEINLINE Vec4d V4dReverse(Vec4d_In v)
+{
+	return V4dSet(V2dReverse(v.b), V2dReverse(v.a));
+}
+FFTL_FORCEINLINE Vec4d V4dInterleaveLo(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dInterleaveLo(a.a, b.a), V2dInterleaveHi(a.a, b.a));
+}
+FFTL_FORCEINLINE Vec4d V4dInterleaveHi(Vec4d_In a, Vec4d_In b)
+{
+	return V4dSet(V2dInterleaveLo(a.b, b.b), V2dInterleaveHi(a.b, b.b));
+}
+FFTL_FORCEINLINE Vec2d V4dGet01(Vec4d_In v)
+{
+	return v.a;
+}
+FFTL_FORCEINLINE Vec2d V4dGet23(Vec4d_In v)
+{
+	return v.b;
+}
+FFTL_FORCEINLINE bool V4dIsEqual(Vec4d_In a, Vec4d_In b)
+{
+	return V2dIsEqual(a.a, b.a) && V2dIsEqual(a.b, b.b);
+}
+FFTL_FORCEINLINE bool V4dIsAllZero(Vec4d_In v)
+{
+	return V2dIsAllZero(v.a) && V2dIsAllZero(v.b);
+}
+
+
 } // namespace FFTL
 
 #endif //_FFTL_MATH_VEC8_DEFAULT_INL
@@ -37,6 +37,9 @@ OTHER DEALINGS IN THE SOFTWARE.
 #include "MathCommon.h"
 #include "../Containers/Array.h"
 
+#include <atomic>
+#include <mutex>
+
 #define FFTL_STAGE_TIMERS 0
 
 
@@ -75,6 +78,53 @@ constexpr uint FFT_MAX_TWIDDLES_CONSTEXPR = 12;
 constexpr uint FFT_MAX_BITREVERSE_CONSTEXPR = 13;
 #endif
 
+//	When enabled, every FFT_Twiddles<M, T> is a view into one table per T, built on first use from the master twiddles of
+// the largest M. That replaces the 4 separate tables per M, most of which are subsampled copies of the larger ones, and
+// takes the constexpr tables out of the binary. FFTL_SHARED_TWIDDLES_MAX_M must cover the largest FFT_Twiddles<M> in use,
+// which is M - 1 for FFT<M> and FFT_Real<M>. FFT_Plan only instantiates the sizes this covers.
+#ifndef FFTL_SHARED_TWIDDLES
+#	define FFTL_SHARED_TWIDDLES 0
+#endif
+#ifndef FFTL_SHARED_TWIDDLES_MAX_M
+#	define FFTL_SHARED_TWIDDLES_MAX_M 16
+#endif
+
+//	FFT<M, f32, f32> merges pairs of radix 2 stages from stage 3 onwards into single radix 4 passes. This halves the number of
+// passes over memory and saves a complex multiply for every 4 butterflies. Specialize for a given M to select plain radix 2.
+template <uint M>
+struct FFT_UseRadix4Stages : std::bool_constant<(M >= 5)> {};
+
+//	Holds a single T_Table that is built the first time it is asked for, rather than during static initialization. Sizes above the
+// constexpr cutoffs that are compiled in but never transformed then cost nothing at startup. Once built, Get() is one acquire load.
+template <typename T_Table>
+class FFTL_NODISCARD FFT_LazyTable
+{
+public:
+	FFT_LazyTable() = delete;
+
+	FFTL_NODISCARD static FFTL_FORCEINLINE const T_Table& Get()
+	{
+		const T_Table* pTable = sm_pTable.load(std::memory_order_acquire);
+		if (pTable != nullptr) FFTL_LIKELY
+			return *pTable;
+		return Create();
+	}
+
+private:
+	FFTL_NODISCARD static FFTL_NOINLINE const T_Table& Create();
+
+	alignas(T_Table) static inline unsigned char sm_Storage[sizeof(T_Table)];
+	static inline std::atomic<const T_Table*> sm_pTable{ nullptr };
+	static inline std::once_flag sm_OnceFlag;
+};
+
+//	Writes cos(n * fStep) * fCosScale and sin(n * fStep) * fSinScale for n < uCount, without a libm call for every entry. Angles
+// are stepped 4 at a time by a double precision rotation, and reseeded exactly every FFT_COSSIN_RESEED_INTERVAL entries so the
+// rounding error of the recurrence never gets the chance to build up.
+constexpr uint FFT_COSSIN_RESEED_INTERVAL = 32;
+template <typename T>
+void FFT_ComputeCosSin(T* pCos, T* pSin, uint uCount, f64 fStep, f64 fCosScale, f64 fSinScale);
+
 template <FFT_TwiddleType TWIDDLE_TYPE, uint M, typename T>
 class FFTL_NODISCARD FFT_TwiddlesContainer
 {
@@ -96,6 +146,67 @@ private:
 	alignas(ALIGNVAL) FixedArray<T, N> m_Twiddles;
 };
 
+#if FFTL_SHARED_TWIDDLES
+//	Every level m from 0 to MAX_M is stored as cos(pi * n / 2^m), then -sin, then -cos, for n < 2^m. Each level is a copy of
+// every 2^(MAX_M - m)th entry of the top one, so all sizes get identical values. Levels are contiguous and padded to
+// 8 entries so that every array starts aligned for SIMD loads. The real FFT twiddles of level m are the sine and negated
+// cosine arrays of level m + 1, so they need no storage of their own.
+template <typename T>
+class FFTL_NODISCARD FFT_SharedTwiddles
+{
+private:
+	template <uint, typename, bool> friend class FFT_Twiddles;
+
+	static constexpr uint MAX_M = FFTL_SHARED_TWIDDLES_MAX_M;
+
+	static constexpr uint GetLevelSize(uint m) { return m < 3 ? 8 : 1u << m; }
+	static constexpr uint GetLevelOffset(uint m) { uint u = 0; for (uint j = 0; j < m; ++j) u += 3 * GetLevelSize(j); return u; }
+	static constexpr uint TOTAL_SIZE = GetLevelOffset(MAX_M + 1);
+
+	template <uint M, uint ARRAY>
+	static const FixedArray<T, Pow2<M>()>& GetArray()
+	{
+		static_assert(M <= MAX_M, "Raise FFTL_SHARED_TWIDDLES_MAX_M to use transforms this large");
+		return *reinterpret_cast<const FixedArray<T, Pow2<M>()>*>(GetTable() + GetLevelOffset(M) + ARRAY * GetLevelSize(M));
+	}
+
+	struct Table
+	{
+		Table();
+		alignas(64) T m_Data[TOTAL_SIZE];
+	};
+
+	//	Built by whichever thread gets here first, and only if some transform actually uses it.
+	static const T* GetTable()
+	{
+		static const Table s_table;
+		return s_table.m_Data;
+	}
+};
+
+template <uint M, typename T, bool USE_CONSTEXPR = false>
+class FFTL_NODISCARD FFT_Twiddles
+{
+private:
+	template <uint, typename, typename> friend class FFT_Base;
+	template <uint, typename, typename> friend class FFT;
+	template <uint, typename, typename> friend class FFT_Real_Base;
+	template <uint, typename, typename> friend class FFT_Real;
+	template <uint, typename> friend class FFT_Stockham;
+	template <uint, uint, typename> friend class FFT_Pruned;
+
+	using Shared = FFT_SharedTwiddles<T>;
+
+	static constexpr uint N = Pow2<M>();
+
+	static const FixedArray<T, N>& GetCplxR() { return Shared::template GetArray<M, 0>(); }
+	static const FixedArray<T, N>& GetCplxI() { return Shared::template GetArray<M, 1>(); }
+
+	//	-sin(pi * n / 2^(M + 1)) and -cos(pi * n / 2^(M + 1)), the first half of the next level up.
+	static const FixedArray<T, N>& GetRealR() { return *reinterpret_cast<const FixedArray<T, N>*>(&Shared::template GetArray<M + 1, 1>()); }
+	static const FixedArray<T, N>& GetRealI() { return *reinterpret_cast<const FixedArray<T, N>*>(&Shared::template GetArray<M + 1, 2>()); }
+};
+#else
 template <uint M, typename T, bool USE_CONSTEXPR = (M <= FFT_MAX_TWIDDLES_CONSTEXPR)>
 class FFTL_NODISCARD FFT_Twiddles
 {
@@ -104,6 +215,8 @@ private:
 	template <uint, typename, typename> friend class FFT;
 	template <uint, typename, typename> friend class FFT_Real_Base;
 	template <uint, typename, typename> friend class FFT_Real;
+	template <uint, typename> friend class FFT_Stockham;
+	template <uint, uint, typename> friend class FFT_Pruned;
 
 	static constexpr uint N = 1 << (M);
 
@@ -128,27 +241,38 @@ private:
 	template <uint, typename, typename> friend class FFT;
 	template <uint, typename, typename> friend class FFT_Real_Base;
 	template <uint, typename, typename> friend class FFT_Real;
+	template <uint, typename> friend class FFT_Stockham;
+	template <uint, uint, typename> friend class FFT_Pruned;
 
 	static constexpr uint N = Pow2<M>();
 
-	static const FixedArray<T, N>& GetCplxR() { return sm_TwiddlesR.m_Twiddles; }
-	static const FixedArray<T, N>& GetCplxI() { return sm_TwiddlesI.m_Twiddles; }
+	static constexpr uint ALIGNVAL = alignof(T) * 8;
+
+	//	All 4 arrays are built together on first use. See FFT_LazyTable.
+	struct Tables
+	{
+		Tables();
 
-	static const FixedArray<T, N>& GetRealR() { return sm_RealTwiddlesR.m_Twiddles; }
-	static const FixedArray<T, N>& GetRealI() { return sm_RealTwiddlesI.m_Twiddles; }
+		alignas(ALIGNVAL) FixedArray<T, N> m_CplxR;
+		alignas(ALIGNVAL) FixedArray<T, N> m_CplxI;
+		alignas(ALIGNVAL) FixedArray<T, N> m_RealR;
+		alignas(ALIGNVAL) FixedArray<T, N> m_RealI;
+	};
 
-	//	Twiddle factors are always split into 2 arrays for real and imaginary to keep consistent with the highly vectorized 1d transforms.
-	static const inline FFT_TwiddlesContainer<FFT_TwiddleType::COMPLEX_REAL, M, T> sm_TwiddlesR{ };
-	static const inline FFT_TwiddlesContainer<FFT_TwiddleType::COMPLEX_IMAG, M, T> sm_TwiddlesI{ };
-	static const inline FFT_TwiddlesContainer<FFT_TwiddleType::REAL_REAL, M, T> sm_RealTwiddlesR{ };
-	static const inline FFT_TwiddlesContainer<FFT_TwiddleType::REAL_IMAG, M, T> sm_RealTwiddlesI{ };
+	static FFTL_FORCEINLINE const FixedArray<T, N>& GetCplxR() { return FFT_LazyTable<Tables>::Get().m_CplxR; }
+	static FFTL_FORCEINLINE const FixedArray<T, N>& GetCplxI() { return FFT_LazyTable<Tables>::Get().m_CplxI; }
+
+	static FFTL_FORCEINLINE const FixedArray<T, N>& GetRealR() { return FFT_LazyTable<Tables>::Get().m_RealR; }
+	static FFTL_FORCEINLINE const FixedArray<T, N>& GetRealI() { return FFT_LazyTable<Tables>::Get().m_RealI; }
 };
+#endif // FFTL_SHARED_TWIDDLES
 
 template <uint M, typename T_BR>
 class FFTL_NODISCARD FFT_BitreverseContainer
 {
 private:
 	template <uint, bool> friend class FFT_Bitreversal;
+	template <typename> friend class FFT_LazyTable;
 
 	static constexpr uint N = 1 << M;
 
@@ -165,6 +289,7 @@ private:
 	template <uint, typename, typename> friend class FFT;
 	template <uint, typename, typename> friend class FFT_Real_Base;
 	template <uint, typename, typename> friend class FFT_Real;
+	template <uint, typename> friend class FFT_Fixed;
 
 	static constexpr uint N = 1 << M;
 	using T_BR = typename std::conditional<M <= 8, u8, typename std::conditional<M <= 16, u16, u32>::type>::type; // Ensures T_BR is the smallest possible unsigned integer type
@@ -184,15 +309,42 @@ private:
 	template <uint, typename, typename> friend class FFT;
 	template <uint, typename, typename> friend class FFT_Real_Base;
 	template <uint, typename, typename> friend class FFT_Real;
+	template <uint, typename> friend class FFT_Fixed;
 
 	static constexpr uint N = 1 << M;
 	using T_BR = typename std::conditional<M <= 8, u8, typename std::conditional<M <= 16, u16, u32>::type>::type; // Ensures T_BR is the smallest possible unsigned integer type
 
 	constexpr FFT_Bitreversal() = delete;
 
-	static FFTL_FORCEINLINE const FixedArray<T_BR, N>& Get() { return m_.m_; }
+	static FFTL_FORCEINLINE const FixedArray<T_BR, N>& Get() { return FFT_LazyTable<FFT_BitreverseContainer<M, T_BR>>::Get().m_; }
+};
+
+//	Selects FFT_BitreversalBlocked for the out of place split transforms of the SIMD FFT specializations. Above this size, the scattered
+// gathers of the stage 0 bit reversal miss the cache on most loads, and the index table itself no longer fits in L1.
+template <uint M>
+struct FFT_UseBlockedBitreversal : std::bool_constant<(M > 14)> {};
+
+//	Cache blocked bit reversal permutation in the style of COBRA (Carter and Gatlin). Indices are split into Q high bits, M - 2Q middle
+// bits and Q low bits. For each value of the middle bits, a 2^Q x 2^Q tile is read in unit stride runs into a small buffer, then written
+// back out transposed, again in unit stride runs. Only the Q bit reversals are tabled, so no N sized table is needed.
+template <uint M>
+class FFTL_NODISCARD FFT_BitreversalBlocked
+{
+public:
+	static constexpr uint N = 1 << M;
+	static constexpr uint Q = M >= 10 ? 5 : M / 2;
 
-	static const inline FFT_BitreverseContainer<M, T_BR> m_{ };
+	FFT_BitreversalBlocked() = delete;
+
+	template <typename T> static void Permute(const T* pIn, T* pOut);
+
+	FFTL_NODISCARD static constexpr uint ReverseBits(uint n, uint uBits)
+	{
+		uint uReverse = 0;
+		for (uint b = 0; b < uBits; ++b, n >>= 1)
+			uReverse = (uReverse << 1) | (n & 1);
+		return uReverse;
+	}
 };
 
 
@@ -204,10 +356,33 @@ enum enFftWindowType
 	kWindowHamming,
 	kWindowBlackman,
 	kWindowVorbis,
+	kWindowKaiser,			// Param is beta, default 8.6
+	kWindowBlackmanHarris,	// 4 term, -92dB sidelobes
+	kWindowNuttall,			// 4 term with continuous first derivative
+	kWindowFlatTop,			// 5 term, for amplitude accuracy between bins
+	kWindowGaussian,		// Param is sigma relative to the half width, default 0.4
+	kWindowTukey,			// Param is the fraction of the width that is cosine tapered, default 0.5
+	kWindowDPSS,			// Param is the time half bandwidth product NW, default 4
 
 	kFftNumWindowTypes
 };
 
+//	Pass this as the window parameter to get the default listed with each window type above.
+constexpr f64 kFftWindowDefaultParam = -1;
+
+//	Resolves kFftWindowDefaultParam, and returns 0 for windows that have no parameter so they compare equal regardless.
+FFTL_NODISCARD constexpr f64 FFT_GetWindowParam(enFftWindowType windowType, f64 fParam)
+{
+	switch (windowType)
+	{
+	case kWindowKaiser:		return fParam < 0 ? 8.6 : fParam;
+	case kWindowGaussian:	return fParam < 0 ? 0.4 : fParam;
+	case kWindowTukey:		return fParam < 0 ? 0.5 : fParam;
+	case kWindowDPSS:		return fParam < 0 ? 4.0 : fParam;
+	default:				return 0;
+	}
+}
+
 
 template <uint M, typename T, typename T_Twiddle = T>
 class FFTL_NODISCARD FFT_Base
@@ -225,10 +400,17 @@ public:
 	class WindowCoefficients
 	{
 	public:
-		WindowCoefficients(enFftWindowType windowType, uint uWindowWidth = N) { Compute(windowType, uWindowWidth); }
-		void Compute(enFftWindowType windowType, uint uWidth = N);
+		WindowCoefficients(enFftWindowType windowType, uint uWindowWidth = N, f64 fParam = kFftWindowDefaultParam) { Compute(windowType, uWindowWidth, fParam); }
+		void Compute(enFftWindowType windowType, uint uWidth = N, f64 fParam = kFftWindowDefaultParam);
 
 		FixedArray<T_Twiddle, N> m_C;
+
+	private:
+		//	Writes sum(a[k] * cos(k * n * fStep)) for n in [0, uCount), using SIMD trig when T_Twiddle is f32.
+		void ComputeCosineSum(uint uCount, f64 fStep, const f64* pA, uint uTermCount);
+		void ComputeVorbis(uint uWidth);
+		void ComputeDPSS(uint uWidth, f64 fNW);
+		void MirrorFirstHalf(uint uWidth);
 	};
 
 	FFT_Base() = delete;
@@ -324,34 +506,190 @@ public:
 	static void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
 	static void TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
 	static void TransformForward_1stHalf(const FixedArray<cxT, N_2>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // 2nd half of cxInput is assumed to be all zero
-	static void TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<cxT, N>& cxOutput) { FFT_Base<M, T, T_Twiddle>::TransformForward(cxInput, cxOutput); }// TODO, optimize
+	static void TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<cxT, N>& cxOutput); // cxOutput must be aligned like the split arrays, and must not overlap cxInput
+	static void TransformForward(const FixedArray<cxT, N>& cxInput, const FixedArray<T, N * 2>& fWindow, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // Real and imag parts of cxInput are scaled by the interleaved pairs of fWindow in stage 0
 	static void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
 
 	//	Forward transform outputs in bit reversed order. Inverse transform assumes input in bit-reversed order, outputs in normal order.
 	static void TransformForward_InPlace_DIF(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI);
 	static void TransformInverse_InPlace_DIT(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI);
-	static void TransformForward_InPlace_DIF(FixedArray<cxT, N>& cxInOut) { FFT_Base<M, f32, f32>::TransformForward_InPlace_DIF(cxInOut); }// TODO, optimize
-	static void TransformForward_InPlace_DIT(FixedArray<cxT, N>& cxInOut) { FFT_Base<M, f32, f32>::TransformForward_InPlace_DIT(cxInOut); }// TODO, optimize
+	static void TransformForward_InPlace_DIF(FixedArray<cxT, N>& cxInOut); // cxInOut must be aligned like the split arrays
+	static void TransformInverse_InPlace_DIT(FixedArray<cxT, N>& cxInOut); // cxInOut must be aligned like the split arrays
 
 	static void ApplyBitReverseAndInterleave(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N * 2>& fOut);
 
 protected:
+	//	Where element n lives while the stages run. SplitData is the usual pair of real and imaginary arrays. Interleaved complex
+	// data is transformed in place as BlockedData, where each block of BLOCK complex numbers holds its reals followed by its
+	// imaginaries, so that every vector the stages load is still contiguous. The first pass splits each block as it reads it
+	// and the last pass interleaves it again as it writes, so nothing else touches the data and no temporaries are needed.
+#if FFTL_SIMD_F32x8
+	static constexpr uint BLOCK = 8;
+#else
+	static constexpr uint BLOCK = 4;
+#endif
+
+	struct SplitData
+	{
+		T* pfR;
+		T* pfI;
+		FFTL_FORCEINLINE T* R(uint n) const { return pfR + n; }
+		FFTL_FORCEINLINE T* I(uint n) const { return pfI + n; }
+		static constexpr uint Offset(uint n) { return n; } // Distance in memory between vectors n elements apart
+	};
+
+	struct BlockedData
+	{
+		T* pf;
+		FFTL_FORCEINLINE T* R(uint n) const { return pf + n + (n & ~(BLOCK - 1)); }
+		FFTL_FORCEINLINE T* I(uint n) const { return R(n) + BLOCK; }
+		static constexpr uint Offset(uint n) { return 2 * n; } // n must be a multiple of BLOCK
+	};
+
 	static void Transform_Stage0_BR(const FixedArray<T, N>& fInReal, const FixedArray<T, N>& fInImag, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
-	static void Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) { Transform_Stage0_BR(cxInput, SplitData{ fOutR.data(), fOutI.data() }); }
+	template <typename T_Data> static void Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, const T_Data& data);
+	static void Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, const FixedArray<T, N * 2>& fWindow, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
 	static void Transform_Stage0_BR_1stHalf(const FixedArray<cxT, N_2>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // 2nd half of cxInput is assumed to be all zero
 
+	//	Stages 0 through 2 are always radix 2. If M is even, stage 3 is also radix 2 so the remaining stages pair up evenly.
+	static constexpr bool USE_RADIX4 = FFT_UseRadix4Stages<M>::value;
+	static constexpr uint RADIX4_STAGE_BEGIN = 3 + ((M - 3) & 1);
+
+	template <uint STAGE_BEGIN> static void Transform_Stages_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) { Transform_Stages_DIT<STAGE_BEGIN, M>(SplitData{ fOutR.data(), fOutI.data() }); }
+	template <uint STAGE_BEGIN, uint STAGE_END, typename T_Data> static void Transform_Stages_DIT(const T_Data& data); // Performs STAGE_BEGIN up to but not including STAGE_END
+	static void Transform_Stages_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) { Transform_Stages_DIF<M - 1, 0>(SplitData{ fOutR.data(), fOutI.data() }); }
+	template <uint STAGE_FIRST, uint STAGE_LAST, typename T_Data> static void Transform_Stages_DIF(const T_Data& data); // Performs STAGE_FIRST down to and including STAGE_LAST
+
+	template <uint STAGE_CURRENT, typename T_Data> static void Transform_Main_DIT(const T_Data& data);
+	template <uint STAGE_CURRENT, typename T_Data> static void Transform_Main_DIF(const T_Data& data);
+	template <uint STAGE_CURRENT, typename T_Data> static void Transform_Main_DIT_Radix4(const T_Data& data); // Performs STAGE_CURRENT and STAGE_CURRENT + 1
+	template <uint STAGE_CURRENT, typename T_Data> static void Transform_Main_DIF_Radix4(const T_Data& data); // Performs STAGE_CURRENT + 1 and STAGE_CURRENT
+
+	//	The interleaved transforms fuse the block split into stage 0 or the outermost pass, and the merge into the other end.
+	// The outermost pass is the radix 2 stage M - 1, or the radix 4 pass over stages M - 2 and M - 1.
+	static constexpr uint INTERLEAVED_MIN_M = 4;
+	static constexpr uint OUTER_STAGE_BEGIN = USE_RADIX4 ? M - 2 : M - 1;
+
+	template <bool SWAP> static void Transform_Stage0_DIT_Split(T* pf);
+	template <bool SWAP> static void Transform_Outer_DIT_Merge(T* pf);
+	static void Transform_Outer_DIF_Split(T* pf);
+	static void Transform_Stage0_DIF_Merge(T* pf);
+
+	static void LoadInterleaved(const T* pf, f32x4& vR, f32x4& vI);
+	static void StoreInterleaved(T* pf, f32x4_In vR, f32x4_In vI);
+
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIT_Stage0(T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIF_Stage0(T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIT_Stage0(f32x4_In vCurR, f32x4_In vNextR, f32x4_In vCurI, f32x4_In vNextI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIT_Stage0_InOrder(f32x4_In v0R, f32x4_In v1R, f32x4_In v0I, f32x4_In v1I, T* pfReal, T* pfImag);
+	static void Calculate4Butterflies_DIF_Stage0(f32x4& v0R, f32x4& v1R, f32x4& v0I, f32x4& v1I);
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIT_Stage1(f32x4_In vUR, f32x4_In vUI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate4Butterflies_DIF_Stage1(f32x4_In vUR, f32x4_In vUI, T* pfReal, T* pfImag);
+
+#if FFTL_SIMD_F32x8
+	//	Stages 0, 1 and 2 process 2 blocks of 8 at once, with the 1st block in the lower 4 lanes and the 2nd block in the upper 4 lanes.
+	// Between stages, the data is left in that interleaved layout, and stage 2 restores the normal order.
+	static constexpr bool USE_8WIDE_STAGE012 = N >= 16;
+
+	static void LoadInterleaved(const T* pf, f32x8& vR, f32x8& vI);
+	static void StoreInterleaved(T* pf, f32x8_In vR, f32x8_In vI);
+
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIT_Stage0(T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIF_Stage0(T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIT_Stage0(f32x8_In vCurR, f32x8_In vNextR, f32x8_In vCurI, f32x8_In vNextI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIT_Stage0_InOrder(f32x8_In v0R, f32x8_In v1R, f32x8_In v0I, f32x8_In v1I, T* pfReal, T* pfImag);
+	static void Calculate8Butterflies_DIF_Stage0(f32x8& v0R, f32x8& v1R, f32x8& v0I, f32x8& v1I);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIT_Stage1(f32x8_In vUR, f32x8_In vUI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIF_Stage1(f32x8_In vUR, f32x8_In vUI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIT_Stage2(f32x8_In vUR, f32x8_In vUI, T* pfReal, T* pfImag);
+	template <typename T_Data = SplitData> static void Calculate8Butterflies_DIF_Stage2(f32x8_In vUR, f32x8_In vUI, T* pfReal, T* pfImag);
+#endif
+
+	template <typename V> static void CalculateVButterflies_DIT(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
+	template <typename V> static void CalculateVButterflies_DIF(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
+	template <typename V> static void CalculateVButterflies_DIT(const V& vUR, const V& vUI, V& vCurR, V& vCurI, V& vNextR, V& vNextI);
+	template <typename V> static void CalculateVButterflies_DIF(const V& vUR, const V& vUI, V& vCurR, V& vCurI, V& vNextR, V& vNextI);
+	template <uint STRIDE, typename T_Data, typename V> static void CalculateVButterflies_DIT_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, T* pfReal, T* pfImag);
+	template <uint STRIDE, typename T_Data, typename V> static void CalculateVButterflies_DIF_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, T* pfReal, T* pfImag);
+	template <typename V> static void CalculateVButterflies_DIT_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, V (&vR)[4], V (&vI)[4]);
+	template <typename V> static void CalculateVButterflies_DIF_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, V (&vR)[4], V (&vI)[4]);
+
+};
+#endif
+
+#if FFTL_SIMD_F64x2
+//	Double precision version of the SIMD FFT for when f32 accumulation error is too large, usually for M >= 18.
+// Stages 0 and 1 are done together as scalar radix 4 butterflies, and are fused with the bit reversal when out of place.
+// All further stages are vectorized with f64x4 if AVX is available, otherwise f64x2, merging pairs into radix 4 passes.
+template <uint M>
+class FFT<M, f64, f64> : public FFT_Base<M, f64, f64>
+{
+public:
+	using T = f64;
+	using T_Twiddle = T;
+	using cxT = cxNumber<T>;
+	using FFT_Base<M, T, T_Twiddle>::N;
+	using FFT_Base<M, T, T_Twiddle>::N_2;
+	using T_BR = typename FFT_Base<M, T, T_Twiddle>::T_BR;
+	using FFT_Base<M, T, T_Twiddle>::GetBitReverseIndex;
+
+#if FFTL_STAGE_TIMERS
+	using FFT_Base<M, T, T_Twiddle>::m_StageTimers;
+	using FFT_Base<M, T, T_Twiddle>::m_PreProcessTimer;
+	using FFT_Base<M, T, T_Twiddle>::m_PostProcessTimer;
+#endif
+
+	//	The interleaved complex to complex transforms stay with the scalar base class.
+	using FFT_Base<M, T, T_Twiddle>::TransformForward;
+	using FFT_Base<M, T, T_Twiddle>::TransformInverse;
+	using FFT_Base<M, T, T_Twiddle>::TransformForward_InPlace_DIF;
+	using FFT_Base<M, T, T_Twiddle>::TransformInverse_InPlace_DIT;
+
+	FFT() = delete;
+
+	//	Transforms that perform bit reversal, out of place.
+	static void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void TransformForward_1stHalf(const FixedArray<cxT, N_2>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // 2nd half of cxInput is assumed to be all zero
+	static void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) { TransformForward(fInI, fInR, fOutI, fOutR); }
+
+	//	Forward transform outputs in bit reversed order. Inverse transform assumes input in bit-reversed order, outputs in normal order.
+	static void TransformForward_InPlace_DIF(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI);
+	static void TransformInverse_InPlace_DIT(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI);
+
+protected:
+#if FFTL_SIMD_F64x4
+	using V = f64x4;
+#else
+	using V = f64x2;
+#endif
+
+	//	Stages 2 and up are vectorized. If M is odd, stage 2 is radix 2 so the remaining stages pair up evenly.
+	static constexpr uint RADIX4_STAGE_BEGIN = 2 + ((M - 2) & 1);
+
+	template <bool HALF_INPUT, typename T_LOAD> static void Transform_Stage01_BR(const T_LOAD& load, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // Upper half of the input is zero if HALF_INPUT
+	static void Transform_Stages_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void Transform_Stages_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+
 	template <uint STAGE_CURRENT> static void Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
 	template <uint STAGE_CURRENT> static void Transform_Main_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	template <uint STAGE_CURRENT> static void Transform_Main_DIT_Radix4(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // Performs STAGE_CURRENT and STAGE_CURRENT + 1
+	template <uint STAGE_CURRENT> static void Transform_Main_DIF_Radix4(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI); // Performs STAGE_CURRENT + 1 and STAGE_CURRENT
 
-	static void Calculate4Butterflies_DIT_Stage0(T* pfReal, T* pfImag);
-	static void Calculate4Butterflies_DIF_Stage0(T* pfReal, T* pfImag);
-	static void Calculate4Butterflies_DIT_Stage0(f32x4_In vCurR, f32x4_In vNextR, f32x4_In vCurI, f32x4_In vNextI, T* pfReal, T* pfImag);
-	static void Calculate4Butterflies_DIT_Stage1(f32x4_In vUR, f32x4_In vUI, T* pfReal, T* pfImag);
-	static void Calculate4Butterflies_DIF_Stage1(f32x4_In vUR, f32x4_In vUI, T* pfReal, T* pfImag);
+	static void CalculateButterflies_DIT_Stage01(T fAR, T fAI, T fBR, T fBI, T fCR, T fCI, T fDR, T fDI, T* pfReal, T* pfImag);
+	static void CalculateButterflies_DIF_Stage01(T* pfReal, T* pfImag);
 
-	template <typename V> static void CalculateVButterflies_DIT(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
-	template <typename V> static void CalculateVButterflies_DIF(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
+	static void CalculateVButterflies_DIT(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
+	static void CalculateVButterflies_DIF(const V& vUR, const V& vUI, T* pfCurReal, T* pfCurImag, T* pfNextReal, T* pfNextImag);
+	template <uint STRIDE> static void CalculateVButterflies_DIT_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, T* pfReal, T* pfImag);
+	template <uint STRIDE> static void CalculateVButterflies_DIF_Radix4(const V& vU1R, const V& vU1I, const V& vU2R, const V& vU2I, const V& vU3R, const V& vU3I, T* pfReal, T* pfImag);
+};
 
+//	Stages 0 and 1 are always done together, so a 2 element transform falls back to the scalar version.
+template <>
+class FFT<1, f64, f64> : public FFT_Base<1, f64, f64>
+{
 };
 #endif
 
@@ -363,13 +701,15 @@ public:
 
 	using cxT = cxNumber<T>;
 	using cxTInternal = cxNumber<T_Twiddle>;
-	using sm_fft = FFT<M - 1, T, T_Twiddle>;
+	using sm_fft = FFT_Base<M - 1, T, T_Twiddle>;
 
 	//	Precomputed constants
 	static constexpr uint N = 1 << M;
 	static constexpr uint N_2 = N >> 1;
 	static constexpr uint N_4 = N >> 2;
 
+	using WindowCoefficients = typename FFT_Base<M, T, T_Twiddle>::WindowCoefficients;
+
 	FFT_Real_Base() = delete;
 
 	static void TransformForward(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI);
@@ -377,6 +717,11 @@ public:
 	static void TransformInverse(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
 	static void TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
 
+	//	Windowed variants for overlapped frame processing. The forward transform windows fTimeIn as it's read, and the inverse
+	// windows the normalized output and adds it to fTimeInOut, which is typically the overlap-add accumulation buffer.
+	static void TransformForwardApplyWindow(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const WindowCoefficients& coeff);
+	static void TransformInverseApplyWindow_Accumulate(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeInOut, const WindowCoefficients& coeff);
+
 	FFTL_NODISCARD FFTL_FORCEINLINE static const T_Twiddle& GetTwiddleReal(uint n) { return FFT_Twiddles<M - 2, T_Twiddle>::GetRealR()[n]; }
 	FFTL_NODISCARD FFTL_FORCEINLINE static const T_Twiddle& GetTwiddleImag(uint n) { return FFT_Twiddles<M - 2, T_Twiddle>::GetRealI()[n]; }
 	FFTL_NODISCARD FFTL_FORCEINLINE static const T_Twiddle* GetTwiddleRealPtr(uint n) { return FFT_Twiddles<M - 2, T_Twiddle>::GetRealR() + n; }
@@ -403,6 +748,49 @@ public:
 	using cxT = cxNumber<T>;
 	using sm_fft = FFT<M - 1, T, T_Twiddle>;
 
+	//	Usings from base class
+	using FFT_Real_Base<M, T, T_Twiddle>::N;
+	using FFT_Real_Base<M, T, T_Twiddle>::N_2;
+	using FFT_Real_Base<M, T, T_Twiddle>::N_4;
+	using FFT_Real_Base<M, T, T_Twiddle>::GetTwiddleReal;
+	using FFT_Real_Base<M, T, T_Twiddle>::GetTwiddleImag;
+	using FFT_Real_Base<M, T, T_Twiddle>::GetTwiddleRealPtr;
+	using FFT_Real_Base<M, T, T_Twiddle>::GetTwiddleImagPtr;
+	using typename FFT_Real_Base<M, T, T_Twiddle>::WindowCoefficients;
+
+	static void TransformForward(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI);
+	static void TransformForward_1stHalf(const FixedArray<T, N_2>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI); // 2nd half of fTimeIn is assumed to be all zeros
+	static void TransformInverse(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
+	static void TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
+
+	//	The window is applied while gathering the input for stage 0, and while interleaving the inverse output.
+	static void TransformForwardApplyWindow(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const WindowCoefficients& coeff);
+	static void TransformInverseApplyWindow_Accumulate(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeInOut, const WindowCoefficients& coeff);
+
+	//	Half precision spectra for storing many of them, such as precomputed filters. The transform itself still runs in f32,
+	// and the spectrum is only rounded to f16 on the way out or widened on the way in. Magnitudes must stay below 65504.
+	static void TransformForward(const FixedArray<T, N>& fTimeIn, FixedArray<f16, N_2>& fFreqOutR, FixedArray<f16, N_2>& fFreqOutI);
+	static void TransformForward_1stHalf(const FixedArray<T, N_2>& fTimeIn, FixedArray<f16, N_2>& fFreqOutR, FixedArray<f16, N_2>& fFreqOutI); // 2nd half of fTimeIn is assumed to be all zeros
+	static void TransformInverse(const FixedArray<f16, N_2>& fFreqInR, const FixedArray<f16, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
+
+private:
+	static void PostProcessForward(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI);
+	static void PreProcessInverse(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI);
+};
+#endif
+
+#if FFTL_SIMD_F64x2
+template <uint M>
+class FFTL_NODISCARD FFT_Real<M, f64, f64> : public FFT_Real_Base<M, f64, f64>
+{
+public:
+	constexpr FFT_Real<M, f64, f64>() = delete;
+
+	using T = f64;
+	using T_Twiddle = T;
+	using cxT = cxNumber<T>;
+	using sm_fft = FFT<M - 1, T, T_Twiddle>;
+
 	//	Usings from base class
 	using FFT_Real_Base<M, T, T_Twiddle>::N;
 	using FFT_Real_Base<M, T, T_Twiddle>::N_2;
@@ -418,23 +806,60 @@ public:
 	static void TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut);
 
 private:
+#if FFTL_SIMD_F64x4
+	using V = f64x4;
+#else
+	using V = f64x2;
+#endif
+
 	static void PostProcessForward(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI);
 	static void PreProcessInverse(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI);
+	static void InterleaveOutput(const FixedArray<T, N_2>& fInR, const FixedArray<T, N_2>& fInI, FixedArray<T, N>& fTimeOut);
+};
+
+//	Too small for the vectorized pre and post processing, so a 4 element transform falls back to the scalar version.
+template <>
+class FFTL_NODISCARD FFT_Real<2, f64, f64> : public FFT_Real_Base<2, f64, f64>
+{
+public:
+	FFT_Real() = delete;
 };
 #endif
 
+class FFTL_NODISCARD FFT_ComplexV_Base
+{
+public:
+	virtual ~FFT_ComplexV_Base() = default;
+	virtual void TransformForward(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const = 0;
+	virtual void TransformInverse(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const = 0;
+};
+
+//	Use this class if you need a complex FFT where the usage M is only known at runtime,
+// eg, use FFT_ComplexV_Base. T_FFT may be swapped for FFT_Base to force the non SIMD version.
+template <uint M, typename T_FFT = FFT<M, f32>>
+class FFTL_NODISCARD FFT_ComplexV : public FFT_ComplexV_Base
+{
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+
+	void TransformForward(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const override;
+	void TransformInverse(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const override;
+};
+
 class FFTL_NODISCARD FFT_RealV_Base
 {
 public:
+	virtual ~FFT_RealV_Base() = default;
 	virtual void TransformForward(const f32* fTimeIn, f32* fFreqOutR, f32* fFreqOutI) const = 0;
 	virtual void TransformInverse(const f32* fFreqInR, const f32* fFreqInI, f32* fTimeOut) const = 0;
 	virtual void TransformInverse_ClobberInput(f32* fFreqInR, f32* fFreqInI, f32* fTimeOut) const = 0;
 };
 
 //	Use this class if you need an FFT where the usage M is only known at runtime,
-// eg, use FFT_RealV_Base
-template <uint M>
-class FFTL_NODISCARD FFT_RealV : public FFT_RealV_Base, public FFT_Real<M, f32>
+// eg, use FFT_RealV_Base. T_FFT_REAL may be swapped for FFT_Real_Base to force the non SIMD version.
+template <uint M, typename T_FFT_REAL = FFT_Real<M, f32>>
+class FFTL_NODISCARD FFT_RealV : public FFT_RealV_Base
 {
 public:
 	//	Precomputed constants
@@ -470,35 +895,66 @@ public:
 		FixedArray_Aligned32<f32, N>& i() { return *reinterpret_cast<FixedArray_Aligned32<f32, N>*>(t + N); }
 	};
 
+	//	Half the footprint of Kernel, for when the kernel arrays outgrow the caches. Bins are widened to f32 as they're loaded,
+	// so only the storage is rounded, to about 66dB below each bin. Kernel spectra must stay below 65504 in magnitude.
+	struct KernelF16
+	{
+		static_assert(std::is_same<T, f32>::value, "Half precision kernels are only supported for f32 convolution");
+
+		FixedArray_Aligned32<f16, _2N> t;
+
+		const FixedArray_Aligned32<f16, N>& r() const { return *reinterpret_cast<const FixedArray_Aligned32<f16, N>*>(t + 0); }
+		const FixedArray_Aligned32<f16, N>& i() const { return *reinterpret_cast<const FixedArray_Aligned32<f16, N>*>(t + N); }
+
+		FixedArray_Aligned32<f16, N>& r() { return *reinterpret_cast<FixedArray_Aligned32<f16, N>*>(t + 0); }
+		FixedArray_Aligned32<f16, N>& i() { return *reinterpret_cast<FixedArray_Aligned32<f16, N>*>(t + N); }
+	};
+
 	Convolver();
 	~Convolver() = default;
 
+	//	T_Kernel is either Kernel or KernelF16, and the accumulation stays in full precision with either.
 	//	OK for input and output arrays to share the same memory space.
-	void Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArray_FD, size_t kernelArraySize);
-	void Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB);
+	template <typename T_Kernel>
+	void Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArray_FD, size_t kernelArraySize);
+	template <typename T_Kernel>
+	void Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB);
 
 	//	Only performs FFT, convolution, and IFFT necessary to fill the fInOutout buffer with the data needed right now.
-	void ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArray_FD, size_t kernelArraySize);
-	void ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB);
+	template <typename T_Kernel>
+	void ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArray_FD, size_t kernelArraySize);
+	template <typename T_Kernel>
+	void ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB);
 	void ConvolveInitial_LastStage(FixedArray_Aligned32<T, N>& fOutput);
 
 	//	Resumes convolution started via ConvolveInitial.
-	void ConvolveResumePartial(const Kernel* pKernelArray_FD, size_t kernelArraySize, size_t endKernelIndex);
-	void ConvolveResumePartial(const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB, size_t endKernelIndex);
+	template <typename T_Kernel>
+	void ConvolveResumePartial(const T_Kernel* pKernelArray_FD, size_t kernelArraySize, size_t endKernelIndex);
+	template <typename T_Kernel>
+	void ConvolveResumePartial(const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB, size_t endKernelIndex);
 
 	FFTL_NODISCARD size_t GetLeftoverKernels() const { return m_LeftoverKernelCount; }
 
-	static uint InitKernel(Kernel* pKernelOutput_FD, const T* pKernelInput_TD, size_t kernelLength);
+	template <typename T_Kernel>
+	static uint InitKernel(T_Kernel* pKernelOutput_FD, const T* pKernelInput_TD, size_t kernelLength);
 
 	//	Our FFT computer
 	typedef FFT_Real<M + 1, T, T_Twiddle> sm_fft;
 
 protected:
-	static void ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY); //	output = inX * inY
-	static void ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inW); //	output = inX * inY + inW
-	static void ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inW, T fGainY); //	output = inX * (inY * fGainY) + inW
-	static void ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inZ, const Kernel& inW, T fGainY, T fGainZ); //	output = inX * (inY * fGainY + inZ * fGainZ) + inW
+	template <typename T_Kernel> static void ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY); //	output = inX * inY
+	template <typename T_Kernel> static void ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const Kernel& inW); //	output = inX * inY + inW
+	template <typename T_Kernel> static void ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const Kernel& inW, T fGainY); //	output = inX * (inY * fGainY) + inW
+	template <typename T_Kernel> static void ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const T_Kernel& inZ, const Kernel& inW, T fGainY, T fGainZ); //	output = inX * (inY * fGainY + inZ * fGainZ) + inW
 	static void AddArrays(FixedArray_Aligned32<T, N>& output, const FixedArray_Aligned32<T, N>& inA, const FixedArray_Aligned32<T, N>& inB);
+	static void TransformKernel(Kernel& kernel, const FixedArray<T, N>& fKernelInput_TD);
+	static void TransformKernel(KernelF16& kernel, const FixedArray<T, N>& fKernelInput_TD);
+
+	//	Kernel bins are read through these, so that either kernel type is widened to T as it's loaded.
+	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 LoadKernel(const f32* pf) { return f32x8::LoadA(pf); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 LoadKernel(const f16* ph) { return f32x8::LoadF16(ph); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static T GetKernelValue(const T& v) { return v; }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f32 GetKernelValue(f16 h) { return F16ToF32(h); }
 
 	FixedArray_Aligned32<Kernel, T_MAX_KERNELS> m_AccumulationBuffer;
 	FixedArray_Aligned32<T, N> m_PrevTail;
@@ -145,27 +145,159 @@ constexpr FFT_TwiddlesContainer<TWIDDLE_TYPE, M, T>::FFT_TwiddlesContainer()
 	}
 }
 
+template <typename T_Table>
+const T_Table& FFT_LazyTable<T_Table>::Create()
+{
+	std::call_once(sm_OnceFlag, []()
+	{
+		sm_pTable.store(new (sm_Storage) T_Table(), std::memory_order_release);
+	});
+
+	//	call_once already orders the construction before this on every thread that gets here.
+	return *sm_pTable.load(std::memory_order_relaxed);
+}
+
+template <typename T>
+void FFT_ComputeCosSin(T* pCos, T* pSin, uint uCount, f64 fStep, f64 fCosScale, f64 fSinScale)
+{
+	const f64 fRotC = std::cos(4 * fStep);
+	const f64 fRotS = std::sin(4 * fStep);
+
+	alignas(32) f64 fC[4];
+	alignas(32) f64 fS[4];
+
+	uint n = 0;
+	for (; n + 4 <= uCount; n += 4)
+	{
+		if (n % FFT_COSSIN_RESEED_INTERVAL == 0)
+		{
+			for (uint j = 0; j < 4; ++j)
+			{
+				const f64 fAngle = fStep * static_cast<f64>(n + j);
+				fC[j] = std::cos(fAngle);
+				fS[j] = std::sin(fAngle);
+			}
+		}
+		else
+		{
+#if FFTL_SIMD_F64x4
+			const f64x4 vC = f64x4::LoadA(fC);
+			const f64x4 vS = f64x4::LoadA(fS);
+			const f64x4 vRotC = f64x4::Splat(fRotC);
+			const f64x4 vRotS = f64x4::Splat(fRotS);
+			SubMul(vC * vRotC, vS, vRotS).StoreA(fC);
+			AddMul(vS * vRotC, vC, vRotS).StoreA(fS);
+#else
+			for (uint j = 0; j < 4; ++j)
+			{
+				const f64 fPrevC = fC[j];
+				fC[j] = fPrevC * fRotC - fS[j] * fRotS;
+				fS[j] = fS[j] * fRotC + fPrevC * fRotS;
+			}
+#endif
+		}
+
+		for (uint j = 0; j < 4; ++j)
+		{
+			pCos[n + j] = static_cast<T>(fC[j] * fCosScale);
+			pSin[n + j] = static_cast<T>(fS[j] * fSinScale);
+		}
+	}
+
+	for (; n < uCount; ++n)
+	{
+		const f64 fAngle = fStep * static_cast<f64>(n);
+		pCos[n] = static_cast<T>(std::cos(fAngle) * fCosScale);
+		pSin[n] = static_cast<T>(std::sin(fAngle) * fSinScale);
+	}
+}
+
+#if !FFTL_SHARED_TWIDDLES
+template <uint M, typename T>
+FFT_Twiddles<M, T, false>::Tables::Tables()
+{
+	FFT_ComputeCosSin(m_CplxR.data(), m_CplxI.data(), N, PI_64 / N, 1.0, -1.0);
+	FFT_ComputeCosSin(m_RealI.data(), m_RealR.data(), N, PI_64 / (2 * N), -1.0, -1.0);
+}
+#endif
+
+#if FFTL_SHARED_TWIDDLES
+template <typename T>
+FFT_SharedTwiddles<T>::Table::Table()
+{
+	//	The top level is the only one that needs any trig.
+	constexpr uint N_MAX = 1u << MAX_M;
+	T* pTopR = m_Data + GetLevelOffset(MAX_M);
+	T* pTopI = pTopR + N_MAX;
+	T* pTopNegR = pTopI + N_MAX;
+	FFT_ComputeCosSin(pTopR, pTopI, N_MAX, PI_64 / N_MAX, 1.0, -1.0);
+	for (uint n = 0; n < N_MAX; ++n)
+		pTopNegR[n] = -pTopR[n];
+
+	for (uint m = 0; m < MAX_M; ++m)
+	{
+		const uint uSize = GetLevelSize(m);
+		const uint uCount = 1u << m;
+		const uint uShift = MAX_M - m;
+		T* pR = m_Data + GetLevelOffset(m);
+		for (uint a = 0; a < 3; ++a)
+		{
+			const T* pTop = pTopR + a * N_MAX;
+			T* pDst = pR + a * uSize;
+			for (uint n = 0; n < uCount; ++n)
+				pDst[n] = pTop[n << uShift];
+			for (uint n = uCount; n < uSize; ++n)
+				pDst[n] = 0;
+		}
+	}
+}
+#endif
+
 template <uint M, typename T_BR>
 constexpr FFT_BitreverseContainer<M, T_BR>::FFT_BitreverseContainer()
 {
-	//	Pre-compute bit-reversal indices
-	for (uint i = 0; i < N; ++i)
+	//	Pre-compute bit-reversal indices. The reverse of i is the reverse of i / 2 shifted down one, with the low bit of i moved to the top.
+	m_[0] = 0;
+	for (uint i = 1; i < N; ++i)
+		m_[i] = safestatic_cast<T_BR>((m_[i >> 1] >> 1) | ((i & 1) << (M - 1)));
+}
+
+template <uint M>
+template <typename T>
+FFTL_COND_INLINE void FFT_BitreversalBlocked<M>::Permute(const T* pIn, T* pOut)
+{
+	FFTL_ASSERT(pIn != pOut);
+
+	constexpr uint TILE = 1 << Q;
+	constexpr uint MIDDLE_BITS = M - 2 * Q;
+	constexpr uint HIGH_SHIFT = M - Q;
+
+	uint uReverseQ[TILE];
+	for (uint n = 0; n < TILE; ++n)
+		uReverseQ[n] = ReverseBits(n, Q);
+
+	alignas(32) T tile[TILE * TILE];
+
+	for (uint b = 0; b < (1u << MIDDLE_BITS); ++b)
 	{
-		const T_BR n = safestatic_cast<T_BR>(i);
-		T_BR uReverseIndex = n;
-		for (T_BR uRightIndex = 0, uLeftIndex = M - 1; uRightIndex < uLeftIndex; ++uRightIndex, --uLeftIndex)
-		{
-			const uint uShiftAmount = uLeftIndex - uRightIndex;
-			uReverseIndex &= ~((1 << uRightIndex) | (1 << uLeftIndex));
+		const uint bR = ReverseBits(b, MIDDLE_BITS);
 
-			T_BR bitRight = (1 << uRightIndex) & n;
-			T_BR bitLeft = (1 << uLeftIndex) & n;
-			bitRight <<= uShiftAmount;
-			bitLeft >>= uShiftAmount;
-			uReverseIndex |= bitLeft | bitRight;
+		//	Rows of the tile are indexed by the reversed high bits
+		for (uint a = 0; a < TILE; ++a)
+		{
+			const T* pSrc = pIn + (a << HIGH_SHIFT) + (b << Q);
+			T* pRow = tile + (uReverseQ[a] << Q);
+			for (uint c = 0; c < TILE; ++c)
+				pRow[c] = pSrc[c];
 		}
 
-		m_[n] = uReverseIndex;
+		//	The reversed low bits become the high bits of the output
+		for (uint c = 0; c < TILE; ++c)
+		{
+			T* pDst = pOut + (uReverseQ[c] << HIGH_SHIFT) + (bR << Q);
+			for (uint aR = 0; aR < TILE; ++aR)
+				pDst[aR] = tile[(aR << Q) + c];
+		}
 	}
 }
 
@@ -334,11 +466,19 @@ void FFT_Base<M, T, T_Twiddle>::PrintTimerInfo(uint iterationCount) const
 }
 
 template <uint M, typename T, typename T_Twiddle>
-void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::Compute(enFftWindowType windowType, uint uWidth)
+void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::Compute(enFftWindowType windowType, uint uWidth, f64 fParam)
 {
+	FFTL_ASSERT(uWidth >= 2 && uWidth <= N);
+
 	//	Zero out anything that might be lurking
 	MemZero(m_C);
 
+	fParam = FFT_GetWindowParam(windowType, fParam);
+
+	//	All of these are symmetric, so most only compute the first half and mirror it.
+	const uint uHalf = (uWidth + 1) >> 1;
+	const f64 fStep = 2.0 * PI_64 / (uWidth - 1);
+
 	//	Window function calculation
 	switch (windowType)
 	{
@@ -359,29 +499,265 @@ void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::Compute(enFftWindowType wind
 	break;
 	case kWindowHanning:
 	{
-		for (uint n = 0; n < uWidth; ++n)
-			m_C[n] = T_Twiddle(0.50 - 0.50 * Cos(2.0 * PI_64 * n / (uWidth - 1)));
+		static constexpr f64 a[] = { 0.50, -0.50 };
+		ComputeCosineSum(uHalf, fStep, a, 2);
+		MirrorFirstHalf(uWidth);
 	}
 	break;
 	case kWindowHamming:
 	{
-		for (uint n = 0; n < uWidth; ++n)
-			m_C[n] = T_Twiddle(0.54 - 0.46 * Cos(2.0 * PI_64 * n / (uWidth - 1)));
+		static constexpr f64 a[] = { 0.54, -0.46 };
+		ComputeCosineSum(uHalf, fStep, a, 2);
+		MirrorFirstHalf(uWidth);
 	}
 	break;
 	case kWindowBlackman:
 	{
-		for (uint n = 0; n < uWidth; ++n)
-			m_C[n] = T_Twiddle(0.42 - 0.50 * Cos(2.0 * PI_64 * n / (uWidth - 1)) + 0.08 * Cos(4.0 * PI_64 * n / (uWidth - 1)));
+		static constexpr f64 a[] = { 0.42, -0.50, 0.08 };
+		ComputeCosineSum(uHalf, fStep, a, 3);
+		MirrorFirstHalf(uWidth);
 	}
 	break;
 	case kWindowVorbis:
 	{
-		for (uint n = 0; n < uWidth; ++n)
-			m_C[n] = T_Twiddle(Sin(0.5 * PI_64 * Square(Sin(PI_64 / (uWidth) * (n + 0.5)))));
+		ComputeVorbis(uWidth);
+	}
+	break;
+	case kWindowKaiser:
+	{
+		const f64 fInvI0Beta = 1.0 / BesselI0(fParam);
+		for (uint n = 0; n < uHalf; ++n)
+		{
+			const f64 r = 2.0 * n / (uWidth - 1) - 1.0;
+			m_C[n] = T_Twiddle(BesselI0(fParam * Sqrt(Max(0.0, 1.0 - r * r))) * fInvI0Beta);
+		}
+		MirrorFirstHalf(uWidth);
+	}
+	break;
+	case kWindowBlackmanHarris:
+	{
+		static constexpr f64 a[] = { 0.35875, -0.48829, 0.14128, -0.01168 };
+		ComputeCosineSum(uHalf, fStep, a, 4);
+		MirrorFirstHalf(uWidth);
+	}
+	break;
+	case kWindowNuttall:
+	{
+		static constexpr f64 a[] = { 0.355768, -0.487396, 0.144232, -0.012604 };
+		ComputeCosineSum(uHalf, fStep, a, 4);
+		MirrorFirstHalf(uWidth);
+	}
+	break;
+	case kWindowFlatTop:
+	{
+		static constexpr f64 a[] = { 0.21557895, -0.41663158, 0.277263158, -0.083578947, 0.006947368 };
+		ComputeCosineSum(uHalf, fStep, a, 5);
+		MirrorFirstHalf(uWidth);
+	}
+	break;
+	case kWindowGaussian:
+	{
+		const f64 fCenter = 0.5 * (uWidth - 1);
+		const f64 fInvSigma = 1.0 / (fParam * fCenter);
+		for (uint n = 0; n < uHalf; ++n)
+			m_C[n] = T_Twiddle(Exp(-0.5 * Square((n - fCenter) * fInvSigma)));
+		MirrorFirstHalf(uWidth);
+	}
+	break;
+	case kWindowTukey:
+	{
+		//	Hann tapers over the first and last fParam / 2 of the width, flat in between.
+		const f64 fAlpha = Min(fParam, 1.0);
+		uint n = 0;
+		if (fAlpha > 0)
+		{
+			static constexpr f64 a[] = { 0.50, -0.50 };
+			n = Min(uHalf, static_cast<uint>(0.5 * fAlpha * (uWidth - 1)) + 1);
+			ComputeCosineSum(n, fStep / fAlpha, a, 2);
+		}
+		for (; n < uHalf; ++n)
+			m_C[n] = (T_Twiddle)1;
+		MirrorFirstHalf(uWidth);
 	}
 	break;
+	case kWindowDPSS:
+	{
+		ComputeDPSS(uWidth, fParam);
+	}
+	break;
+	}
+}
+
+template <uint M, typename T, typename T_Twiddle>
+void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::ComputeCosineSum(uint uCount, f64 fStep, const f64* pA, uint uTermCount)
+{
+	FFTL_ASSERT(uTermCount >= 2);
+
+	uint n = 0;
+
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T_Twiddle, f32>)
+	{
+		//	Only cos(n * step) needs the trig. The higher harmonics come from the Chebyshev recurrence
+		// cos(k * x) = 2 * cos(x) * cos((k - 1) * x) - cos((k - 2) * x).
+		const f32x4 vStep = f32x4::Splat(static_cast<f32>(fStep));
+		const f32x4 vFour = f32x4::Splat(4.f);
+		f32x4 vN = V4fSet(0.f, 1.f, 2.f, 3.f);
+
+		for (; n + 4 <= uCount; n += 4, vN = vN + vFour)
+		{
+			const f32x4 vCos1 = Cos(vN * vStep);
+			const f32x4 vTwoCos1 = vCos1 + vCos1;
+
+			f32x4 vCosPrev = f32x4::Splat(1.f);
+			f32x4 vCosK = vCos1;
+			f32x4 vSum = AddMul(f32x4::Splat(static_cast<f32>(pA[0])), f32x4::Splat(static_cast<f32>(pA[1])), vCos1);
+
+			for (uint k = 2; k < uTermCount; ++k)
+			{
+				const f32x4 vCosNext = vTwoCos1 * vCosK - vCosPrev;
+				vCosPrev = vCosK;
+				vCosK = vCosNext;
+				vSum = AddMul(vSum, f32x4::Splat(static_cast<f32>(pA[k])), vCosK);
+			}
+
+			vSum.StoreU(m_C + n);
+		}
+	}
+#endif
+
+	for (; n < uCount; ++n)
+	{
+		f64 fSum = pA[0];
+		for (uint k = 1; k < uTermCount; ++k)
+			fSum += pA[k] * Cos(fStep * k * n);
+		m_C[n] = T_Twiddle(fSum);
+	}
+}
+
+template <uint M, typename T, typename T_Twiddle>
+void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::ComputeVorbis(uint uWidth)
+{
+	const uint uHalf = (uWidth + 1) >> 1;
+	const f64 fStep = PI_64 / uWidth;
+
+	uint n = 0;
+
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T_Twiddle, f32>)
+	{
+		const f32x4 vStep = f32x4::Splat(static_cast<f32>(fStep));
+		const f32x4 vHalfPi = f32x4::Splat(0.5f * PI_32);
+		const f32x4 vFour = f32x4::Splat(4.f);
+		f32x4 vN = V4fSet(0.5f, 1.5f, 2.5f, 3.5f);
+
+		for (; n + 4 <= uHalf; n += 4, vN = vN + vFour)
+		{
+			const f32x4 vSin = Sin(vN * vStep);
+			Sin(vHalfPi * vSin * vSin).StoreU(m_C + n);
+		}
+	}
+#endif
+
+	for (; n < uHalf; ++n)
+		m_C[n] = T_Twiddle(Sin(0.5 * PI_64 * Square(Sin(fStep * (n + 0.5)))));
+
+	MirrorFirstHalf(uWidth);
+}
+
+template <uint M, typename T, typename T_Twiddle>
+void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::ComputeDPSS(uint uWidth, f64 fNW)
+{
+	//	The first discrete prolate spheroidal sequence is the eigenvector belonging to the largest eigenvalue of a
+	// symmetric tridiagonal matrix (Slepian, 1978). The eigenvalue is found by Sturm sequence bisection, then the
+	// eigenvector by inverse iteration. Everything is in f64 because the diagonal grows with the square of the width.
+	std::unique_ptr<f64[]> pWork(new f64[uWidth * 4]);
+	f64* pD = pWork.get();
+	f64* pE = pD + uWidth; // pE[i] couples i and i + 1, with pE[uWidth - 1] = 0
+	f64* pX = pE + uWidth;
+	f64* pC = pX + uWidth;
+
+	const f64 fCosW = Cos(2.0 * PI_64 * fNW / uWidth);
+	for (uint i = 0; i < uWidth; ++i)
+	{
+		pD[i] = Square(0.5 * (uWidth - 1.0 - 2.0 * i)) * fCosW;
+		pE[i] = 0.5 * (i + 1.0) * (uWidth - 1.0 - i);
+	}
+
+	//	Gershgorin bounds on the eigenvalues
+	f64 fLo = pD[0];
+	f64 fHi = pD[0];
+	for (uint i = 0; i < uWidth; ++i)
+	{
+		const f64 fRadius = pE[i] + (i > 0 ? pE[i - 1] : 0.0);
+		fLo = Min(fLo, pD[i] - fRadius);
+		fHi = Max(fHi, pD[i] + fRadius);
+	}
+	const f64 fTiny = std::numeric_limits<f64>::epsilon() * Max(Abs(fLo), Abs(fHi));
+	fHi += fTiny;
+
+	//	Number of eigenvalues less than x, from the signs of the LDL^T pivots of (T - xI).
+	auto CountBelow = [&](f64 x) -> uint
+	{
+		uint uCount = 0;
+		f64 q = 1;
+		for (uint i = 0; i < uWidth; ++i)
+		{
+			q = pD[i] - x - (i > 0 ? Square(pE[i - 1]) / q : 0.0);
+			if (Abs(q) < fTiny)
+				q = -fTiny;
+			uCount += q < 0;
+		}
+		return uCount;
+	};
+
+	for (uint uIter = 0; uIter < 128 && fHi - fLo > 2 * fTiny; ++uIter)
+	{
+		const f64 fMid = 0.5 * (fLo + fHi);
+		if (CountBelow(fMid) == uWidth)
+			fHi = fMid;
+		else
+			fLo = fMid;
+	}
+
+	//	fHi sits just above the largest eigenvalue, so (T - fHi * I) is nearly singular and a few solves are enough.
+	for (uint i = 0; i < uWidth; ++i)
+		pX[i] = 1;
+
+	for (uint uIter = 0; uIter < 3; ++uIter)
+	{
+		f64 fPivot = pD[0] - fHi;
+		if (Abs(fPivot) < fTiny)
+			fPivot = fTiny;
+		pC[0] = pE[0] / fPivot;
+		pX[0] /= fPivot;
+		for (uint i = 1; i < uWidth; ++i)
+		{
+			fPivot = pD[i] - fHi - pE[i - 1] * pC[i - 1];
+			if (Abs(fPivot) < fTiny)
+				fPivot = fTiny;
+			pC[i] = pE[i] / fPivot;
+			pX[i] = (pX[i] - pE[i - 1] * pX[i - 1]) / fPivot;
+		}
+		for (uint i = uWidth - 1; i-- > 0;)
+			pX[i] -= pC[i] * pX[i + 1];
+
+		f64 fPeak = pX[0];
+		for (uint i = 1; i < uWidth; ++i)
+			fPeak = Abs(pX[i]) > Abs(fPeak) ? pX[i] : fPeak;
+		for (uint i = 0; i < uWidth; ++i)
+			pX[i] /= fPeak;
 	}
+
+	for (uint i = 0; i < uWidth; ++i)
+		m_C[i] = T_Twiddle(pX[i]);
+}
+
+template <uint M, typename T, typename T_Twiddle>
+FFTL_FORCEINLINE void FFT_Base<M, T, T_Twiddle>::WindowCoefficients::MirrorFirstHalf(uint uWidth)
+{
+	for (uint n = 0; n < (uWidth >> 1); ++n)
+		m_C[uWidth - n - 1] = m_C[n];
 }
 
 
@@ -680,7 +1056,8 @@ FFTL_COND_INLINE void FFT_Base<M, T, T_Twiddle>::TransformForward(const FixedArr
 #endif
 
 	//	Invoke the main transform function
-	Transform_Main_DIT<M - 1, 1, false>(cxOutput);
+	if constexpr (M > 1)
+		Transform_Main_DIT<M - 1, 1, false>(cxOutput);
 }
 
 template <uint M, typename T, typename T_Twiddle>
@@ -710,7 +1087,8 @@ FFTL_COND_INLINE void FFT_Base<M, T, T_Twiddle>::TransformForward(const FixedArr
 #endif
 
 	//	Invoke the main transform function
-	Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
+	if constexpr (M > 1)
+		Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
 }
 
 template <uint M, typename T, typename T_Twiddle>
@@ -740,7 +1118,8 @@ FFTL_COND_INLINE void FFT_Base<M, T, T_Twiddle>::TransformForward(const FixedArr
 #endif
 
 	//	Invoke the main transform function
-	Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
+	if constexpr (M > 1)
+		Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
 }
 
 template <uint M, typename T, typename T_Twiddle>
@@ -773,7 +1152,8 @@ FFTL_COND_INLINE void FFT_Base<M, T, T_Twiddle>::TransformForward_1stHalf(const
 #endif
 
 	//	Invoke the main transform function
-	Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
+	if constexpr (M > 1)
+		Transform_Main_DIT<M - 1, 1>(fOutR, fOutI);
 }
 
 template <uint M, typename T, typename T_Twiddle>
@@ -979,37 +1359,39 @@ void FFT_Base<M, T, T_Twiddle>::TransformInverse_Slow(const FixedArray<cxT, N>&
 template <uint M>
 FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	Transform_Stage0_BR(fInR, fInI, fOutR, fOutI);
-
-	//	Invoke the main transform functions for each stage
-	constexpr_for<1, M, +1>([&](auto STAGE)
+	if constexpr (FFT_UseBlockedBitreversal<M>::value)
 	{
-		Transform_Main_DIT<STAGE>(fOutR, fOutI);
-	});
+		//	Permute with unit stride runs, then run every stage in place.
+		FFT_BitreversalBlocked<M>::Permute(fInR.data(), fOutR.data());
+		FFT_BitreversalBlocked<M>::Permute(fInI.data(), fOutI.data());
+		Transform_Stages_DIT<0>(fOutR, fOutI);
+	}
+	else
+	{
+		Transform_Stage0_BR(fInR, fInI, fOutR, fOutI);
+		Transform_Stages_DIT<1>(fOutR, fOutI);
+	}
 }
 
 template <uint M>
 FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
 	Transform_Stage0_BR(cxInput, fOutR, fOutI);
+	Transform_Stages_DIT<1>(fOutR, fOutI);
+}
 
-	//	Invoke the main transform functions for each stage
-	constexpr_for<1, M, +1>([&](auto STAGE)
-	{
-		Transform_Main_DIT<STAGE>(fOutR, fOutI);
-	});
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward(const FixedArray<cxT, N>& cxInput, const FixedArray<T, N * 2>& fWindow, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	Transform_Stage0_BR(cxInput, fWindow, fOutR, fOutI);
+	Transform_Stages_DIT<1>(fOutR, fOutI);
 }
 
 template <uint M>
 FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward_1stHalf(const FixedArray<cxT, N_2>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) // 2nd half of cxInput is assumed to be all zero
 {
 	Transform_Stage0_BR_1stHalf(cxInput, fOutR, fOutI);
-
-	//	Invoke the main transform functions for each stage
-	constexpr_for<1, M, +1>([&](auto STAGE)
-	{
-		Transform_Main_DIT<STAGE>(fOutR, fOutI);
-	});
+	Transform_Stages_DIT<1>(fOutR, fOutI);
 }
 
 template <uint M>
@@ -1040,22 +1422,92 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::TransformInverse(const FixedArray<T, N>&
 
 template <uint M>
 FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward_InPlace_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	Transform_Stages_DIF(fOutR, fOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::TransformInverse_InPlace_DIT(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI)
+{
+	//	Swap the real and imaginary parts.
+	Transform_Stages_DIT<0>(fInOutI, fInOutR);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<cxT, N>& cxOutput)
+{
+	if constexpr (M < INTERLEAVED_MIN_M)
+	{
+		FFT_Base<M, T, T_Twiddle>::TransformForward(cxInput, cxOutput);
+	}
+	else
+	{
+		//	The input is split into blocks while gathering the bit reversed indices of stage 0, and merged back in the last pass.
+		T* pf = &cxOutput[0].r;
+		Transform_Stage0_BR(cxInput, BlockedData{ pf });
+		Transform_Stages_DIT<1, OUTER_STAGE_BEGIN>(BlockedData{ pf });
+		Transform_Outer_DIT_Merge<false>(pf);
+	}
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::TransformForward_InPlace_DIF(FixedArray<cxT, N>& cxInOut)
+{
+	if constexpr (M < INTERLEAVED_MIN_M)
+	{
+		FFT_Base<M, T, T_Twiddle>::TransformForward_InPlace_DIF(cxInOut);
+	}
+	else
+	{
+		T* pf = &cxInOut[0].r;
+		Transform_Outer_DIF_Split(pf);
+		Transform_Stages_DIF<OUTER_STAGE_BEGIN - 1, 1>(BlockedData{ pf });
+		Transform_Stage0_DIF_Merge(pf);
+	}
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::TransformInverse_InPlace_DIT(FixedArray<cxT, N>& cxInOut)
+{
+	if constexpr (M < INTERLEAVED_MIN_M)
+	{
+		FFT_Base<M, T, T_Twiddle>::TransformInverse_InPlace_DIT(cxInOut);
+	}
+	else
+	{
+		//	Swap the real and imaginary parts.
+		T* pf = &cxInOut[0].r;
+		Transform_Stage0_DIT_Split<true>(pf);
+		Transform_Stages_DIT<1, OUTER_STAGE_BEGIN>(BlockedData{ pf });
+		Transform_Outer_DIT_Merge<true>(pf);
+	}
+}
+
+template <uint M>
+template <uint STAGE_BEGIN, uint STAGE_END, typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Stages_DIT(const T_Data& data)
 {
 	//	Invoke the main transform functions for each stage
-	constexpr_for<M - 1, -1, -1>([&](auto STAGE)
+	constexpr_for<STAGE_BEGIN, STAGE_END, +1>([&](auto STAGE)
 	{
-		Transform_Main_DIF<STAGE>(fOutR, fOutI);
+		if constexpr (!USE_RADIX4 || STAGE < RADIX4_STAGE_BEGIN)
+			Transform_Main_DIT<STAGE>(data);
+		else if constexpr (((STAGE - RADIX4_STAGE_BEGIN) & 1) == 0)
+			Transform_Main_DIT_Radix4<STAGE>(data);
 	});
 }
 
 template <uint M>
-FFTL_COND_INLINE void FFT<M, f32, f32>::TransformInverse_InPlace_DIT(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI)
+template <uint STAGE_FIRST, uint STAGE_LAST, typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Stages_DIF(const T_Data& data)
 {
-	//	Invoke the main transform functions for each stage.
-	// Swap the real and imaginary parts.
-	constexpr_for<0, M, +1>([&](auto STAGE)
+	//	Invoke the main transform functions for each stage, running backwards
+	constexpr_for<STAGE_FIRST, int(STAGE_LAST) - 1, -1>([&](auto STAGE)
 	{
-		Transform_Main_DIT<STAGE>(fInOutI, fInOutR);
+		if constexpr (!USE_RADIX4 || STAGE < RADIX4_STAGE_BEGIN)
+			Transform_Main_DIF<STAGE>(data);
+		else if constexpr (((STAGE - RADIX4_STAGE_BEGIN) & 1) == 1)
+			Transform_Main_DIF_Radix4<STAGE - 1>(data);
 	});
 }
 
@@ -1069,32 +1521,11 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<T,
 #endif
 
 	//	Perform the first stage of the transform while copying the input to the output with bit reversal indices.
-	for (uint n = 0; n < N; n += 8)
+#if FFTL_SIMD_F32x8
+	if constexpr (USE_8WIDE_STAGE012)
 	{
-		//	Loop for each 4 butterflies
-
-#if defined(FFTL_AVX2) && 0 // This approach is actually slower. Don't use it.
-		if constexpr (sizeof(T_BR) == 2)
-		{
-			//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
-			const __m128i v16Indices = _mm_load_si128(reinterpret_cast<const __m128i*>(sm_BitReverseIndices + n));
-			const __m128i v32Indices_0_3 = _mm_unpacklo_epi16(v16Indices, _mm_setzero_si128());
-			const __m128i v32Indices_4_7 = _mm_unpackhi_epi16(v16Indices, _mm_setzero_si128());
-			const __m128i v32Indices_Ev = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(v32Indices_0_3), _mm_castsi128_ps(v32Indices_4_7), FFTL_MM_SHUFFLE_XYZW(0, 2, 0, 2)));
-			const __m128i v32Indices_Od = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(v32Indices_0_3), _mm_castsi128_ps(v32Indices_4_7), FFTL_MM_SHUFFLE_XYZW(1, 3, 1, 3)));
-
-			const f32x4 vCurR = _mm_i32gather_ps(fInReal.data(), v32Indices_Ev, 4);
-			const f32x4 vCurI = _mm_i32gather_ps(fInImag.data(), v32Indices_Ev, 4);
-
-			const f32x4 vNextR = _mm_i32gather_ps(fInReal.data(), v32Indices_Od, 4);
-			const f32x4 vNextI = _mm_i32gather_ps(fInImag.data(), v32Indices_Od, 4);
-
-			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-			// Also the input is already pre-shuffled.
-			Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
-		}
-		else
-#endif
+		//	Loop for each 8 butterflies
+		for (uint n = 0; n < N; n += 16)
 		{
 			const uint nR0 = GetBitReverseIndex(n + 0);
 			const uint nR1 = GetBitReverseIndex(n + 1);
@@ -1104,17 +1535,76 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<T,
 			const uint nR5 = GetBitReverseIndex(n + 5);
 			const uint nR6 = GetBitReverseIndex(n + 6);
 			const uint nR7 = GetBitReverseIndex(n + 7);
+			const uint nR8 = GetBitReverseIndex(n + 8);
+			const uint nR9 = GetBitReverseIndex(n + 9);
+			const uint nR10 = GetBitReverseIndex(n + 10);
+			const uint nR11 = GetBitReverseIndex(n + 11);
+			const uint nR12 = GetBitReverseIndex(n + 12);
+			const uint nR13 = GetBitReverseIndex(n + 13);
+			const uint nR14 = GetBitReverseIndex(n + 14);
+			const uint nR15 = GetBitReverseIndex(n + 15);
+
+			//	Shuffle the inputs around so that we can do 8 butterflies at once. Current is even, next is odd.
+			// Each half is ordered 0,4,2,6 so that the output can be interleaved with in-lane unpacks.
+			const f32x8 vCurR = V8fSet(fInReal[nR0], fInReal[nR4], fInReal[nR2], fInReal[nR6], fInReal[nR8], fInReal[nR12], fInReal[nR10], fInReal[nR14]);
+			const f32x8 vCurI = V8fSet(fInImag[nR0], fInImag[nR4], fInImag[nR2], fInImag[nR6], fInImag[nR8], fInImag[nR12], fInImag[nR10], fInImag[nR14]);
+
+			const f32x8 vNextR = V8fSet(fInReal[nR1], fInReal[nR5], fInReal[nR3], fInReal[nR7], fInReal[nR9], fInReal[nR13], fInReal[nR11], fInReal[nR15]);
+			const f32x8 vNextI = V8fSet(fInImag[nR1], fInImag[nR5], fInImag[nR3], fInImag[nR7], fInImag[nR9], fInImag[nR13], fInImag[nR11], fInImag[nR15]);
+
+			Calculate8Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+		}
+	}
+	else
+#endif
+	{
+		for (uint n = 0; n < N; n += 8)
+		{
+			//	Loop for each 4 butterflies
 
-			//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
-			const f32x4 vCurR = V4fSet(fInReal[nR0], fInReal[nR2], fInReal[nR4], fInReal[nR6]);
-			const f32x4 vCurI = V4fSet(fInImag[nR0], fInImag[nR2], fInImag[nR4], fInImag[nR6]);
-
-			const f32x4 vNextR = V4fSet(fInReal[nR1], fInReal[nR3], fInReal[nR5], fInReal[nR7]);
-			const f32x4 vNextI = V4fSet(fInImag[nR1], fInImag[nR3], fInImag[nR5], fInImag[nR7]);
-
-			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-			// Also the input is already pre-shuffled.
-			Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+#if defined(FFTL_AVX2) && 0 // This approach is actually slower. Don't use it.
+			if constexpr (sizeof(T_BR) == 2)
+			{
+				//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
+				const __m128i v16Indices = _mm_load_si128(reinterpret_cast<const __m128i*>(sm_BitReverseIndices + n));
+				const __m128i v32Indices_0_3 = _mm_unpacklo_epi16(v16Indices, _mm_setzero_si128());
+				const __m128i v32Indices_4_7 = _mm_unpackhi_epi16(v16Indices, _mm_setzero_si128());
+				const __m128i v32Indices_Ev = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(v32Indices_0_3), _mm_castsi128_ps(v32Indices_4_7), FFTL_MM_SHUFFLE_XYZW(0, 2, 0, 2)));
+				const __m128i v32Indices_Od = _mm_castps_si128(_mm_shuffle_ps(_mm_castsi128_ps(v32Indices_0_3), _mm_castsi128_ps(v32Indices_4_7), FFTL_MM_SHUFFLE_XYZW(1, 3, 1, 3)));
+
+				const f32x4 vCurR = _mm_i32gather_ps(fInReal.data(), v32Indices_Ev, 4);
+				const f32x4 vCurI = _mm_i32gather_ps(fInImag.data(), v32Indices_Ev, 4);
+
+				const f32x4 vNextR = _mm_i32gather_ps(fInReal.data(), v32Indices_Od, 4);
+				const f32x4 vNextI = _mm_i32gather_ps(fInImag.data(), v32Indices_Od, 4);
+
+				//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+				// Also the input is already pre-shuffled.
+				Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+			}
+			else
+#endif
+			{
+				const uint nR0 = GetBitReverseIndex(n + 0);
+				const uint nR1 = GetBitReverseIndex(n + 1);
+				const uint nR2 = GetBitReverseIndex(n + 2);
+				const uint nR3 = GetBitReverseIndex(n + 3);
+				const uint nR4 = GetBitReverseIndex(n + 4);
+				const uint nR5 = GetBitReverseIndex(n + 5);
+				const uint nR6 = GetBitReverseIndex(n + 6);
+				const uint nR7 = GetBitReverseIndex(n + 7);
+
+				//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
+				const f32x4 vCurR = V4fSet(fInReal[nR0], fInReal[nR2], fInReal[nR4], fInReal[nR6]);
+				const f32x4 vCurI = V4fSet(fInImag[nR0], fInImag[nR2], fInImag[nR4], fInImag[nR6]);
+
+				const f32x4 vNextR = V4fSet(fInReal[nR1], fInReal[nR3], fInReal[nR5], fInReal[nR7]);
+				const f32x4 vNextI = V4fSet(fInImag[nR1], fInImag[nR3], fInImag[nR5], fInImag[nR7]);
+
+				//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+				// Also the input is already pre-shuffled.
+				Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+			}
 		}
 	}
 
@@ -1125,7 +1615,8 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<T,
 }
 
 template <uint M>
-FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+template <typename T_Data>
+FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, const T_Data& data)
 {
 	//	Specialized SIMD case for stage 0 that requires XXZZYYWW shuffling
 #if FFTL_STAGE_TIMERS
@@ -1134,32 +1625,147 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<cxT
 #endif
 
 	//	Perform the first stage of the transform while copying the input to the output with bit reversal indices.
-	for (uint n = 0; n < N; n += 8)
+#if FFTL_SIMD_F32x8
+	if constexpr (USE_8WIDE_STAGE012)
 	{
-		//	Loop for each 4 butterflies
-
-		const uint nR0 = GetBitReverseIndex(n + 0);
-		const uint nR1 = GetBitReverseIndex(n + 1);
-		const uint nR2 = GetBitReverseIndex(n + 2);
-		const uint nR3 = GetBitReverseIndex(n + 3);
-		const uint nR4 = GetBitReverseIndex(n + 4);
-		const uint nR5 = GetBitReverseIndex(n + 5);
-		const uint nR6 = GetBitReverseIndex(n + 6);
-		const uint nR7 = GetBitReverseIndex(n + 7);
-
-		//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
-		const f32x4 vCurR = V4fSet(cxInput[nR0].r, cxInput[nR2].r, cxInput[nR4].r, cxInput[nR6].r);
-		const f32x4 vCurI = V4fSet(cxInput[nR0].i, cxInput[nR2].i, cxInput[nR4].i, cxInput[nR6].i);
-
-		const f32x4 vNextR = V4fSet(cxInput[nR1].r, cxInput[nR3].r, cxInput[nR5].r, cxInput[nR7].r);
-		const f32x4 vNextI = V4fSet(cxInput[nR1].i, cxInput[nR3].i, cxInput[nR5].i, cxInput[nR7].i);
-
-		//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-		// Also the input is already pre-shuffled.
-		Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
-	}
-
-#if FFTL_STAGE_TIMERS
+		//	Loop for each 8 butterflies
+		for (uint n = 0; n < N; n += 16)
+		{
+			const uint nR0 = GetBitReverseIndex(n + 0);
+			const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+			const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+			const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+			const uint nR7 = GetBitReverseIndex(n + 7);
+			const uint nR8 = GetBitReverseIndex(n + 8);
+			const uint nR9 = GetBitReverseIndex(n + 9);
+			const uint nR10 = GetBitReverseIndex(n + 10);
+			const uint nR11 = GetBitReverseIndex(n + 11);
+			const uint nR12 = GetBitReverseIndex(n + 12);
+			const uint nR13 = GetBitReverseIndex(n + 13);
+			const uint nR14 = GetBitReverseIndex(n + 14);
+			const uint nR15 = GetBitReverseIndex(n + 15);
+
+			//	Shuffle the inputs around so that we can do 8 butterflies at once. Current is even, next is odd.
+			// Each half is ordered 0,4,2,6 so that the output can be interleaved with in-lane unpacks.
+			const f32x8 vCurR = V8fSet(cxInput[nR0].r, cxInput[nR4].r, cxInput[nR2].r, cxInput[nR6].r, cxInput[nR8].r, cxInput[nR12].r, cxInput[nR10].r, cxInput[nR14].r);
+			const f32x8 vCurI = V8fSet(cxInput[nR0].i, cxInput[nR4].i, cxInput[nR2].i, cxInput[nR6].i, cxInput[nR8].i, cxInput[nR12].i, cxInput[nR10].i, cxInput[nR14].i);
+
+			const f32x8 vNextR = V8fSet(cxInput[nR1].r, cxInput[nR5].r, cxInput[nR3].r, cxInput[nR7].r, cxInput[nR9].r, cxInput[nR13].r, cxInput[nR11].r, cxInput[nR15].r);
+			const f32x8 vNextI = V8fSet(cxInput[nR1].i, cxInput[nR5].i, cxInput[nR3].i, cxInput[nR7].i, cxInput[nR9].i, cxInput[nR13].i, cxInput[nR11].i, cxInput[nR15].i);
+
+			Calculate8Butterflies_DIT_Stage0<T_Data>(vCurR, vNextR, vCurI, vNextI, data.R(n), data.I(n));
+		}
+	}
+	else
+#endif
+	{
+		for (uint n = 0; n < N; n += 8)
+		{
+			//	Loop for each 4 butterflies
+
+			const uint nR0 = GetBitReverseIndex(n + 0);
+			const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+			const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+			const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+			const uint nR7 = GetBitReverseIndex(n + 7);
+
+			//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
+			const f32x4 vCurR = V4fSet(cxInput[nR0].r, cxInput[nR2].r, cxInput[nR4].r, cxInput[nR6].r);
+			const f32x4 vCurI = V4fSet(cxInput[nR0].i, cxInput[nR2].i, cxInput[nR4].i, cxInput[nR6].i);
+
+			const f32x4 vNextR = V4fSet(cxInput[nR1].r, cxInput[nR3].r, cxInput[nR5].r, cxInput[nR7].r);
+			const f32x4 vNextI = V4fSet(cxInput[nR1].i, cxInput[nR3].i, cxInput[nR5].i, cxInput[nR7].i);
+
+			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+			// Also the input is already pre-shuffled.
+			Calculate4Butterflies_DIT_Stage0<T_Data>(vCurR, vNextR, vCurI, vNextI, data.R(n), data.I(n));
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[0] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR(const FixedArray<cxT, N>& cxInput, const FixedArray<T, N * 2>& fWindow, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	//	Same as the unwindowed version, but the window is gathered with the same indices and multiplied in before the butterflies.
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	//	Each window element is an interleaved pair, matching the real and imaginary parts of cxInput.
+	const T* pfWindow = fWindow.data();
+
+#if FFTL_SIMD_F32x8
+	if constexpr (USE_8WIDE_STAGE012)
+	{
+		for (uint n = 0; n < N; n += 16)
+		{
+			const uint nR0 = GetBitReverseIndex(n + 0);
+			const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+			const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+			const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+			const uint nR7 = GetBitReverseIndex(n + 7);
+			const uint nR8 = GetBitReverseIndex(n + 8);
+			const uint nR9 = GetBitReverseIndex(n + 9);
+			const uint nR10 = GetBitReverseIndex(n + 10);
+			const uint nR11 = GetBitReverseIndex(n + 11);
+			const uint nR12 = GetBitReverseIndex(n + 12);
+			const uint nR13 = GetBitReverseIndex(n + 13);
+			const uint nR14 = GetBitReverseIndex(n + 14);
+			const uint nR15 = GetBitReverseIndex(n + 15);
+
+			const f32x8 vCurR = V8fSet(cxInput[nR0].r, cxInput[nR4].r, cxInput[nR2].r, cxInput[nR6].r, cxInput[nR8].r, cxInput[nR12].r, cxInput[nR10].r, cxInput[nR14].r)
+				* V8fSet(pfWindow[2 * nR0 + 0], pfWindow[2 * nR4 + 0], pfWindow[2 * nR2 + 0], pfWindow[2 * nR6 + 0], pfWindow[2 * nR8 + 0], pfWindow[2 * nR12 + 0], pfWindow[2 * nR10 + 0], pfWindow[2 * nR14 + 0]);
+			const f32x8 vCurI = V8fSet(cxInput[nR0].i, cxInput[nR4].i, cxInput[nR2].i, cxInput[nR6].i, cxInput[nR8].i, cxInput[nR12].i, cxInput[nR10].i, cxInput[nR14].i)
+				* V8fSet(pfWindow[2 * nR0 + 1], pfWindow[2 * nR4 + 1], pfWindow[2 * nR2 + 1], pfWindow[2 * nR6 + 1], pfWindow[2 * nR8 + 1], pfWindow[2 * nR12 + 1], pfWindow[2 * nR10 + 1], pfWindow[2 * nR14 + 1]);
+
+			const f32x8 vNextR = V8fSet(cxInput[nR1].r, cxInput[nR5].r, cxInput[nR3].r, cxInput[nR7].r, cxInput[nR9].r, cxInput[nR13].r, cxInput[nR11].r, cxInput[nR15].r)
+				* V8fSet(pfWindow[2 * nR1 + 0], pfWindow[2 * nR5 + 0], pfWindow[2 * nR3 + 0], pfWindow[2 * nR7 + 0], pfWindow[2 * nR9 + 0], pfWindow[2 * nR13 + 0], pfWindow[2 * nR11 + 0], pfWindow[2 * nR15 + 0]);
+			const f32x8 vNextI = V8fSet(cxInput[nR1].i, cxInput[nR5].i, cxInput[nR3].i, cxInput[nR7].i, cxInput[nR9].i, cxInput[nR13].i, cxInput[nR11].i, cxInput[nR15].i)
+				* V8fSet(pfWindow[2 * nR1 + 1], pfWindow[2 * nR5 + 1], pfWindow[2 * nR3 + 1], pfWindow[2 * nR7 + 1], pfWindow[2 * nR9 + 1], pfWindow[2 * nR13 + 1], pfWindow[2 * nR11 + 1], pfWindow[2 * nR15 + 1]);
+
+			Calculate8Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+		}
+	}
+	else
+#endif
+	{
+		for (uint n = 0; n < N; n += 8)
+		{
+			const uint nR0 = GetBitReverseIndex(n + 0);
+			const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+			const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+			const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+			const uint nR7 = GetBitReverseIndex(n + 7);
+
+			const f32x4 vCurR = V4fSet(cxInput[nR0].r, cxInput[nR2].r, cxInput[nR4].r, cxInput[nR6].r) * V4fSet(pfWindow[2 * nR0 + 0], pfWindow[2 * nR2 + 0], pfWindow[2 * nR4 + 0], pfWindow[2 * nR6 + 0]);
+			const f32x4 vCurI = V4fSet(cxInput[nR0].i, cxInput[nR2].i, cxInput[nR4].i, cxInput[nR6].i) * V4fSet(pfWindow[2 * nR0 + 1], pfWindow[2 * nR2 + 1], pfWindow[2 * nR4 + 1], pfWindow[2 * nR6 + 1]);
+
+			const f32x4 vNextR = V4fSet(cxInput[nR1].r, cxInput[nR3].r, cxInput[nR5].r, cxInput[nR7].r) * V4fSet(pfWindow[2 * nR1 + 0], pfWindow[2 * nR3 + 0], pfWindow[2 * nR5 + 0], pfWindow[2 * nR7 + 0]);
+			const f32x4 vNextI = V4fSet(cxInput[nR1].i, cxInput[nR3].i, cxInput[nR5].i, cxInput[nR7].i) * V4fSet(pfWindow[2 * nR1 + 1], pfWindow[2 * nR3 + 1], pfWindow[2 * nR5 + 1], pfWindow[2 * nR7 + 1]);
+
+			Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
 	timer.Stop();
 	m_StageTimers[0] += timer.GetTicks();
 #endif
@@ -1175,31 +1781,69 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR_1stHalf(const FixedA
 #endif
 
 	//	Perform the first stage of the transform while copying the input to the output with bit reversal indices.
-	for (uint n = 0; n < N; n += 8)
+#if FFTL_SIMD_F32x8
+	if constexpr (USE_8WIDE_STAGE012)
+	{
+		//	Loop for each 8 butterflies
+		for (uint n = 0; n < N; n += 16)
+		{
+			const uint nR0 = GetBitReverseIndex(n + 0);
+//			const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+//			const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+//			const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+//			const uint nR7 = GetBitReverseIndex(n + 7);
+			const uint nR8 = GetBitReverseIndex(n + 8);
+//			const uint nR9 = GetBitReverseIndex(n + 9);
+			const uint nR10 = GetBitReverseIndex(n + 10);
+//			const uint nR11 = GetBitReverseIndex(n + 11);
+			const uint nR12 = GetBitReverseIndex(n + 12);
+//			const uint nR13 = GetBitReverseIndex(n + 13);
+			const uint nR14 = GetBitReverseIndex(n + 14);
+//			const uint nR15 = GetBitReverseIndex(n + 15);
+
+			//	Shuffle the inputs around so that we can do 8 butterflies at once. Current is even, next is odd.
+			// Each half is ordered 0,4,2,6 so that the output can be interleaved with in-lane unpacks.
+			const f32x8 vCurR = V8fSet(cxInput[nR0].r, cxInput[nR4].r, cxInput[nR2].r, cxInput[nR6].r, cxInput[nR8].r, cxInput[nR12].r, cxInput[nR10].r, cxInput[nR14].r);
+			const f32x8 vCurI = V8fSet(cxInput[nR0].i, cxInput[nR4].i, cxInput[nR2].i, cxInput[nR6].i, cxInput[nR8].i, cxInput[nR12].i, cxInput[nR10].i, cxInput[nR14].i);
+
+			const f32x8 vNextR = f32x8::Zero();
+			const f32x8 vNextI = f32x8::Zero();
+
+			Calculate8Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+		}
+	}
+	else
+#endif
 	{
-		//	Loop for each 4 butterflies
+		for (uint n = 0; n < N; n += 8)
+		{
+			//	Loop for each 4 butterflies
 
-		const uint nR0 = GetBitReverseIndex(n + 0);
-//		const uint nR1 = GetBitReverseIndex(n + 1);
-		const uint nR2 = GetBitReverseIndex(n + 2);
-//		const uint nR3 = GetBitReverseIndex(n + 3);
-		const uint nR4 = GetBitReverseIndex(n + 4);
-//		const uint nR5 = GetBitReverseIndex(n + 5);
-		const uint nR6 = GetBitReverseIndex(n + 6);
-//		const uint nR7 = GetBitReverseIndex(n + 7);
+			const uint nR0 = GetBitReverseIndex(n + 0);
+	//		const uint nR1 = GetBitReverseIndex(n + 1);
+			const uint nR2 = GetBitReverseIndex(n + 2);
+	//		const uint nR3 = GetBitReverseIndex(n + 3);
+			const uint nR4 = GetBitReverseIndex(n + 4);
+	//		const uint nR5 = GetBitReverseIndex(n + 5);
+			const uint nR6 = GetBitReverseIndex(n + 6);
+	//		const uint nR7 = GetBitReverseIndex(n + 7);
 
-		//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
-		const f32x4 vCurR = V4fSet(cxInput[nR0].r, cxInput[nR2].r, cxInput[nR4].r, cxInput[nR6].r);
-		const f32x4 vCurI = V4fSet(cxInput[nR0].i, cxInput[nR2].i, cxInput[nR4].i, cxInput[nR6].i);
+			//	Shuffle the inputs around so that we can do 4 butterflies at once. Current is even, next is odd.
+			const f32x4 vCurR = V4fSet(cxInput[nR0].r, cxInput[nR2].r, cxInput[nR4].r, cxInput[nR6].r);
+			const f32x4 vCurI = V4fSet(cxInput[nR0].i, cxInput[nR2].i, cxInput[nR4].i, cxInput[nR6].i);
 
-//		const f32x4 vNextR = V4fSet(cxInput[nR1].r, cxInput[nR3].r, cxInput[nR5].r, cxInput[nR7].r);
-//		const f32x4 vNextI = V4fSet(cxInput[nR1].i, cxInput[nR3].i, cxInput[nR5].i, cxInput[nR7].i);
-		const f32x4 vNextR = f32x4::Zero();
-		const f32x4 vNextI = f32x4::Zero();
+	//		const f32x4 vNextR = V4fSet(cxInput[nR1].r, cxInput[nR3].r, cxInput[nR5].r, cxInput[nR7].r);
+	//		const f32x4 vNextI = V4fSet(cxInput[nR1].i, cxInput[nR3].i, cxInput[nR5].i, cxInput[nR7].i);
+			const f32x4 vNextR = f32x4::Zero();
+			const f32x4 vNextI = f32x4::Zero();
 
-		//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-		// Also the input is already pre-shuffled.
-		Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+			// Also the input is already pre-shuffled.
+			Calculate4Butterflies_DIT_Stage0(vCurR, vNextR, vCurI, vNextI, &fOutR[n], &fOutI[n]);
+		}
 	}
 
 #if FFTL_STAGE_TIMERS
@@ -1209,8 +1853,8 @@ FFTL_COND_INLINE void FFT<M, f32, f32>::Transform_Stage0_BR_1stHalf(const FixedA
 }
 
 template <uint M>
-template <uint STAGE_CURRENT>
-void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+template <uint STAGE_CURRENT, typename T_Data>
+void FFT<M, f32, f32>::Transform_Main_DIT(const T_Data& data)
 {
 	constexpr uint nStageExp = 1 << (STAGE_CURRENT + 1);
 	constexpr uint nStageExp_2 = nStageExp >> 1;
@@ -1222,48 +1866,97 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 
 	if constexpr (STAGE_CURRENT == 0)
 	{
-		//	Loop for each 4 butterflies
-		for (uint n = 0; n < N; n += 8)
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
 		{
-			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-			// Also the input is already pre-shuffled.
-			Calculate4Butterflies_DIT_Stage0(&fOutR[n], &fOutI[n]);
+			//	Loop for each 8 butterflies
+			for (uint n = 0; n < N; n += 16)
+			{
+				Calculate8Butterflies_DIT_Stage0<T_Data>(data.R(n), data.I(n));
+			}
+		}
+		else
+#endif
+		{
+			//	Loop for each 4 butterflies
+			for (uint n = 0; n < N; n += 8)
+			{
+				//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+				// Also the input is already pre-shuffled.
+				Calculate4Butterflies_DIT_Stage0<T_Data>(data.R(n), data.I(n));
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == 1)
 	{
-		//	Specialized SIMD case for stage 1 that requires XYXYZWZW shuffling
-		//	Get the phase angles for the next 2 sub DFT's
-		const f32x4 vUr(1,  0, 1,  0);
-		const f32x4 vUi(0, -1, 0, -1);
-	
-		//	Loop for each 4 butterflies
-		for (uint uButterfly = 0; uButterfly < N; uButterfly += 8)
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
 		{
-			T* pfR = &fOutR[uButterfly];
-			T* pfI = &fOutI[uButterfly];
-	
-			Calculate4Butterflies_DIT_Stage1(vUr, vUi, pfR, pfI);
+			const f32x8 vUr(1,  0, 1,  0, 1,  0, 1,  0);
+			const f32x8 vUi(0, -1, 0, -1, 0, -1, 0, -1);
+
+			//	Loop for each 8 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 16)
+			{
+				Calculate8Butterflies_DIT_Stage1<T_Data>(vUr, vUi, data.R(uButterfly), data.I(uButterfly));
+			}
+		}
+		else
+#endif
+		{
+			//	Specialized SIMD case for stage 1 that requires XYXYZWZW shuffling
+			//	Get the phase angles for the next 2 sub DFT's
+			const f32x4 vUr(1,  0, 1,  0);
+			const f32x4 vUi(0, -1, 0, -1);
+		
+			//	Loop for each 4 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 8)
+			{
+				T* pfR = data.R(uButterfly);
+				T* pfI = data.I(uButterfly);
+		
+				Calculate4Butterflies_DIT_Stage1<T_Data>(vUr, vUi, pfR, pfI);
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == 2)
 	{
-		//	Only 4 wide SIMD for stage 2
-		const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
-		const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
+		{
+			//	Both halves use the same 4 twiddle factors.
+			const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+			const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
 
-		const f32x4 vUr = f32x4::LoadA(twiddlesReal + 0);
-		const f32x4 vUi = f32x4::LoadA(twiddlesImag + 0);
+			const f32x8 vUr = f32x8::Splat(f32x4::LoadA(twiddlesReal + 0));
+			const f32x8 vUi = f32x8::Splat(f32x4::LoadA(twiddlesImag + 0));
 
-		//	Loop for each 4 butterflies
-		for (uint uButterfly = 0; uButterfly < N; uButterfly += nStageExp)
+			//	Loop for each 8 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 16)
+			{
+				Calculate8Butterflies_DIT_Stage2<T_Data>(vUr, vUi, data.R(uButterfly), data.I(uButterfly));
+			}
+		}
+		else
+#endif
 		{
-			const uint uButterflyNext = uButterfly + nStageExp_2;
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
-			CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
+			//	Only 4 wide SIMD for stage 2
+			const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+			const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+
+			const f32x4 vUr = f32x4::LoadA(twiddlesReal + 0);
+			const f32x4 vUi = f32x4::LoadA(twiddlesImag + 0);
+
+			//	Loop for each 4 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += nStageExp)
+			{
+				const uint uButterflyNext = uButterfly + nStageExp_2;
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
+				CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == M - 1)
@@ -1282,10 +1975,10 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 	
 			const uint uButterfly = nSubDFT;
 			const uint uButterflyNext = uButterfly + nStageExp_2;
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
+			T* pfCurR = data.R(uButterfly);
+			T* pfCurI = data.I(uButterfly);
+			T* pfNextR = data.R(uButterflyNext);
+			T* pfNextI = data.I(uButterflyNext);
 			CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 		}
 #else
@@ -1297,10 +1990,10 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 	
 			const uint uButterfly = nSubDFT;
 			const uint uButterflyNext = uButterfly + nStageExp_2;
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
+			T* pfCurR = data.R(uButterfly);
+			T* pfCurI = data.I(uButterfly);
+			T* pfNextR = data.R(uButterflyNext);
+			T* pfNextI = data.I(uButterflyNext);
 			CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 		}
 #endif //FFTL_SIMD_F32x8
@@ -1321,10 +2014,10 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 			for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
 			{
 				const uint uButterflyNext = uButterfly + nStageExp_2;
-				T* pfCurR = &fOutR[uButterfly];
-				T* pfCurI = &fOutI[uButterfly];
-				T* pfNextR = &fOutR[uButterflyNext];
-				T* pfNextI = &fOutI[uButterflyNext];
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
 				CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 			}
 		}
@@ -1339,10 +2032,10 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 			for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
 			{
 				const uint uButterflyNext = uButterfly + nStageExp_2;
-				T* pfCurR = &fOutR[uButterfly];
-				T* pfCurI = &fOutI[uButterfly];
-				T* pfNextR = &fOutR[uButterflyNext];
-				T* pfNextI = &fOutI[uButterflyNext];
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
 				CalculateVButterflies_DIT(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 			}
 		}
@@ -1356,8 +2049,8 @@ void FFT<M, f32, f32>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T,
 }
 
 template <uint M>
-template <uint STAGE_CURRENT>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) // forced inline to eliminate recursion
+template <uint STAGE_CURRENT, typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(const T_Data& data) // forced inline to eliminate recursion
 {
 	constexpr uint nStageExp = 1 << (STAGE_CURRENT + 1);
 	constexpr uint nStageExp_2 = nStageExp >> 1;
@@ -1369,49 +2062,98 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOu
 
 	if constexpr (STAGE_CURRENT == 0)
 	{
-		//	Specialized SIMD case for stage 0.
-		//	Loop for each 4 butterflies
-		for (uint n = 0; n < N; n += 8)
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
 		{
-			//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
-			// Also the input is already pre-shuffled.
-			Calculate4Butterflies_DIF_Stage0(&fOutR[n], &fOutI[n]);
+			//	Loop for each 8 butterflies
+			for (uint n = 0; n < N; n += 16)
+			{
+				Calculate8Butterflies_DIF_Stage0<T_Data>(data.R(n), data.I(n));
+			}
+		}
+		else
+#endif
+		{
+			//	Specialized SIMD case for stage 0.
+			//	Loop for each 4 butterflies
+			for (uint n = 0; n < N; n += 8)
+			{
+				//	Twiddle factor isn't needed here because it's multiplying by 1 (this calculation requires only adding and subtracting)
+				// Also the input is already pre-shuffled.
+				Calculate4Butterflies_DIF_Stage0<T_Data>(data.R(n), data.I(n));
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == 1)
 	{
-		//	Specialized SIMD case for stage 1 that requires XYXYZWZW shuffling
-		//	Get the phase angles for the next 2 sub DFT's
-		const f32x4 vUr(1, 0, 1, 0);
-		const f32x4 vUi(0, -1, 0, -1);
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
+		{
+			const f32x8 vUr(1,  0, 1,  0, 1,  0, 1,  0);
+			const f32x8 vUi(0, -1, 0, -1, 0, -1, 0, -1);
 
-		//	Loop for each 4 butterflies
-		for (uint uButterfly = 0; uButterfly < N; uButterfly += 8)
+			//	Loop for each 8 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 16)
+			{
+				Calculate8Butterflies_DIF_Stage1<T_Data>(vUr, vUi, data.R(uButterfly), data.I(uButterfly));
+			}
+		}
+		else
+#endif
 		{
-			T* pfR = &fOutR[uButterfly];
-			T* pfI = &fOutI[uButterfly];
-	
-			Calculate4Butterflies_DIF_Stage1(vUr, vUi, pfR, pfI);
+			//	Specialized SIMD case for stage 1 that requires XYXYZWZW shuffling
+			//	Get the phase angles for the next 2 sub DFT's
+			const f32x4 vUr(1, 0, 1, 0);
+			const f32x4 vUi(0, -1, 0, -1);
+
+			//	Loop for each 4 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 8)
+			{
+				T* pfR = data.R(uButterfly);
+				T* pfI = data.I(uButterfly);
+		
+				Calculate4Butterflies_DIF_Stage1<T_Data>(vUr, vUi, pfR, pfI);
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == 2)
 	{
-		//	Stage 2 easier to just use 4 wide.
-		const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
-		const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+#if FFTL_SIMD_F32x8
+		if constexpr (USE_8WIDE_STAGE012)
+		{
+			//	Both halves use the same 4 twiddle factors.
+			const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+			const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
 
-		const f32x4 vUr = f32x4::LoadA(twiddlesReal + 0);
-		const f32x4 vUi = f32x4::LoadA(twiddlesImag + 0);
+			const f32x8 vUr = f32x8::Splat(f32x4::LoadA(twiddlesReal + 0));
+			const f32x8 vUi = f32x8::Splat(f32x4::LoadA(twiddlesImag + 0));
 
-		//	Loop for each 4 butterflies
-		for (uint uButterfly = 0; uButterfly < N; uButterfly += nStageExp)
+			//	Loop for each 8 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += 16)
+			{
+				Calculate8Butterflies_DIF_Stage2<T_Data>(vUr, vUi, data.R(uButterfly), data.I(uButterfly));
+			}
+		}
+		else
+#endif
 		{
-			const uint uButterflyNext = uButterfly + nStageExp_2;
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
-			CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
+			//	Stage 2 easier to just use 4 wide.
+			const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+			const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+
+			const f32x4 vUr = f32x4::LoadA(twiddlesReal + 0);
+			const f32x4 vUi = f32x4::LoadA(twiddlesImag + 0);
+
+			//	Loop for each 4 butterflies
+			for (uint uButterfly = 0; uButterfly < N; uButterfly += nStageExp)
+			{
+				const uint uButterflyNext = uButterfly + nStageExp_2;
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
+				CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
+			}
 		}
 	}
 	else if constexpr (STAGE_CURRENT == M - 1)
@@ -1432,10 +2174,10 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOu
 			const uint uButterfly = nSubDFT;
 			const uint uButterflyNext = uButterfly + nStageExp_2;
 	
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
+			T* pfCurR = data.R(uButterfly);
+			T* pfCurI = data.I(uButterfly);
+			T* pfNextR = data.R(uButterflyNext);
+			T* pfNextI = data.I(uButterflyNext);
 			CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 		}
 #else
@@ -1448,10 +2190,10 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOu
 			const uint uButterfly = nSubDFT;
 			const uint uButterflyNext = uButterfly + nStageExp_2;
 	
-			T* pfCurR = &fOutR[uButterfly];
-			T* pfCurI = &fOutI[uButterfly];
-			T* pfNextR = &fOutR[uButterflyNext];
-			T* pfNextI = &fOutI[uButterflyNext];
+			T* pfCurR = data.R(uButterfly);
+			T* pfCurI = data.I(uButterfly);
+			T* pfNextR = data.R(uButterflyNext);
+			T* pfNextI = data.I(uButterflyNext);
 			CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 		}
 #endif //FFTL_SIMD_F32x8
@@ -1474,10 +2216,10 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOu
 			for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
 			{
 				const uint uButterflyNext = uButterfly + nStageExp_2;
-				T* pfCurR = &fOutR[uButterfly];
-				T* pfCurI = &fOutI[uButterfly];
-				T* pfNextR = &fOutR[uButterflyNext];
-				T* pfNextI = &fOutI[uButterflyNext];
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
 				CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
 			}
 		}
@@ -1485,259 +2227,1424 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF(FixedArray<T, N>& fOu
 		//	Loop for each sub DFT
 		for (int nSubDFT = nStageExp_2 - 4; nSubDFT >= 0; nSubDFT -= 4)
 		{
-			const f32x4 vUr = f32x4::LoadA(twiddlesReal + nSubDFT);
-			const f32x4 vUi = f32x4::LoadA(twiddlesImag + nSubDFT);
-	
-			//	Loop for each 4 butterflies
-			for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
-			{
-				const uint uButterflyNext = uButterfly + nStageExp_2;
-				T* pfCurR = &fOutR[uButterfly];
-				T* pfCurI = &fOutI[uButterfly];
-				T* pfNextR = &fOutR[uButterflyNext];
-				T* pfNextI = &fOutI[uButterflyNext];
-				CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
-			}
+			const f32x4 vUr = f32x4::LoadA(twiddlesReal + nSubDFT);
+			const f32x4 vUi = f32x4::LoadA(twiddlesImag + nSubDFT);
+	
+			//	Loop for each 4 butterflies
+			for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+			{
+				const uint uButterflyNext = uButterfly + nStageExp_2;
+				T* pfCurR = data.R(uButterfly);
+				T* pfCurI = data.I(uButterfly);
+				T* pfNextR = data.R(uButterflyNext);
+				T* pfNextI = data.I(uButterflyNext);
+				CalculateVButterflies_DIF(vUr, vUi, pfCurR, pfCurI, pfNextR, pfNextI);
+			}
+		}
+#endif //FFTL_SIMD_F32x8
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+template <uint STAGE_CURRENT, typename T_Data>
+void FFT<M, f32, f32>::Transform_Main_DIT_Radix4(const T_Data& data)
+{
+	static_assert(STAGE_CURRENT >= 3 && STAGE_CURRENT + 1 < M, "Radix 4 passes need at least 8 contiguous butterflies per leg");
+
+	constexpr uint nStageExp_4 = 1 << STAGE_CURRENT;
+	constexpr uint nStageExp = nStageExp_4 << 2;
+
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	//	Twiddles for the 1st of the 2 combined stages, and for the 2nd. The 3rd leg needs their product.
+	const auto& twiddles1Real = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddles1Imag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+	const auto& twiddles2Real = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxR();
+	const auto& twiddles2Imag = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxI();
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+	constexpr uint nWidth = sizeof(V) / sizeof(T);
+
+	//	Loop for each sub DFT
+	for (uint nSubDFT = 0; nSubDFT < nStageExp_4; nSubDFT += nWidth)
+	{
+		const V vU1r = V::LoadA(twiddles1Real + nSubDFT);
+		const V vU1i = V::LoadA(twiddles1Imag + nSubDFT);
+		const V vU2r = V::LoadA(twiddles2Real + nSubDFT);
+		const V vU2i = V::LoadA(twiddles2Imag + nSubDFT);
+		const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+		const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+		//	Loop for each 4 legs of butterflies
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			CalculateVButterflies_DIT_Radix4<nStageExp_4, T_Data>(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, data.R(uButterfly), data.I(uButterfly));
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+template <uint STAGE_CURRENT, typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Main_DIF_Radix4(const T_Data& data) // forced inline to eliminate recursion
+{
+	static_assert(STAGE_CURRENT >= 3 && STAGE_CURRENT + 1 < M, "Radix 4 passes need at least 8 contiguous butterflies per leg");
+
+	constexpr uint nStageExp_4 = 1 << STAGE_CURRENT;
+	constexpr uint nStageExp = nStageExp_4 << 2;
+
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	const auto& twiddles1Real = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddles1Imag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+	const auto& twiddles2Real = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxR();
+	const auto& twiddles2Imag = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxI();
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+	constexpr uint nWidth = sizeof(V) / sizeof(T);
+
+	//	Loop for each sub DFT
+	for (int nSubDFT = nStageExp_4 - nWidth; nSubDFT >= 0; nSubDFT -= nWidth)
+	{
+		const V vU1r = V::LoadA(twiddles1Real + nSubDFT);
+		const V vU1i = V::LoadA(twiddles1Imag + nSubDFT);
+		const V vU2r = V::LoadA(twiddles2Real + nSubDFT);
+		const V vU2i = V::LoadA(twiddles2Imag + nSubDFT);
+		const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+		const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+		//	Loop for each 4 legs of butterflies
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			CalculateVButterflies_DIF_Radix4<nStageExp_4, T_Data>(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, data.R(uButterfly), data.I(uButterfly));
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f32, f32>::ApplyBitReverseAndInterleave(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N * 2>& fOut)
+{
+	//	Restore the time domain real output as interleaved real and complex. We need to apply bit reversal here as well.
+	for (uint n = 0; n < N; n += 4)
+	{
+		const uint nR0 = GetBitReverseIndex(n + 0);
+		const uint nR1 = GetBitReverseIndex(n + 1);
+		const uint nR2 = GetBitReverseIndex(n + 2);
+		const uint nR3 = GetBitReverseIndex(n + 3);
+
+		//	Interleave the output while bit reversing.
+		T* pSh = fOut + n * 2;
+
+		const T fSh0 = fInR[nR0];
+		const T fSh1 = fInI[nR0];
+		const T fSh2 = fInR[nR1];
+		const T fSh3 = fInI[nR1];
+		const T fSh4 = fInR[nR2];
+		const T fSh5 = fInI[nR2];
+		const T fSh6 = fInR[nR3];
+		const T fSh7 = fInI[nR3];
+
+#if 1
+		const f32x4 vSh0_3(fSh0, fSh1, fSh2, fSh3);
+		const f32x4 vSh4_7(fSh4, fSh5, fSh6, fSh7);
+
+		vSh0_3.StoreA(pSh + 0);
+		vSh4_7.StoreA(pSh + 4);
+#else
+		pSh[0] = fSh0;
+		pSh[1] = fSh1;
+		pSh[2] = fSh2;
+		pSh[3] = fSh3;
+		pSh[4] = fSh4;
+		pSh[5] = fSh5;
+		pSh[6] = fSh6;
+		pSh[7] = fSh7;
+#endif
+	}
+}
+
+template <uint M>
+template <bool SWAP>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Stage0_DIT_Split(T* pf)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	const BlockedData data{ pf };
+
+	//	Each interleaved load gives 1 block of real and imaginary parts in the normal order, which is all the stage 0 kernels
+	// need to shuffle themselves. The loads cover the same memory as the stores, so nothing is overwritten before it's read.
+#if FFTL_SIMD_F32x8
+	//	Loop for each 8 butterflies
+	for (uint n = 0; n < N; n += 16)
+	{
+		f32x8 v0r, v0i, v1r, v1i;
+		LoadInterleaved(pf + 2 * n + 0, SWAP ? v0i : v0r, SWAP ? v0r : v0i);
+		LoadInterleaved(pf + 2 * n + 16, SWAP ? v1i : v1r, SWAP ? v1r : v1i);
+		Calculate8Butterflies_DIT_Stage0_InOrder<BlockedData>(v0r, v1r, v0i, v1i, data.R(n), data.I(n));
+	}
+#else
+	//	Loop for each 4 butterflies
+	for (uint n = 0; n < N; n += 8)
+	{
+		f32x4 v0r, v0i, v1r, v1i;
+		LoadInterleaved(pf + 2 * n + 0, SWAP ? v0i : v0r, SWAP ? v0r : v0i);
+		LoadInterleaved(pf + 2 * n + 8, SWAP ? v1i : v1r, SWAP ? v1r : v1i);
+		Calculate4Butterflies_DIT_Stage0_InOrder<BlockedData>(v0r, v1r, v0i, v1i, data.R(n), data.I(n));
+	}
+#endif
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[0] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Stage0_DIF_Merge(T* pf)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	const BlockedData data{ pf };
+
+#if FFTL_SIMD_F32x8
+	//	Loop for each 8 butterflies
+	for (uint n = 0; n < N; n += 16)
+	{
+		f32x8 v0r = f32x8::LoadA(data.R(n + 0));
+		f32x8 v0i = f32x8::LoadA(data.I(n + 0));
+		f32x8 v1r = f32x8::LoadA(data.R(n + 8));
+		f32x8 v1i = f32x8::LoadA(data.I(n + 8));
+		Calculate8Butterflies_DIF_Stage0(v0r, v1r, v0i, v1i);
+		StoreInterleaved(pf + 2 * n + 0, v0r, v0i);
+		StoreInterleaved(pf + 2 * n + 16, v1r, v1i);
+	}
+#else
+	//	Loop for each 4 butterflies
+	for (uint n = 0; n < N; n += 8)
+	{
+		f32x4 v0r = f32x4::LoadA(data.R(n + 0));
+		f32x4 v0i = f32x4::LoadA(data.I(n + 0));
+		f32x4 v1r = f32x4::LoadA(data.R(n + 4));
+		f32x4 v1i = f32x4::LoadA(data.I(n + 4));
+		Calculate4Butterflies_DIF_Stage0(v0r, v1r, v0i, v1i);
+		StoreInterleaved(pf + 2 * n + 0, v0r, v0i);
+		StoreInterleaved(pf + 2 * n + 8, v1r, v1i);
+	}
+#endif
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[0] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+template <bool SWAP>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Outer_DIT_Merge(T* pf)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+
+	const BlockedData data{ pf };
+
+	//	Every leg is a whole block, so each one can be interleaved back over the memory it was loaded from.
+	if constexpr (USE_RADIX4)
+	{
+		constexpr uint nStride = N / 4;
+
+		const auto& twiddles1Real = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxR();
+		const auto& twiddles1Imag = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxI();
+		const auto& twiddles2Real = FFT_Twiddles<OUTER_STAGE_BEGIN + 1, T_Twiddle>::GetCplxR();
+		const auto& twiddles2Imag = FFT_Twiddles<OUTER_STAGE_BEGIN + 1, T_Twiddle>::GetCplxI();
+
+		for (uint n = 0; n < nStride; n += BLOCK)
+		{
+			const V vU1r = V::LoadA(twiddles1Real + n);
+			const V vU1i = V::LoadA(twiddles1Imag + n);
+			const V vU2r = V::LoadA(twiddles2Real + n);
+			const V vU2i = V::LoadA(twiddles2Imag + n);
+			const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+			const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+			V vR[4] = { V::LoadA(data.R(n + 0 * nStride)), V::LoadA(data.R(n + 1 * nStride)), V::LoadA(data.R(n + 2 * nStride)), V::LoadA(data.R(n + 3 * nStride)) };
+			V vI[4] = { V::LoadA(data.I(n + 0 * nStride)), V::LoadA(data.I(n + 1 * nStride)), V::LoadA(data.I(n + 2 * nStride)), V::LoadA(data.I(n + 3 * nStride)) };
+
+			CalculateVButterflies_DIT_Radix4(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, vR, vI);
+
+			StoreInterleaved(pf + 2 * (n + 0 * nStride), SWAP ? vI[0] : vR[0], SWAP ? vR[0] : vI[0]);
+			StoreInterleaved(pf + 2 * (n + 1 * nStride), SWAP ? vI[1] : vR[1], SWAP ? vR[1] : vI[1]);
+			StoreInterleaved(pf + 2 * (n + 2 * nStride), SWAP ? vI[2] : vR[2], SWAP ? vR[2] : vI[2]);
+			StoreInterleaved(pf + 2 * (n + 3 * nStride), SWAP ? vI[3] : vR[3], SWAP ? vR[3] : vI[3]);
+		}
+	}
+	else
+	{
+		constexpr uint nStride = N / 2;
+
+		const auto& twiddlesReal = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxR();
+		const auto& twiddlesImag = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxI();
+
+		for (uint n = 0; n < nStride; n += BLOCK)
+		{
+			const V vUr = V::LoadA(twiddlesReal + n);
+			const V vUi = V::LoadA(twiddlesImag + n);
+
+			V vCurR = V::LoadA(data.R(n));
+			V vCurI = V::LoadA(data.I(n));
+			V vNextR = V::LoadA(data.R(n + nStride));
+			V vNextI = V::LoadA(data.I(n + nStride));
+
+			CalculateVButterflies_DIT(vUr, vUi, vCurR, vCurI, vNextR, vNextI);
+
+			StoreInterleaved(pf + 2 * n, SWAP ? vCurI : vCurR, SWAP ? vCurR : vCurI);
+			StoreInterleaved(pf + 2 * (n + nStride), SWAP ? vNextI : vNextR, SWAP ? vNextR : vNextI);
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[OUTER_STAGE_BEGIN] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Transform_Outer_DIF_Split(T* pf)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+
+	const BlockedData data{ pf };
+
+	//	Every leg is a whole block, so each one can be split over the memory it was loaded from.
+	if constexpr (USE_RADIX4)
+	{
+		constexpr uint nStride = N / 4;
+
+		const auto& twiddles1Real = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxR();
+		const auto& twiddles1Imag = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxI();
+		const auto& twiddles2Real = FFT_Twiddles<OUTER_STAGE_BEGIN + 1, T_Twiddle>::GetCplxR();
+		const auto& twiddles2Imag = FFT_Twiddles<OUTER_STAGE_BEGIN + 1, T_Twiddle>::GetCplxI();
+
+		for (uint n = 0; n < nStride; n += BLOCK)
+		{
+			const V vU1r = V::LoadA(twiddles1Real + n);
+			const V vU1i = V::LoadA(twiddles1Imag + n);
+			const V vU2r = V::LoadA(twiddles2Real + n);
+			const V vU2i = V::LoadA(twiddles2Imag + n);
+			const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+			const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+			V vR[4], vI[4];
+			LoadInterleaved(pf + 2 * (n + 0 * nStride), vR[0], vI[0]);
+			LoadInterleaved(pf + 2 * (n + 1 * nStride), vR[1], vI[1]);
+			LoadInterleaved(pf + 2 * (n + 2 * nStride), vR[2], vI[2]);
+			LoadInterleaved(pf + 2 * (n + 3 * nStride), vR[3], vI[3]);
+
+			CalculateVButterflies_DIF_Radix4(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, vR, vI);
+
+			StoreA(data.R(n + 0 * nStride), vR[0]);
+			StoreA(data.I(n + 0 * nStride), vI[0]);
+			StoreA(data.R(n + 1 * nStride), vR[1]);
+			StoreA(data.I(n + 1 * nStride), vI[1]);
+			StoreA(data.R(n + 2 * nStride), vR[2]);
+			StoreA(data.I(n + 2 * nStride), vI[2]);
+			StoreA(data.R(n + 3 * nStride), vR[3]);
+			StoreA(data.I(n + 3 * nStride), vI[3]);
+		}
+	}
+	else
+	{
+		constexpr uint nStride = N / 2;
+
+		const auto& twiddlesReal = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxR();
+		const auto& twiddlesImag = FFT_Twiddles<OUTER_STAGE_BEGIN, T_Twiddle>::GetCplxI();
+
+		for (uint n = 0; n < nStride; n += BLOCK)
+		{
+			const V vUr = V::LoadA(twiddlesReal + n);
+			const V vUi = V::LoadA(twiddlesImag + n);
+
+			V vCurR, vCurI, vNextR, vNextI;
+			LoadInterleaved(pf + 2 * n, vCurR, vCurI);
+			LoadInterleaved(pf + 2 * (n + nStride), vNextR, vNextI);
+
+			CalculateVButterflies_DIF(vUr, vUi, vCurR, vCurI, vNextR, vNextI);
+
+			StoreA(data.R(n), vCurR);
+			StoreA(data.I(n), vCurI);
+			StoreA(data.R(n + nStride), vNextR);
+			StoreA(data.I(n + nStride), vNextI);
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[OUTER_STAGE_BEGIN] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::LoadInterleaved(const T* pf, f32x4& vR, f32x4& vI)
+{
+	//	ririri is split into rrrr and iiii.
+	const f32x4 vIn0 = f32x4::LoadA(pf + 0);
+	const f32x4 vIn1 = f32x4::LoadA(pf + 4);
+	vR = SplitXZ(vIn0, vIn1);
+	vI = SplitYW(vIn0, vIn1);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::StoreInterleaved(T* pf, f32x4_In vR, f32x4_In vI)
+{
+	StoreA(pf + 0, MergeXY(vR, vI));
+	StoreA(pf + 4, MergeZW(vR, vI));
+}
+
+#if FFTL_SIMD_F32x8
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::LoadInterleaved(const T* pf, f32x8& vR, f32x8& vI)
+{
+	//	Gather complex numbers 0145 and 2367, after which the even and odd lanes of each half are in the normal order.
+	const f32x8 vIn0 = f32x8::LoadA(pf + 0);
+	const f32x8 vIn1 = f32x8::LoadA(pf + 8);
+	const f32x8 v0145 = Permute128<0, 2>(vIn0, vIn1);
+	const f32x8 v2367 = Permute128<1, 3>(vIn0, vIn1);
+	vR = Permute<0, 2, 4, 6>(v0145, v2367);
+	vI = Permute<1, 3, 5, 7>(v0145, v2367);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::StoreInterleaved(T* pf, f32x8_In vR, f32x8_In vI)
+{
+	//	The reverse of LoadInterleaved
+	const f32x8 v0145 = Permute<0, 4, 1, 5>(vR, vI);
+	const f32x8 v2367 = Permute<2, 6, 3, 7>(vR, vI);
+	StoreA(pf + 0, Permute128<0, 2>(v0145, v2367));
+	StoreA(pf + 8, Permute128<1, 3>(v0145, v2367));
+}
+#endif // FFTL_SIMD_F32x8
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage1(f32x4_In vUr, f32x4_In vUi, T* pfR, T* pfI)
+{
+	//	No need to shuffle the input because we've already pre-shuffled
+	const f32x4 vCurR = f32x4::LoadA(pfR + 0);
+	const f32x4 vNextR = f32x4::LoadA(pfR + T_Data::Offset(4));
+
+	const f32x4 vCurI = f32x4::LoadA(pfI + 0);
+	const f32x4 vNextI = f32x4::LoadA(pfI + T_Data::Offset(4));
+
+	const f32x4 Wr = SubMul(vNextR * vUr, vNextI, vUi);
+	const f32x4 Wi = AddMul(vNextR * vUi, vNextI, vUr);
+
+	const f32x4 vNewCurR = (vCurR + Wr);
+	const f32x4 vNewCurI = (vCurI + Wi);
+	const f32x4 vNewNextR = (vCurR - Wr);
+	const f32x4 vNewNextI = (vCurI - Wi);
+
+	//	Now shuffle them for the subsequent stages, and store
+	const f32x4 vCCNNr0 = Permute<0, 1, 4, 5>(vNewCurR, vNewNextR);
+	StoreA(pfR + 0, vCCNNr0);
+	const f32x4 vCCNNr1 = Permute<2, 3, 6, 7>(vNewCurR, vNewNextR);
+	StoreA(pfR + T_Data::Offset(4), vCCNNr1);
+
+	const f32x4 vCCNNi0 = Permute<0, 1, 4, 5>(vNewCurI, vNewNextI);
+	StoreA(pfI + 0, vCCNNi0);
+	const f32x4 vCCNNi1 = Permute<2, 3, 6, 7>(vNewCurI, vNewNextI);
+	StoreA(pfI + T_Data::Offset(4), vCCNNi1);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIF_Stage1(f32x4_In vUr, f32x4_In vUi, T* pfR, T* pfI)
+{
+	//	For DIF processing, we're running backwards, so there was no pre-shuffling in stage 2.
+
+	const f32x4 vCCNN0r = f32x4::LoadA(pfR + 0);
+	const f32x4 vCCNN1r = f32x4::LoadA(pfR + T_Data::Offset(4));
+
+	const f32x4 vCCNN0i = f32x4::LoadA(pfI + 0);
+	const f32x4 vCCNN1i = f32x4::LoadA(pfI + T_Data::Offset(4));
+
+	const f32x4 vCurrR = Permute<0, 1, 4, 5>(vCCNN0r, vCCNN1r);
+	const f32x4 vNextR = Permute<2, 3, 6, 7>(vCCNN0r, vCCNN1r);
+
+	const f32x4 vCurrI = Permute<0, 1, 4, 5>(vCCNN0i, vCCNN1i);
+	const f32x4 vNextI = Permute<2, 3, 6, 7>(vCCNN0i, vCCNN1i);
+
+	const f32x4 Wr = vCurrR - vNextR;
+	const f32x4 Wi = vCurrI - vNextI;
+
+	const f32x4 vNewCurR = vCurrR + vNextR;
+	const f32x4 vNewCurI = vCurrI + vNextI;
+	const f32x4 vNewNextR = SubMul(Wr * vUr, Wi, vUi);
+	const f32x4 vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+
+	//	Don't pre-shuffle for stage 0. Stage 0 will self-correct.
+	StoreA(pfR + 0, vNewCurR);
+	StoreA(pfR + T_Data::Offset(4), vNewNextR);
+	StoreA(pfI + 0, vNewCurI);
+	StoreA(pfI + T_Data::Offset(4), vNewNextI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage0(T* pfR, T* pfI)
+{
+	const f32x4 vCNCN0r = f32x4::LoadA(pfR + 0);
+	const f32x4 vCNCN1r = f32x4::LoadA(pfR + T_Data::Offset(4));
+
+	const f32x4 vCNCN0i = f32x4::LoadA(pfI + 0);
+	const f32x4 vCNCN1i = f32x4::LoadA(pfI + T_Data::Offset(4));
+
+	Calculate4Butterflies_DIT_Stage0_InOrder<T_Data>(vCNCN0r, vCNCN1r, vCNCN0i, vCNCN1i, pfR, pfI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage0_InOrder(f32x4_In vCNCN0r, f32x4_In vCNCN1r, f32x4_In vCNCN0i, f32x4_In vCNCN1i, T* pfR, T* pfI)
+{
+	//	Shuffle the input around for the first stage so we can properly process 4 at a time.
+	const f32x4 vCurrR = Permute<0, 2, 4, 6>(vCNCN0r, vCNCN1r);
+	const f32x4 vNextR = Permute<1, 3, 5, 7>(vCNCN0r, vCNCN1r);
+
+	const f32x4 vCurrI = Permute<0, 2, 4, 6>(vCNCN0i, vCNCN1i);
+	const f32x4 vNextI = Permute<1, 3, 5, 7>(vCNCN0i, vCNCN1i);
+
+	Calculate4Butterflies_DIT_Stage0<T_Data>(vCurrR, vNextR, vCurrI, vNextI, pfR, pfI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIF_Stage0(T* pfR, T* pfI)
+{
+	f32x4 v0r = f32x4::LoadA(pfR + 0);
+	f32x4 v1r = f32x4::LoadA(pfR + T_Data::Offset(4));
+
+	f32x4 v0i = f32x4::LoadA(pfI + 0);
+	f32x4 v1i = f32x4::LoadA(pfI + T_Data::Offset(4));
+
+	Calculate4Butterflies_DIF_Stage0(v0r, v1r, v0i, v1i);
+
+	StoreA(pfR + 0, v0r);
+	StoreA(pfR + T_Data::Offset(4), v1r);
+	StoreA(pfI + 0, v0i);
+	StoreA(pfI + T_Data::Offset(4), v1i);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIF_Stage0(f32x4& vs1_0r, f32x4& vs1_1r, f32x4& vs1_0i, f32x4& vs1_1i)
+{
+	//	For DIF processing, we're running backwards, so stage 1 has processed before us, and we need to correct for its order.
+	const f32x4 vCurrR = Permute<0, 4, 2, 6>(vs1_0r, vs1_1r);
+	const f32x4 vNextR = Permute<1, 5, 3, 7>(vs1_0r, vs1_1r);
+
+	const f32x4 vCurrI = Permute<0, 4, 2, 6>(vs1_0i, vs1_1i);
+	const f32x4 vNextI = Permute<1, 5, 3, 7>(vs1_0i, vs1_1i);
+
+	const f32x4 vNewCurR = vCurrR + vNextR;
+	const f32x4 vNewCurI = vCurrI + vNextI;
+	const f32x4 vNewNextR = vCurrR - vNextR;
+	const f32x4 vNewNextI = vCurrI - vNextI;
+
+	//	Now post shuffle them back to the normal (final) order.
+	vs1_0r = Permute<0, 4, 1, 5>(vNewCurR, vNewNextR);
+	vs1_1r = Permute<2, 6, 3, 7>(vNewCurR, vNewNextR);
+	vs1_0i = Permute<0, 4, 1, 5>(vNewCurI, vNewNextI);
+	vs1_1i = Permute<2, 6, 3, 7>(vNewCurI, vNewNextI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage0(f32x4_In vCurR, f32x4_In vNextR, f32x4_In vCurI, f32x4_In vNextI, T* pfR, T* pfI)
+{
+	//	No need to shuffle the input because we've already pre-shuffled
+	const f32x4 vNewCurR = vCurR + vNextR;
+	const f32x4 vNewCurI = vCurI + vNextI;
+	const f32x4 vNewNextR = vCurR - vNextR;
+	const f32x4 vNewNextI = vCurI - vNextI;
+
+	//	Now shuffle them so that stage 1 doesn't have to pre-shuffle on input, and store
+	const f32x4 vCCNNr0 = Permute<0, 4, 2, 6>(vNewCurR, vNewNextR);
+	const f32x4 vCCNNr1 = Permute<1, 5, 3, 7>(vNewCurR, vNewNextR);
+	const f32x4 vCCNNi0 = Permute<0, 4, 2, 6>(vNewCurI, vNewNextI);
+	const f32x4 vCCNNi1 = Permute<1, 5, 3, 7>(vNewCurI, vNewNextI);
+
+	StoreA(pfR + 0, vCCNNr0);
+	StoreA(pfR + T_Data::Offset(4), vCCNNr1);
+	StoreA(pfI + 0, vCCNNi0);
+	StoreA(pfI + T_Data::Offset(4), vCCNNi1);
+}
+
+#if FFTL_SIMD_F32x8
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIT_Stage0(f32x8_In vCurR, f32x8_In vNextR, f32x8_In vCurI, f32x8_In vNextI, T* pfR, T* pfI)
+{
+	//	Input halves are pre-shuffled to 0,4,2,6 and 1,5,3,7 order.
+	const f32x8 vNewCurR = vCurR + vNextR;
+	const f32x8 vNewCurI = vCurI + vNextI;
+	const f32x8 vNewNextR = vCurR - vNextR;
+	const f32x8 vNewNextI = vCurI - vNextI;
+
+	//	Interleave them into the same per half order as Calculate4Butterflies_DIT_Stage0, and store
+	StoreA(pfR + 0, Permute<0, 4, 1, 5>(vNewCurR, vNewNextR));
+	StoreA(pfR + T_Data::Offset(8), Permute<2, 6, 3, 7>(vNewCurR, vNewNextR));
+	StoreA(pfI + 0, Permute<0, 4, 1, 5>(vNewCurI, vNewNextI));
+	StoreA(pfI + T_Data::Offset(8), Permute<2, 6, 3, 7>(vNewCurI, vNewNextI));
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIT_Stage0(T* pfR, T* pfI)
+{
+	const f32x8 v0r = f32x8::LoadA(pfR + 0);
+	const f32x8 v1r = f32x8::LoadA(pfR + T_Data::Offset(8));
+	const f32x8 v0i = f32x8::LoadA(pfI + 0);
+	const f32x8 v1i = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	Calculate8Butterflies_DIT_Stage0_InOrder<T_Data>(v0r, v1r, v0i, v1i, pfR, pfI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIT_Stage0_InOrder(f32x8_In v0r, f32x8_In v1r, f32x8_In v0i, f32x8_In v1i, T* pfR, T* pfI)
+{
+	//	Shuffle the input around for the first stage so we can properly process 8 at a time.
+
+	//	0123 89AB and 4567 CDEF
+	const f32x8 vLoR = Permute128<0, 2>(v0r, v1r);
+	const f32x8 vHiR = Permute128<1, 3>(v0r, v1r);
+	const f32x8 vLoI = Permute128<0, 2>(v0i, v1i);
+	const f32x8 vHiI = Permute128<1, 3>(v0i, v1i);
+
+	//	0415 2637 per half
+	const f32x8 v0415R = Permute<0, 4, 1, 5>(vLoR, vHiR);
+	const f32x8 v2637R = Permute<2, 6, 3, 7>(vLoR, vHiR);
+	const f32x8 v0415I = Permute<0, 4, 1, 5>(vLoI, vHiI);
+	const f32x8 v2637I = Permute<2, 6, 3, 7>(vLoI, vHiI);
+
+	//	0426 and 1537 per half
+	const f32x8 vCurR = Permute<0, 1, 4, 5>(v0415R, v2637R);
+	const f32x8 vNextR = Permute<2, 3, 6, 7>(v0415R, v2637R);
+	const f32x8 vCurI = Permute<0, 1, 4, 5>(v0415I, v2637I);
+	const f32x8 vNextI = Permute<2, 3, 6, 7>(v0415I, v2637I);
+
+	Calculate8Butterflies_DIT_Stage0<T_Data>(vCurR, vNextR, vCurI, vNextI, pfR, pfI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIF_Stage0(T* pfR, T* pfI)
+{
+	f32x8 v0r = f32x8::LoadA(pfR + 0);
+	f32x8 v1r = f32x8::LoadA(pfR + T_Data::Offset(8));
+	f32x8 v0i = f32x8::LoadA(pfI + 0);
+	f32x8 v1i = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	Calculate8Butterflies_DIF_Stage0(v0r, v1r, v0i, v1i);
+
+	StoreA(pfR + 0, v0r);
+	StoreA(pfR + T_Data::Offset(8), v1r);
+	StoreA(pfI + 0, v0i);
+	StoreA(pfI + T_Data::Offset(8), v1i);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIF_Stage0(f32x8& vs1_0r, f32x8& vs1_1r, f32x8& vs1_0i, f32x8& vs1_1i)
+{
+	//	For DIF processing, we're running backwards, so stage 1 has processed before us, and we need to correct for its order.
+	// Stage 1 left each half in 0145 2367 order, so this gives 0426 and 1537.
+	const f32x8 vCurrR = Permute<0, 2, 4, 6>(vs1_0r, vs1_1r);
+	const f32x8 vNextR = Permute<1, 3, 5, 7>(vs1_0r, vs1_1r);
+	const f32x8 vCurrI = Permute<0, 2, 4, 6>(vs1_0i, vs1_1i);
+	const f32x8 vNextI = Permute<1, 3, 5, 7>(vs1_0i, vs1_1i);
+
+	const f32x8 vNewCurR = vCurrR + vNextR;
+	const f32x8 vNewCurI = vCurrI + vNextI;
+	const f32x8 vNewNextR = vCurrR - vNextR;
+	const f32x8 vNewNextI = vCurrI - vNextI;
+
+	//	0145 and 2367 per half
+	const f32x8 v0145R = Permute<0, 4, 1, 5>(vNewCurR, vNewNextR);
+	const f32x8 v2367R = Permute<2, 6, 3, 7>(vNewCurR, vNewNextR);
+	const f32x8 v0145I = Permute<0, 4, 1, 5>(vNewCurI, vNewNextI);
+	const f32x8 v2367I = Permute<2, 6, 3, 7>(vNewCurI, vNewNextI);
+
+	//	0123 and 4567 per half
+	const f32x8 v0123R = Permute<0, 1, 4, 5>(v0145R, v2367R);
+	const f32x8 v4567R = Permute<2, 3, 6, 7>(v0145R, v2367R);
+	const f32x8 v0123I = Permute<0, 1, 4, 5>(v0145I, v2367I);
+	const f32x8 v4567I = Permute<2, 3, 6, 7>(v0145I, v2367I);
+
+	//	Now post shuffle them back to the normal (final) order.
+	vs1_0r = Permute128<0, 2>(v0123R, v4567R);
+	vs1_1r = Permute128<1, 3>(v0123R, v4567R);
+	vs1_0i = Permute128<0, 2>(v0123I, v4567I);
+	vs1_1i = Permute128<1, 3>(v0123I, v4567I);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIT_Stage1(f32x8_In vUr, f32x8_In vUi, T* pfR, T* pfI)
+{
+	//	No need to shuffle the input because stage 0 has already pre-shuffled
+	const f32x8 vCurR = f32x8::LoadA(pfR + 0);
+	const f32x8 vNextR = f32x8::LoadA(pfR + T_Data::Offset(8));
+	const f32x8 vCurI = f32x8::LoadA(pfI + 0);
+	const f32x8 vNextI = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	const f32x8 Wr = SubMul(vNextR * vUr, vNextI, vUi);
+	const f32x8 Wi = AddMul(vNextR * vUi, vNextI, vUr);
+
+	const f32x8 vNewCurR = vCurR + Wr;
+	const f32x8 vNewCurI = vCurI + Wi;
+	const f32x8 vNewNextR = vCurR - Wr;
+	const f32x8 vNewNextI = vCurI - Wi;
+
+	//	Shuffle each half to 0123 and 4567, which is the order stage 2 wants, and store
+	StoreA(pfR + 0, Permute<0, 1, 4, 5>(vNewCurR, vNewNextR));
+	StoreA(pfR + T_Data::Offset(8), Permute<2, 3, 6, 7>(vNewCurR, vNewNextR));
+	StoreA(pfI + 0, Permute<0, 1, 4, 5>(vNewCurI, vNewNextI));
+	StoreA(pfI + T_Data::Offset(8), Permute<2, 3, 6, 7>(vNewCurI, vNewNextI));
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIF_Stage1(f32x8_In vUr, f32x8_In vUi, T* pfR, T* pfI)
+{
+	//	Stage 2 left each half in 0123 and 4567 order.
+	const f32x8 vCCNN0r = f32x8::LoadA(pfR + 0);
+	const f32x8 vCCNN1r = f32x8::LoadA(pfR + T_Data::Offset(8));
+	const f32x8 vCCNN0i = f32x8::LoadA(pfI + 0);
+	const f32x8 vCCNN1i = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	const f32x8 vCurrR = Permute<0, 1, 4, 5>(vCCNN0r, vCCNN1r);
+	const f32x8 vNextR = Permute<2, 3, 6, 7>(vCCNN0r, vCCNN1r);
+	const f32x8 vCurrI = Permute<0, 1, 4, 5>(vCCNN0i, vCCNN1i);
+	const f32x8 vNextI = Permute<2, 3, 6, 7>(vCCNN0i, vCCNN1i);
+
+	const f32x8 Wr = vCurrR - vNextR;
+	const f32x8 Wi = vCurrI - vNextI;
+
+	const f32x8 vNewCurR = vCurrR + vNextR;
+	const f32x8 vNewCurI = vCurrI + vNextI;
+	const f32x8 vNewNextR = SubMul(Wr * vUr, Wi, vUi);
+	const f32x8 vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+
+	//	Don't pre-shuffle for stage 0. Stage 0 will self-correct.
+	StoreA(pfR + 0, vNewCurR);
+	StoreA(pfR + T_Data::Offset(8), vNewNextR);
+	StoreA(pfI + 0, vNewCurI);
+	StoreA(pfI + T_Data::Offset(8), vNewNextI);
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIT_Stage2(f32x8_In vUr, f32x8_In vUi, T* pfR, T* pfI)
+{
+	//	Current is 0123 of each block of 8, next is 4567.
+	const f32x8 vCurR = f32x8::LoadA(pfR + 0);
+	const f32x8 vNextR = f32x8::LoadA(pfR + T_Data::Offset(8));
+	const f32x8 vCurI = f32x8::LoadA(pfI + 0);
+	const f32x8 vNextI = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	const f32x8 Wr = SubMul(vNextR * vUr, vNextI, vUi);
+	const f32x8 Wi = AddMul(vNextR * vUi, vNextI, vUr);
+
+	const f32x8 vNewCurR = vCurR + Wr;
+	const f32x8 vNewCurI = vCurI + Wi;
+	const f32x8 vNewNextR = vCurR - Wr;
+	const f32x8 vNewNextI = vCurI - Wi;
+
+	//	Put both blocks back into the normal order for the following stages.
+	StoreA(pfR + 0, Permute128<0, 2>(vNewCurR, vNewNextR));
+	StoreA(pfR + T_Data::Offset(8), Permute128<1, 3>(vNewCurR, vNewNextR));
+	StoreA(pfI + 0, Permute128<0, 2>(vNewCurI, vNewNextI));
+	StoreA(pfI + T_Data::Offset(8), Permute128<1, 3>(vNewCurI, vNewNextI));
+}
+
+template <uint M>
+template <typename T_Data>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate8Butterflies_DIF_Stage2(f32x8_In vUr, f32x8_In vUi, T* pfR, T* pfI)
+{
+	const f32x8 v0r = f32x8::LoadA(pfR + 0);
+	const f32x8 v1r = f32x8::LoadA(pfR + T_Data::Offset(8));
+	const f32x8 v0i = f32x8::LoadA(pfI + 0);
+	const f32x8 v1i = f32x8::LoadA(pfI + T_Data::Offset(8));
+
+	//	Current is 0123 of each block of 8, next is 4567.
+	const f32x8 vCurR = Permute128<0, 2>(v0r, v1r);
+	const f32x8 vNextR = Permute128<1, 3>(v0r, v1r);
+	const f32x8 vCurI = Permute128<0, 2>(v0i, v1i);
+	const f32x8 vNextI = Permute128<1, 3>(v0i, v1i);
+
+	const f32x8 Wr = vCurR - vNextR;
+	const f32x8 Wi = vCurI - vNextI;
+
+	const f32x8 vNewCurR = vCurR + vNextR;
+	const f32x8 vNewCurI = vCurI + vNextI;
+	const f32x8 vNewNextR = SubMul(Wr * vUr, Wi, vUi);
+	const f32x8 vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+
+	//	Leave the blocks interleaved for stage 1.
+	StoreA(pfR + 0, vNewCurR);
+	StoreA(pfR + T_Data::Offset(8), vNewNextR);
+	StoreA(pfI + 0, vNewCurI);
+	StoreA(pfI + T_Data::Offset(8), vNewNextI);
+}
+#endif // FFTL_SIMD_F32x8
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIT(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
+{
+	V vCurR = V::LoadA(pfCurR);
+	V vCurI = V::LoadA(pfCurI);
+	V vNextR = V::LoadA(pfNextR);
+	V vNextI = V::LoadA(pfNextI);
+
+	CalculateVButterflies_DIT(vUr, vUi, vCurR, vCurI, vNextR, vNextI);
+
+	StoreA(pfNextR, vNextR);
+	StoreA(pfNextI, vNextI);
+	StoreA(pfCurR, vCurR);
+	StoreA(pfCurI, vCurI);
+}
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIT(const V& vUr, const V& vUi, V& vCurR, V& vCurI, V& vNextR, V& vNextI)
+{
+
+#if defined(FFTL_HAS_FMA) && 0 // Doesn't quite work for vUr values that are zero
+	vUi = vUi / vUr;
+	const V Wr = SubMul(vNextR, vNextI, vUi);
+	const V Wi = AddMul(vNextI, vNextR, vUi);
+
+	const V vNewCurR = AddMul(vCurR, Wr, vUr);
+	const V vNewCurI = AddMul(vCurI, Wi, vUr);
+	const V vNewNextR = SubMul(vCurR, Wr, vUr);
+	const V vNewNextI = SubMul(vCurI, Wi, vUr);
+#else
+	const V Wr = SubMul(vNextR * vUr, vNextI, vUi);
+	const V Wi = AddMul(vNextR * vUi, vNextI, vUr);
+
+	const V vNewCurR = vCurR + Wr;
+	const V vNewCurI = vCurI + Wi;
+	const V vNewNextR = vCurR - Wr;
+	const V vNewNextI = vCurI - Wi;
+#endif
+
+	vNextR = vNewNextR;
+	vNextI = vNewNextI;
+	vCurR = vNewCurR;
+	vCurI = vNewCurI;
+}
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
+{
+	V vCurR = V::LoadA(pfCurR);
+	V vCurI = V::LoadA(pfCurI);
+	V vNextR = V::LoadA(pfNextR);
+	V vNextI = V::LoadA(pfNextI);
+
+	CalculateVButterflies_DIF(vUr, vUi, vCurR, vCurI, vNextR, vNextI);
+
+	StoreA(pfNextR, vNextR);
+	StoreA(pfNextI, vNextI);
+	StoreA(pfCurR, vCurR);
+	StoreA(pfCurI, vCurI);
+}
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF(const V& vUr, const V& vUi, V& vCurR, V& vCurI, V& vNextR, V& vNextI)
+{
+	const V Wr = vCurR - vNextR;
+	const V Wi = vCurI - vNextI;
+
+	const V vNewCurR = vCurR + vNextR;
+	const V vNewCurI = vCurI + vNextI;
+	const V vNewNextR = SubMul(Wr * vUr, Wi, vUi);
+	const V vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+
+	vNextR = vNewNextR;
+	vNextI = vNewNextI;
+	vCurR = vNewCurR;
+	vCurI = vNewCurI;
+}
+
+
+template <uint M>
+template <uint STRIDE, typename T_Data, typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIT_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, T* pfR, T* pfI)
+{
+	V vR[4] = { V::LoadA(pfR + T_Data::Offset(0 * STRIDE)), V::LoadA(pfR + T_Data::Offset(1 * STRIDE)), V::LoadA(pfR + T_Data::Offset(2 * STRIDE)), V::LoadA(pfR + T_Data::Offset(3 * STRIDE)) };
+	V vI[4] = { V::LoadA(pfI + T_Data::Offset(0 * STRIDE)), V::LoadA(pfI + T_Data::Offset(1 * STRIDE)), V::LoadA(pfI + T_Data::Offset(2 * STRIDE)), V::LoadA(pfI + T_Data::Offset(3 * STRIDE)) };
+
+	CalculateVButterflies_DIT_Radix4(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, vR, vI);
+
+	StoreA(pfR + T_Data::Offset(0 * STRIDE), vR[0]);
+	StoreA(pfI + T_Data::Offset(0 * STRIDE), vI[0]);
+	StoreA(pfR + T_Data::Offset(1 * STRIDE), vR[1]);
+	StoreA(pfI + T_Data::Offset(1 * STRIDE), vI[1]);
+	StoreA(pfR + T_Data::Offset(2 * STRIDE), vR[2]);
+	StoreA(pfI + T_Data::Offset(2 * STRIDE), vI[2]);
+	StoreA(pfR + T_Data::Offset(3 * STRIDE), vR[3]);
+	StoreA(pfI + T_Data::Offset(3 * STRIDE), vI[3]);
+}
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIT_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, V (&vR)[4], V (&vI)[4])
+{
+	//	Legs 0 and 1 are the butterfly pair of the 1st stage, as are legs 2 and 3.
+	const V& vAr = vR[0];
+	const V& vAi = vI[0];
+	const V& vBr = vR[1];
+	const V& vBi = vI[1];
+	const V& vCr = vR[2];
+	const V& vCi = vI[2];
+	const V& vDr = vR[3];
+	const V& vDi = vI[3];
+
+	//	Apply the twiddles of both stages up front.
+	const V vUBr = SubMul(vBr * vU1r, vBi, vU1i);
+	const V vUBi = AddMul(vBr * vU1i, vBi, vU1r);
+	const V vUCr = SubMul(vCr * vU2r, vCi, vU2i);
+	const V vUCi = AddMul(vCr * vU2i, vCi, vU2r);
+	const V vUDr = SubMul(vDr * vU3r, vDi, vU3i);
+	const V vUDi = AddMul(vDr * vU3i, vDi, vU3r);
+
+	const V vSumABr = vAr + vUBr;
+	const V vSumABi = vAi + vUBi;
+	const V vDifABr = vAr - vUBr;
+	const V vDifABi = vAi - vUBi;
+	const V vSumCDr = vUCr + vUDr;
+	const V vSumCDi = vUCi + vUDi;
+	const V vDifCDr = vUCr - vUDr;
+	const V vDifCDi = vUCi - vUDi;
+
+	//	Legs 1 and 3 of the 2nd stage are additionally rotated by -i
+	const V vNew0r = vSumABr + vSumCDr;
+	const V vNew0i = vSumABi + vSumCDi;
+	const V vNew1r = vDifABr + vDifCDi;
+	const V vNew1i = vDifABi - vDifCDr;
+	const V vNew2r = vSumABr - vSumCDr;
+	const V vNew2i = vSumABi - vSumCDi;
+	const V vNew3r = vDifABr - vDifCDi;
+	const V vNew3i = vDifABi + vDifCDr;
+
+	vR[0] = vNew0r;
+	vI[0] = vNew0i;
+	vR[1] = vNew1r;
+	vI[1] = vNew1i;
+	vR[2] = vNew2r;
+	vI[2] = vNew2i;
+	vR[3] = vNew3r;
+	vI[3] = vNew3i;
+}
+
+template <uint M>
+template <uint STRIDE, typename T_Data, typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, T* pfR, T* pfI)
+{
+	V vR[4] = { V::LoadA(pfR + T_Data::Offset(0 * STRIDE)), V::LoadA(pfR + T_Data::Offset(1 * STRIDE)), V::LoadA(pfR + T_Data::Offset(2 * STRIDE)), V::LoadA(pfR + T_Data::Offset(3 * STRIDE)) };
+	V vI[4] = { V::LoadA(pfI + T_Data::Offset(0 * STRIDE)), V::LoadA(pfI + T_Data::Offset(1 * STRIDE)), V::LoadA(pfI + T_Data::Offset(2 * STRIDE)), V::LoadA(pfI + T_Data::Offset(3 * STRIDE)) };
+
+	CalculateVButterflies_DIF_Radix4(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, vR, vI);
+
+	StoreA(pfR + T_Data::Offset(0 * STRIDE), vR[0]);
+	StoreA(pfI + T_Data::Offset(0 * STRIDE), vI[0]);
+	StoreA(pfR + T_Data::Offset(1 * STRIDE), vR[1]);
+	StoreA(pfI + T_Data::Offset(1 * STRIDE), vI[1]);
+	StoreA(pfR + T_Data::Offset(2 * STRIDE), vR[2]);
+	StoreA(pfI + T_Data::Offset(2 * STRIDE), vI[2]);
+	StoreA(pfR + T_Data::Offset(3 * STRIDE), vR[3]);
+	StoreA(pfI + T_Data::Offset(3 * STRIDE), vI[3]);
+}
+
+template <uint M>
+template <typename V>
+FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, V (&vR)[4], V (&vI)[4])
+{
+	//	Legs 0 and 2 are the butterfly pair of the 1st stage, as are legs 1 and 3.
+	const V& vAr = vR[0];
+	const V& vAi = vI[0];
+	const V& vBr = vR[1];
+	const V& vBi = vI[1];
+	const V& vCr = vR[2];
+	const V& vCi = vI[2];
+	const V& vDr = vR[3];
+	const V& vDi = vI[3];
+
+	const V vSumACr = vAr + vCr;
+	const V vSumACi = vAi + vCi;
+	const V vDifACr = vAr - vCr;
+	const V vDifACi = vAi - vCi;
+	const V vSumBDr = vBr + vDr;
+	const V vSumBDi = vBi + vDi;
+	const V vDifBDr = vBr - vDr;
+	const V vDifBDi = vBi - vDi;
+
+	//	Leg 3 of the 1st stage is additionally rotated by -i
+	const V vWBr = vSumACr - vSumBDr;
+	const V vWBi = vSumACi - vSumBDi;
+	const V vWCr = vDifACr + vDifBDi;
+	const V vWCi = vDifACi - vDifBDr;
+	const V vWDr = vDifACr - vDifBDi;
+	const V vWDi = vDifACi + vDifBDr;
+
+	const V vNew0r = vSumACr + vSumBDr;
+	const V vNew0i = vSumACi + vSumBDi;
+	const V vNew1r = SubMul(vWBr * vU1r, vWBi, vU1i);
+	const V vNew1i = AddMul(vWBr * vU1i, vWBi, vU1r);
+	const V vNew2r = SubMul(vWCr * vU2r, vWCi, vU2i);
+	const V vNew2i = AddMul(vWCr * vU2i, vWCi, vU2r);
+	const V vNew3r = SubMul(vWDr * vU3r, vWDi, vU3i);
+	const V vNew3i = AddMul(vWDr * vU3i, vWDi, vU3r);
+
+	vR[0] = vNew0r;
+	vI[0] = vNew0i;
+	vR[1] = vNew1r;
+	vI[1] = vNew1i;
+	vR[2] = vNew2r;
+	vI[2] = vNew2i;
+	vR[3] = vNew3r;
+	vI[3] = vNew3i;
+}
+
+#endif // FFTL_SIMD_F32x4
+
+
+
+#if FFTL_SIMD_F64x2
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f64, f64>::TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	if constexpr (FFT_UseBlockedBitreversal<M>::value)
+	{
+		//	Permute with unit stride runs, then run stages 0 and 1 in place.
+		FFT_BitreversalBlocked<M>::Permute(fInR.data(), fOutR.data());
+		FFT_BitreversalBlocked<M>::Permute(fInI.data(), fOutI.data());
+		for (uint n = 0; n < N; n += 4)
+		{
+			T* pfR = &fOutR[n];
+			T* pfI = &fOutI[n];
+			CalculateButterflies_DIT_Stage01(pfR[0], pfI[0], pfR[1], pfI[1], pfR[2], pfI[2], pfR[3], pfI[3], pfR, pfI);
+		}
+	}
+	else
+	{
+		Transform_Stage01_BR<false>([&](uint n, T& fR, T& fI) { fR = fInR[n]; fI = fInI[n]; }, fOutR, fOutI);
+	}
+	Transform_Stages_DIT(fOutR, fOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f64, f64>::TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	Transform_Stage01_BR<false>([&](uint n, T& fR, T& fI) { fR = cxInput[n].r; fI = cxInput[n].i; }, fOutR, fOutI);
+	Transform_Stages_DIT(fOutR, fOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f64, f64>::TransformForward_1stHalf(const FixedArray<cxT, N_2>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) // 2nd half of cxInput is assumed to be all zero
+{
+	Transform_Stage01_BR<true>([&](uint n, T& fR, T& fI) { fR = cxInput[n].r; fI = cxInput[n].i; }, fOutR, fOutI);
+	Transform_Stages_DIT(fOutR, fOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f64, f64>::TransformForward_InPlace_DIF(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI)
+{
+	Transform_Stages_DIF(fInOutR, fInOutI);
+
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	for (uint n = 0; n < N; n += 4)
+	{
+		CalculateButterflies_DIF_Stage01(&fInOutR[n], &fInOutI[n]);
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[0] += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT<M, f64, f64>::TransformInverse_InPlace_DIT(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	//	Reverse real and imaginary for inverse FFT
+	for (uint n = 0; n < N; n += 4)
+	{
+		T* pfR = &fInOutI[n];
+		T* pfI = &fInOutR[n];
+		CalculateButterflies_DIT_Stage01(pfR[0], pfI[0], pfR[1], pfI[1], pfR[2], pfI[2], pfR[3], pfI[3], pfR, pfI);
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[0] += timer.GetTicks();
+#endif
+
+	Transform_Stages_DIT(fInOutI, fInOutR);
+}
+
+template <uint M>
+template <bool HALF_INPUT, typename T_LOAD>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Stage01_BR(const T_LOAD& load, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	constexpr uint N_4 = N >> 2;
+
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	//	Copy the input to the output with the bit reversal indices, simultaneously completing the first 2 stages.
+	// The bit reversed indices of each group of 4 are offset from the 1st one by N/2, N/4 and 3N/4.
+	for (uint n = 0; n < N; n += 4)
+	{
+		const uint nR = GetBitReverseIndex(n);
+
+		T fAR, fAI, fCR, fCI;
+		T fBR = 0, fBI = 0, fDR = 0, fDI = 0;
+		load(nR, fAR, fAI);
+		load(nR + N_4, fCR, fCI);
+		if constexpr (!HALF_INPUT)
+		{
+			load(nR + N_2, fBR, fBI);
+			load(nR + N_2 + N_4, fDR, fDI);
 		}
-#endif //FFTL_SIMD_F32x8
+
+		CalculateButterflies_DIT_Stage01(fAR, fAI, fBR, fBI, fCR, fCI, fDR, fDI, &fOutR[n], &fOutI[n]);
 	}
 
 #if FFTL_STAGE_TIMERS
 	timer.Stop();
-	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+	m_PreProcessTimer += timer.GetTicks();
 #endif
 }
 
 template <uint M>
-FFTL_COND_INLINE void FFT<M, f32, f32>::ApplyBitReverseAndInterleave(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N * 2>& fOut)
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Stages_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	//	Restore the time domain real output as interleaved real and complex. We need to apply bit reversal here as well.
-	for (uint n = 0; n < N; n += 4)
+	//	Invoke the main transform functions for each stage after the 1st 2
+	constexpr_for<2u, M, +1>([&](auto STAGE)
 	{
-		const uint nR0 = GetBitReverseIndex(n + 0);
-		const uint nR1 = GetBitReverseIndex(n + 1);
-		const uint nR2 = GetBitReverseIndex(n + 2);
-		const uint nR3 = GetBitReverseIndex(n + 3);
-
-		//	Interleave the output while bit reversing.
-		T* pSh = fOut + n * 2;
-
-		const T fSh0 = fInR[nR0];
-		const T fSh1 = fInI[nR0];
-		const T fSh2 = fInR[nR1];
-		const T fSh3 = fInI[nR1];
-		const T fSh4 = fInR[nR2];
-		const T fSh5 = fInI[nR2];
-		const T fSh6 = fInR[nR3];
-		const T fSh7 = fInI[nR3];
-
-#if 1
-		const f32x4 vSh0_3(fSh0, fSh1, fSh2, fSh3);
-		const f32x4 vSh4_7(fSh4, fSh5, fSh6, fSh7);
+		if constexpr (STAGE < RADIX4_STAGE_BEGIN)
+			Transform_Main_DIT<STAGE>(fOutR, fOutI);
+		else if constexpr (((STAGE - RADIX4_STAGE_BEGIN) & 1) == 0)
+			Transform_Main_DIT_Radix4<STAGE>(fOutR, fOutI);
+	});
+}
 
-		vSh0_3.StoreA(pSh + 0);
-		vSh4_7.StoreA(pSh + 4);
-#else
-		pSh[0] = fSh0;
-		pSh[1] = fSh1;
-		pSh[2] = fSh2;
-		pSh[3] = fSh3;
-		pSh[4] = fSh4;
-		pSh[5] = fSh5;
-		pSh[6] = fSh6;
-		pSh[7] = fSh7;
-#endif
-	}
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Stages_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	//	Invoke the main transform functions for each stage, running backwards and stopping before the 1st 2
+	constexpr_for<M - 1, 1u, -1>([&](auto STAGE)
+	{
+		if constexpr (STAGE < RADIX4_STAGE_BEGIN)
+			Transform_Main_DIF<STAGE>(fOutR, fOutI);
+		else if constexpr (((STAGE - RADIX4_STAGE_BEGIN) & 1) == 1)
+			Transform_Main_DIF_Radix4<STAGE - 1>(fOutR, fOutI);
+	});
 }
 
 template <uint M>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage1(f32x4_In vUr, f32x4_In vUi, T* pfR, T* pfI)
+template <uint STAGE_CURRENT>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Main_DIT(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	//	No need to shuffle the input because we've already pre-shuffled
-	const f32x4 vCurR = f32x4::LoadA(pfR + 0);
-	const f32x4 vNextR = f32x4::LoadA(pfR + 4);
+	static_assert(STAGE_CURRENT >= 2, "Vectorized stages need at least 4 contiguous butterflies");
 
-	const f32x4 vCurI = f32x4::LoadA(pfI + 0);
-	const f32x4 vNextI = f32x4::LoadA(pfI + 4);
+	constexpr uint nStageExp = 1 << (STAGE_CURRENT + 1);
+	constexpr uint nStageExp_2 = nStageExp >> 1;
+	constexpr uint nWidth = V::GetSize();
 
-	const f32x4 Wr = SubMul(vNextR * vUr, vNextI, vUi);
-	const f32x4 Wi = AddMul(vNextR * vUi, vNextI, vUr);
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
 
-	const f32x4 vNewCurR = (vCurR + Wr);
-	const f32x4 vNewCurI = (vCurI + Wi);
-	const f32x4 vNewNextR = (vCurR - Wr);
-	const f32x4 vNewNextI = (vCurI - Wi);
+	const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
 
-	//	Now shuffle them for the subsequent stages, and store
-	const f32x4 vCCNNr0 = Permute<0, 1, 4, 5>(vNewCurR, vNewNextR);
-	StoreA(pfR + 0, vCCNNr0);
-	const f32x4 vCCNNr1 = Permute<2, 3, 6, 7>(vNewCurR, vNewNextR);
-	StoreA(pfR + 4, vCCNNr1);
+	//	Loop for each sub DFT
+	for (uint nSubDFT = 0; nSubDFT < nStageExp_2; nSubDFT += nWidth)
+	{
+		const V vUr = V::LoadA(twiddlesReal + nSubDFT);
+		const V vUi = V::LoadA(twiddlesImag + nSubDFT);
 
-	const f32x4 vCCNNi0 = Permute<0, 1, 4, 5>(vNewCurI, vNewNextI);
-	StoreA(pfI + 0, vCCNNi0);
-	const f32x4 vCCNNi1 = Permute<2, 3, 6, 7>(vNewCurI, vNewNextI);
-	StoreA(pfI + 4, vCCNNi1);
+		//	Loop for each butterfly
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			const uint uButterflyNext = uButterfly + nStageExp_2;
+			CalculateVButterflies_DIT(vUr, vUi, &fOutR[uButterfly], &fOutI[uButterfly], &fOutR[uButterflyNext], &fOutI[uButterflyNext]);
+		}
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
 }
 
 template <uint M>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIF_Stage1(f32x4_In vUr, f32x4_In vUi, T* pfR, T* pfI)
+template <uint STAGE_CURRENT>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Main_DIF(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	//	For DIF processing, we're running backwards, so there was no pre-shuffling in stage 2.
-
-	const f32x4 vCCNN0r = f32x4::LoadA(pfR + 0);
-	const f32x4 vCCNN1r = f32x4::LoadA(pfR + 4);
+	static_assert(STAGE_CURRENT >= 2, "Vectorized stages need at least 4 contiguous butterflies");
 
-	const f32x4 vCCNN0i = f32x4::LoadA(pfI + 0);
-	const f32x4 vCCNN1i = f32x4::LoadA(pfI + 4);
+	constexpr uint nStageExp = 1 << (STAGE_CURRENT + 1);
+	constexpr uint nStageExp_2 = nStageExp >> 1;
+	constexpr uint nWidth = V::GetSize();
 
-	const f32x4 vCurrR = Permute<0, 1, 4, 5>(vCCNN0r, vCCNN1r);
-	const f32x4 vNextR = Permute<2, 3, 6, 7>(vCCNN0r, vCCNN1r);
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
 
-	const f32x4 vCurrI = Permute<0, 1, 4, 5>(vCCNN0i, vCCNN1i);
-	const f32x4 vNextI = Permute<2, 3, 6, 7>(vCCNN0i, vCCNN1i);
+	const auto& twiddlesReal = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddlesImag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
 
-	const f32x4 Wr = vCurrR - vNextR;
-	const f32x4 Wi = vCurrI - vNextI;
+	//	Loop for each sub DFT
+	for (int nSubDFT = nStageExp_2 - nWidth; nSubDFT >= 0; nSubDFT -= nWidth)
+	{
+		const V vUr = V::LoadA(twiddlesReal + nSubDFT);
+		const V vUi = V::LoadA(twiddlesImag + nSubDFT);
 
-	const f32x4 vNewCurR = vCurrR + vNextR;
-	const f32x4 vNewCurI = vCurrI + vNextI;
-	const f32x4 vNewNextR = SubMul(Wr * vUr, Wi, vUi);
-	const f32x4 vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+		//	Loop for each butterfly
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			const uint uButterflyNext = uButterfly + nStageExp_2;
+			CalculateVButterflies_DIF(vUr, vUi, &fOutR[uButterfly], &fOutI[uButterfly], &fOutR[uButterflyNext], &fOutI[uButterflyNext]);
+		}
+	}
 
-	//	Don't pre-shuffle for stage 0. Stage 0 will self-correct.
-	StoreA(pfR + 0, vNewCurR);
-	StoreA(pfR + 4, vNewNextR);
-	StoreA(pfI + 0, vNewCurI);
-	StoreA(pfI + 4, vNewNextI);
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
 }
 
 template <uint M>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage0(T* pfR, T* pfI)
+template <uint STAGE_CURRENT>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Main_DIT_Radix4(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	//	Shuffle the input around for the first stage so we can properly process 4 at a time.
+	static_assert(STAGE_CURRENT >= 2 && STAGE_CURRENT + 1 < M, "Radix 4 passes need at least 4 contiguous butterflies per leg");
 
-	const f32x4 vCNCN0r = f32x4::LoadA(pfR + 0);
-	const f32x4 vCNCN1r = f32x4::LoadA(pfR + 4);
-
-	const f32x4 vCNCN0i = f32x4::LoadA(pfI + 0);
-	const f32x4 vCNCN1i = f32x4::LoadA(pfI + 4);
-
-	const f32x4 vCurrR = Permute<0, 2, 4, 6>(vCNCN0r, vCNCN1r);
-	const f32x4 vNextR = Permute<1, 3, 5, 7>(vCNCN0r, vCNCN1r);
+	constexpr uint nStageExp_4 = 1 << STAGE_CURRENT;
+	constexpr uint nStageExp = nStageExp_4 << 2;
+	constexpr uint nWidth = V::GetSize();
 
-	const f32x4 vCurrI = Permute<0, 2, 4, 6>(vCNCN0i, vCNCN1i);
-	const f32x4 vNextI = Permute<1, 3, 5, 7>(vCNCN0i, vCNCN1i);
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
 
-	const f32x4 vNewCurR = vCurrR + vNextR;
-	const f32x4 vNewCurI = vCurrI + vNextI;
-	const f32x4 vNewNextR = vCurrR - vNextR;
-	const f32x4 vNewNextI = vCurrI - vNextI;
+	//	Twiddles for the 1st of the 2 combined stages, and for the 2nd. The 3rd leg needs their product.
+	const auto& twiddles1Real = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddles1Imag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+	const auto& twiddles2Real = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxR();
+	const auto& twiddles2Imag = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxI();
 
-	//	Now shuffle them so that stage 1 doesn't have to pre-shuffle on input, and store
-	const f32x4 vCCNNr0 = Permute<0, 4, 2, 6>(vNewCurR, vNewNextR);
-	const f32x4 vCCNNr1 = Permute<1, 5, 3, 7>(vNewCurR, vNewNextR);
-	const f32x4 vCCNNi0 = Permute<0, 4, 2, 6>(vNewCurI, vNewNextI);
-	const f32x4 vCCNNi1 = Permute<1, 5, 3, 7>(vNewCurI, vNewNextI);
+	//	Loop for each sub DFT
+	for (uint nSubDFT = 0; nSubDFT < nStageExp_4; nSubDFT += nWidth)
+	{
+		const V vU1r = V::LoadA(twiddles1Real + nSubDFT);
+		const V vU1i = V::LoadA(twiddles1Imag + nSubDFT);
+		const V vU2r = V::LoadA(twiddles2Real + nSubDFT);
+		const V vU2i = V::LoadA(twiddles2Imag + nSubDFT);
+		const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+		const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+		//	Loop for each 4 legs of butterflies
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			CalculateVButterflies_DIT_Radix4<nStageExp_4>(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, &fOutR[uButterfly], &fOutI[uButterfly]);
+		}
+	}
 
-	StoreA(pfR + 0, vCCNNr0);
-	StoreA(pfR + 4, vCCNNr1);
-	StoreA(pfI + 0, vCCNNi0);
-	StoreA(pfI + 4, vCCNNi1);
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
 }
 
 template <uint M>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIF_Stage0(T* pfR, T* pfI)
+template <uint STAGE_CURRENT>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::Transform_Main_DIF_Radix4(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
 {
-	//	For DIF processing, we're running backwards, so stage 1 has processed before us, and we need to correct for its order.
+	static_assert(STAGE_CURRENT >= 2 && STAGE_CURRENT + 1 < M, "Radix 4 passes need at least 4 contiguous butterflies per leg");
 
-	const f32x4 vs1_0r = f32x4::LoadA(pfR + 0);
-	const f32x4 vs1_1r = f32x4::LoadA(pfR + 4);
-
-	const f32x4 vs1_0i = f32x4::LoadA(pfI + 0);
-	const f32x4 vs1_1i = f32x4::LoadA(pfI + 4);
-
-	const f32x4 vCurrR = Permute<0, 4, 2, 6>(vs1_0r, vs1_1r);
-	const f32x4 vNextR = Permute<1, 5, 3, 7>(vs1_0r, vs1_1r);
+	constexpr uint nStageExp_4 = 1 << STAGE_CURRENT;
+	constexpr uint nStageExp = nStageExp_4 << 2;
+	constexpr uint nWidth = V::GetSize();
 
-	const f32x4 vCurrI = Permute<0, 4, 2, 6>(vs1_0i, vs1_1i);
-	const f32x4 vNextI = Permute<1, 5, 3, 7>(vs1_0i, vs1_1i);
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
 
-	const f32x4 vNewCurR = vCurrR + vNextR;
-	const f32x4 vNewCurI = vCurrI + vNextI;
-	const f32x4 vNewNextR = vCurrR - vNextR;
-	const f32x4 vNewNextI = vCurrI - vNextI;
+	const auto& twiddles1Real = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxR();
+	const auto& twiddles1Imag = FFT_Twiddles<STAGE_CURRENT, T_Twiddle>::GetCplxI();
+	const auto& twiddles2Real = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxR();
+	const auto& twiddles2Imag = FFT_Twiddles<STAGE_CURRENT + 1, T_Twiddle>::GetCplxI();
 
-	//	Now post shuffle them back to the normal (final) order.
-	const f32x4 vCNCNr0 = Permute<0, 4, 1, 5>(vNewCurR, vNewNextR);
-	const f32x4 vCNCNr1 = Permute<2, 6, 3, 7>(vNewCurR, vNewNextR);
-	const f32x4 vCNCNi0 = Permute<0, 4, 1, 5>(vNewCurI, vNewNextI);
-	const f32x4 vCNCNi1 = Permute<2, 6, 3, 7>(vNewCurI, vNewNextI);
+	//	Loop for each sub DFT
+	for (int nSubDFT = nStageExp_4 - nWidth; nSubDFT >= 0; nSubDFT -= nWidth)
+	{
+		const V vU1r = V::LoadA(twiddles1Real + nSubDFT);
+		const V vU1i = V::LoadA(twiddles1Imag + nSubDFT);
+		const V vU2r = V::LoadA(twiddles2Real + nSubDFT);
+		const V vU2i = V::LoadA(twiddles2Imag + nSubDFT);
+		const V vU3r = SubMul(vU1r * vU2r, vU1i, vU2i);
+		const V vU3i = AddMul(vU1r * vU2i, vU1i, vU2r);
+
+		//	Loop for each 4 legs of butterflies
+		for (uint uButterfly = nSubDFT; uButterfly < N; uButterfly += nStageExp)
+		{
+			CalculateVButterflies_DIF_Radix4<nStageExp_4>(vU1r, vU1i, vU2r, vU2i, vU3r, vU3i, &fOutR[uButterfly], &fOutI[uButterfly]);
+		}
+	}
 
-	StoreA(pfR + 0, vCNCNr0);
-	StoreA(pfR + 4, vCNCNr1);
-	StoreA(pfI + 0, vCNCNi0);
-	StoreA(pfI + 4, vCNCNi1);
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	m_StageTimers[STAGE_CURRENT] += timer.GetTicks();
+#endif
 }
 
 template <uint M>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::Calculate4Butterflies_DIT_Stage0(f32x4_In vCurR, f32x4_In vNextR, f32x4_In vCurI, f32x4_In vNextI, T* pfR, T* pfI)
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateButterflies_DIT_Stage01(T fAR, T fAI, T fBR, T fBI, T fCR, T fCI, T fDR, T fDI, T* pfR, T* pfI)
 {
-	//	No need to shuffle the input because we've already pre-shuffled
-	const f32x4 vNewCurR = vCurR + vNextR;
-	const f32x4 vNewCurI = vCurI + vNextI;
-	const f32x4 vNewNextR = vCurR - vNextR;
-	const f32x4 vNewNextI = vCurI - vNextI;
-
-	//	Now shuffle them so that stage 1 doesn't have to pre-shuffle on input, and store
-	const f32x4 vCCNNr0 = Permute<0, 4, 2, 6>(vNewCurR, vNewNextR);
-	const f32x4 vCCNNr1 = Permute<1, 5, 3, 7>(vNewCurR, vNewNextR);
-	const f32x4 vCCNNi0 = Permute<0, 4, 2, 6>(vNewCurI, vNewNextI);
-	const f32x4 vCCNNi1 = Permute<1, 5, 3, 7>(vNewCurI, vNewNextI);
+	//	Stage 0 butterflies are A,B and C,D. Stage 1 butterflies are A,C with a unity twiddle and B,D with a -i twiddle.
+	const T fS0R = fAR + fBR;
+	const T fS0I = fAI + fBI;
+	const T fS1R = fAR - fBR;
+	const T fS1I = fAI - fBI;
+	const T fS2R = fCR + fDR;
+	const T fS2I = fCI + fDI;
+	const T fS3R = fCR - fDR;
+	const T fS3I = fCI - fDI;
+
+	pfR[0] = fS0R + fS2R;
+	pfI[0] = fS0I + fS2I;
+	pfR[1] = fS1R + fS3I;
+	pfI[1] = fS1I - fS3R;
+	pfR[2] = fS0R - fS2R;
+	pfI[2] = fS0I - fS2I;
+	pfR[3] = fS1R - fS3I;
+	pfI[3] = fS1I + fS3R;
+}
 
-	StoreA(pfR + 0, vCCNNr0);
-	StoreA(pfR + 4, vCCNNr1);
-	StoreA(pfI + 0, vCCNNi0);
-	StoreA(pfI + 4, vCCNNi1);
+template <uint M>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateButterflies_DIF_Stage01(T* pfR, T* pfI)
+{
+	//	Stage 1 butterflies are 0,2 with a unity twiddle and 1,3 with a -i twiddle. Stage 0 butterflies are 0,1 and 2,3.
+	const T fS0R = pfR[0] + pfR[2];
+	const T fS0I = pfI[0] + pfI[2];
+	const T fS2R = pfR[0] - pfR[2];
+	const T fS2I = pfI[0] - pfI[2];
+	const T fS1R = pfR[1] + pfR[3];
+	const T fS1I = pfI[1] + pfI[3];
+	const T fS3R = pfI[1] - pfI[3];
+	const T fS3I = pfR[3] - pfR[1];
+
+	pfR[0] = fS0R + fS1R;
+	pfI[0] = fS0I + fS1I;
+	pfR[1] = fS0R - fS1R;
+	pfI[1] = fS0I - fS1I;
+	pfR[2] = fS2R + fS3R;
+	pfI[2] = fS2I + fS3I;
+	pfR[3] = fS2R - fS3R;
+	pfI[3] = fS2I - fS3I;
 }
 
 template <uint M>
-template <typename V>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIT(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateVButterflies_DIT(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
 {
 	const V vCurR = V::LoadA(pfCurR);
 	const V vCurI = V::LoadA(pfCurI);
 	const V vNextR = V::LoadA(pfNextR);
 	const V vNextI = V::LoadA(pfNextI);
 
-#if defined(FFTL_HAS_FMA) && 0 // Doesn't quite work for vUr values that are zero
-	vUi = vUi / vUr;
-	const V Wr = SubMul(vNextR, vNextI, vUi);
-	const V Wi = AddMul(vNextI, vNextR, vUi);
-
-	const V vNewCurR = AddMul(vCurR, Wr, vUr);
-	const V vNewCurI = AddMul(vCurI, Wi, vUr);
-	const V vNewNextR = SubMul(vCurR, Wr, vUr);
-	const V vNewNextI = SubMul(vCurI, Wi, vUr);
-#else
 	const V Wr = SubMul(vNextR * vUr, vNextI, vUi);
 	const V Wi = AddMul(vNextR * vUi, vNextI, vUr);
 
-	const V vNewCurR = vCurR + Wr;
-	const V vNewCurI = vCurI + Wi;
-	const V vNewNextR = vCurR - Wr;
-	const V vNewNextI = vCurI - Wi;
-#endif
-
-	StoreA(pfNextR, vNewNextR);
-	StoreA(pfNextI, vNewNextI);
-	StoreA(pfCurR, vNewCurR);
-	StoreA(pfCurI, vNewCurI);
+	StoreA(pfNextR, vCurR - Wr);
+	StoreA(pfNextI, vCurI - Wi);
+	StoreA(pfCurR, vCurR + Wr);
+	StoreA(pfCurI, vCurI + Wi);
 }
 
 template <uint M>
-template <typename V>
-FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateVButterflies_DIF(const V& vUr, const V& vUi, T* pfCurR, T* pfCurI, T* pfNextR, T* pfNextI)
 {
 	const V vCurR = V::LoadA(pfCurR);
 	const V vCurI = V::LoadA(pfCurI);
@@ -1747,18 +3654,96 @@ FFTL_FORCEINLINE void FFT<M, f32, f32>::CalculateVButterflies_DIF(const V& vUr,
 	const V Wr = vCurR - vNextR;
 	const V Wi = vCurI - vNextI;
 
-	const V vNewCurR = vCurR + vNextR;
-	const V vNewCurI = vCurI + vNextI;
-	const V vNewNextR = SubMul(Wr * vUr, Wi, vUi);
-	const V vNewNextI = AddMul(Wr * vUi, Wi, vUr);
+	StoreA(pfNextR, SubMul(Wr * vUr, Wi, vUi));
+	StoreA(pfNextI, AddMul(Wr * vUi, Wi, vUr));
+	StoreA(pfCurR, vCurR + vNextR);
+	StoreA(pfCurI, vCurI + vNextI);
+}
+
+template <uint M>
+template <uint STRIDE>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateVButterflies_DIT_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, T* pfR, T* pfI)
+{
+	//	Legs 0 and 1 are the butterfly pair of the 1st stage, as are legs 2 and 3.
+	const V vAr = V::LoadA(pfR + 0 * STRIDE);
+	const V vAi = V::LoadA(pfI + 0 * STRIDE);
+	const V vBr = V::LoadA(pfR + 1 * STRIDE);
+	const V vBi = V::LoadA(pfI + 1 * STRIDE);
+	const V vCr = V::LoadA(pfR + 2 * STRIDE);
+	const V vCi = V::LoadA(pfI + 2 * STRIDE);
+	const V vDr = V::LoadA(pfR + 3 * STRIDE);
+	const V vDi = V::LoadA(pfI + 3 * STRIDE);
+
+	//	Apply the twiddles of both stages up front.
+	const V vUBr = SubMul(vBr * vU1r, vBi, vU1i);
+	const V vUBi = AddMul(vBr * vU1i, vBi, vU1r);
+	const V vUCr = SubMul(vCr * vU2r, vCi, vU2i);
+	const V vUCi = AddMul(vCr * vU2i, vCi, vU2r);
+	const V vUDr = SubMul(vDr * vU3r, vDi, vU3i);
+	const V vUDi = AddMul(vDr * vU3i, vDi, vU3r);
+
+	const V vSumABr = vAr + vUBr;
+	const V vSumABi = vAi + vUBi;
+	const V vDifABr = vAr - vUBr;
+	const V vDifABi = vAi - vUBi;
+	const V vSumCDr = vUCr + vUDr;
+	const V vSumCDi = vUCi + vUDi;
+	const V vDifCDr = vUCr - vUDr;
+	const V vDifCDi = vUCi - vUDi;
+
+	//	Legs 1 and 3 of the 2nd stage are additionally rotated by -i
+	StoreA(pfR + 0 * STRIDE, vSumABr + vSumCDr);
+	StoreA(pfI + 0 * STRIDE, vSumABi + vSumCDi);
+	StoreA(pfR + 1 * STRIDE, vDifABr + vDifCDi);
+	StoreA(pfI + 1 * STRIDE, vDifABi - vDifCDr);
+	StoreA(pfR + 2 * STRIDE, vSumABr - vSumCDr);
+	StoreA(pfI + 2 * STRIDE, vSumABi - vSumCDi);
+	StoreA(pfR + 3 * STRIDE, vDifABr - vDifCDi);
+	StoreA(pfI + 3 * STRIDE, vDifABi + vDifCDr);
+}
 
-	StoreA(pfNextR, vNewNextR);
-	StoreA(pfNextI, vNewNextI);
-	StoreA(pfCurR, vNewCurR);
-	StoreA(pfCurI, vNewCurI);
+template <uint M>
+template <uint STRIDE>
+FFTL_FORCEINLINE void FFT<M, f64, f64>::CalculateVButterflies_DIF_Radix4(const V& vU1r, const V& vU1i, const V& vU2r, const V& vU2i, const V& vU3r, const V& vU3i, T* pfR, T* pfI)
+{
+	//	Legs 0 and 2 are the butterfly pair of the 1st stage, as are legs 1 and 3.
+	const V vAr = V::LoadA(pfR + 0 * STRIDE);
+	const V vAi = V::LoadA(pfI + 0 * STRIDE);
+	const V vBr = V::LoadA(pfR + 1 * STRIDE);
+	const V vBi = V::LoadA(pfI + 1 * STRIDE);
+	const V vCr = V::LoadA(pfR + 2 * STRIDE);
+	const V vCi = V::LoadA(pfI + 2 * STRIDE);
+	const V vDr = V::LoadA(pfR + 3 * STRIDE);
+	const V vDi = V::LoadA(pfI + 3 * STRIDE);
+
+	const V vSumACr = vAr + vCr;
+	const V vSumACi = vAi + vCi;
+	const V vDifACr = vAr - vCr;
+	const V vDifACi = vAi - vCi;
+	const V vSumBDr = vBr + vDr;
+	const V vSumBDi = vBi + vDi;
+	const V vDifBDr = vBr - vDr;
+	const V vDifBDi = vBi - vDi;
+
+	//	Leg 3 of the 1st stage is additionally rotated by -i
+	const V vWBr = vSumACr - vSumBDr;
+	const V vWBi = vSumACi - vSumBDi;
+	const V vWCr = vDifACr + vDifBDi;
+	const V vWCi = vDifACi - vDifBDr;
+	const V vWDr = vDifACr - vDifBDi;
+	const V vWDi = vDifACi + vDifBDr;
+
+	StoreA(pfR + 0 * STRIDE, vSumACr + vSumBDr);
+	StoreA(pfI + 0 * STRIDE, vSumACi + vSumBDi);
+	StoreA(pfR + 1 * STRIDE, SubMul(vWBr * vU1r, vWBi, vU1i));
+	StoreA(pfI + 1 * STRIDE, AddMul(vWBr * vU1i, vWBi, vU1r));
+	StoreA(pfR + 2 * STRIDE, SubMul(vWCr * vU2r, vWCi, vU2i));
+	StoreA(pfI + 2 * STRIDE, AddMul(vWCr * vU2i, vWCi, vU2r));
+	StoreA(pfR + 3 * STRIDE, SubMul(vWDr * vU3r, vWDi, vU3i));
+	StoreA(pfI + 3 * STRIDE, AddMul(vWDr * vU3i, vWDi, vU3r));
 }
 
-#endif // FFTL_SIMD_F32x4
+#endif // FFTL_SIMD_F64x2
 
 
 
@@ -1921,15 +3906,35 @@ FFTL_COND_INLINE void FFT_Real_Base<M, T, T_Twiddle>::TransformInverse(const Fix
 	sm_fft::m_PreProcessTimer += timer.GetTicks();
 #endif
 
-	//	Perform the half size complex inverse FFT
-	sm_fft::TransformInverse_InPlace_DIT(cxTimeOut);
+	//	Perform the half size complex inverse FFT
+	sm_fft::TransformInverse_InPlace_DIT(cxTimeOut);
+}
+
+template <uint M, typename T, typename T_Twiddle>
+FFTL_FORCEINLINE void FFT_Real_Base<M, T, T_Twiddle>::TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut)
+{
+	//	No input clobbering necessary here because there's no stack allocation.
+	TransformInverse(fFreqInR, fFreqInI, fTimeOut);
+}
+
+template <uint M, typename T, typename T_Twiddle>
+FFTL_COND_INLINE void FFT_Real_Base<M, T, T_Twiddle>::TransformForwardApplyWindow(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const WindowCoefficients& coeff)
+{
+	FixedArray<T, N> fWindowed;
+	for (uint n = 0; n < N; ++n)
+		fWindowed[n] = fTimeIn[n] * coeff.m_C[n];
+
+	TransformForward(fWindowed, fFreqOutR, fFreqOutI);
 }
 
 template <uint M, typename T, typename T_Twiddle>
-FFTL_FORCEINLINE void FFT_Real_Base<M, T, T_Twiddle>::TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut)
+FFTL_COND_INLINE void FFT_Real_Base<M, T, T_Twiddle>::TransformInverseApplyWindow_Accumulate(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeInOut, const WindowCoefficients& coeff)
 {
-	//	No input clobbering necessary here because there's no stack allocation.
+	FixedArray<T, N> fTimeOut;
 	TransformInverse(fFreqInR, fFreqInI, fTimeOut);
+
+	for (uint n = 0; n < N; ++n)
+		fTimeInOut[n] += fTimeOut[n] * coeff.m_C[n];
 }
 
 
@@ -2257,6 +4262,95 @@ FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformInverse_ClobberInput(Fixed
 		(vShB * vInv_N).StoreA(fTimeOut + n * 2 + 4);
 	}
 
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	sm_fft::m_PostProcessTimer += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformForward(const FixedArray<T, N>& fTimeIn, FixedArray<f16, N_2>& fFreqOutR, FixedArray<f16, N_2>& fFreqOutI)
+{
+	FixedArray_Aligned32<T, N_2> fTempR;
+	FixedArray_Aligned32<T, N_2> fTempI;
+	TransformForward(fTimeIn, fTempR, fTempI);
+	ConvertF32ToF16(fFreqOutR.data(), fTempR.data(), N_2);
+	ConvertF32ToF16(fFreqOutI.data(), fTempI.data(), N_2);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformForward_1stHalf(const FixedArray<T, N_2>& fTimeIn, FixedArray<f16, N_2>& fFreqOutR, FixedArray<f16, N_2>& fFreqOutI) // 2nd half of fTimeIn is assumed to be all zeros
+{
+	FixedArray_Aligned32<T, N_2> fTempR;
+	FixedArray_Aligned32<T, N_2> fTempI;
+	TransformForward_1stHalf(fTimeIn, fTempR, fTempI);
+	ConvertF32ToF16(fFreqOutR.data(), fTempR.data(), N_2);
+	ConvertF32ToF16(fFreqOutI.data(), fTempI.data(), N_2);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformInverse(const FixedArray<f16, N_2>& fFreqInR, const FixedArray<f16, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut)
+{
+	//	The widened copy is scratch anyway, so the cheaper clobbering inverse can run on it.
+	FixedArray_Aligned32<T, N_2> fTempR;
+	FixedArray_Aligned32<T, N_2> fTempI;
+	ConvertF16ToF32(fTempR.data(), fFreqInR.data(), N_2);
+	ConvertF16ToF32(fTempI.data(), fFreqInI.data(), N_2);
+	TransformInverse_ClobberInput(fTempR, fTempI, fTimeOut);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformForwardApplyWindow(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const WindowCoefficients& coeff)
+{
+	//	Even and odd samples are packed as real and imaginary, and the window coefficients are read as pairs the same way.
+	const FixedArray<cxT, N_2>& cxInput = *reinterpret_cast<const FixedArray<cxT, N_2>*>(&fTimeIn);
+
+	//	Perform the half size complex FFT
+	sm_fft::TransformForward(cxInput, coeff.m_C, fFreqOutR, fFreqOutI);
+	PostProcessForward(fFreqOutR, fFreqOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformInverseApplyWindow_Accumulate(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeInOut, const WindowCoefficients& coeff)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	//	fTimeInOut holds the previous frames' tails, so it can't be borrowed as scratch like the plain inverse does.
+	FixedArray_Aligned32<T, N_2> fFftInR;
+	FixedArray_Aligned32<T, N_2> fFftInI;
+
+	PreProcessInverse(fFftInR, fFftInI, fFreqInR, fFreqInI);
+
+	//	Perform the half size complex inverse FFT
+	sm_fft::TransformForward_InPlace_DIF(fFftInI, fFftInR); // Reverse real and imaginary for inverse FFT
+
+#if FFTL_STAGE_TIMERS
+	timer.Start();
+#endif
+
+	const f32x4 vInv_N = ConvertTo<f32x4>(1.f / N);
+
+	//	Interleave the output while bit reversing, then window it and add it to what's already there.
+	for (uint n = 0; n < N_2; n += 4)
+	{
+		const uint nR0 = sm_fft::GetBitReverseIndex(n + 0);
+		const uint nR1 = sm_fft::GetBitReverseIndex(n + 1);
+		const uint nR2 = sm_fft::GetBitReverseIndex(n + 2);
+		const uint nR3 = sm_fft::GetBitReverseIndex(n + 3);
+
+		const f32x4 vShA(fFftInR[nR0], fFftInI[nR0], fFftInR[nR1], fFftInI[nR1]);
+		const f32x4 vShB(fFftInR[nR2], fFftInI[nR2], fFftInR[nR3], fFftInI[nR3]);
+
+		const f32x4 vWinA = f32x4::LoadU(coeff.m_C + n * 2 + 0) * vInv_N;
+		const f32x4 vWinB = f32x4::LoadU(coeff.m_C + n * 2 + 4) * vInv_N;
+
+		AddMul(f32x4::LoadU(fTimeInOut + n * 2 + 0), vShA, vWinA).StoreU(fTimeInOut + n * 2 + 0);
+		AddMul(f32x4::LoadU(fTimeInOut + n * 2 + 4), vShB, vWinB).StoreU(fTimeInOut + n * 2 + 4);
+	}
+
 #if FFTL_STAGE_TIMERS
 	timer.Stop();
 	sm_fft::m_PostProcessTimer += timer.GetTicks();
@@ -2266,20 +4360,262 @@ FFTL_COND_INLINE void FFT_Real<M, f32, f32>::TransformInverse_ClobberInput(Fixed
 
 
 
+#if FFTL_SIMD_F64x2
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::TransformForward(const FixedArray<T, N>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI)
+{
+	//	Perform the half size complex FFT
+	sm_fft::TransformForward(*reinterpret_cast<const FixedArray<cxT, N_2>*>(&fTimeIn), fFreqOutR, fFreqOutI);
+	PostProcessForward(fFreqOutR, fFreqOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::TransformForward_1stHalf(const FixedArray<T, N_2>& fTimeIn, FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI) // 2nd half of fTimeIn is assumed to be all zeros
+{
+	//	Perform the half size complex FFT
+	sm_fft::TransformForward_1stHalf(*reinterpret_cast<const FixedArray<cxT, N_4>*>(&fTimeIn), fFreqOutR, fFreqOutI);
+	PostProcessForward(fFreqOutR, fFreqOutI);
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::PostProcessForward(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	constexpr uint nWidth = V::GetSize();
+	constexpr uint nScalarEnd = N_4 < nWidth ? N_4 : nWidth;
+
+	//	Special case for 0 index
+	{
+		const T fDcR = fFreqOutR[0];
+		const T fDcI = fFreqOutI[0];
+		fFreqOutR[0] = fDcR + fDcI;
+		fFreqOutI[0] = fDcR - fDcI; // Sneaky shove of the Nyquist bin into the imag DC bin because it's always 0 anyway.
+	}
+
+	//	Scalar until n is aligned to the vector width.
+	for (uint n = 1; n < nScalarEnd; ++n)
+	{
+		const uint Nmn = N_2 - n;
+
+		const cxNumber<T> twid(GetTwiddleReal(n), GetTwiddleImag(n));
+
+		const cxNumber<T> fpk(fFreqOutR[n], fFreqOutI[n]);
+		const cxNumber<T> fpnk(fFreqOutR[Nmn], -fFreqOutI[Nmn]);
+
+		const cxNumber<T> f1k = fpk + fpnk;
+		const cxNumber<T> f2k = fpk - fpnk;
+		const cxNumber<T> tw = f2k * twid;
+
+		fFreqOutR[n] = 0.5 * (f1k.r + tw.r);
+		fFreqOutI[n] = 0.5 * (f1k.i + tw.i);
+		fFreqOutR[Nmn] = 0.5 * (f1k.r - tw.r);
+		fFreqOutI[Nmn] = 0.5 * (tw.i - f1k.i);
+	}
+
+	const V vHalf = V::Splat(0.5);
+
+	//	N-n loading will be unaligned.
+	for (uint n = nWidth; n < N_4; n += nWidth)
+	{
+		const uint Nmn = N_2 - n - (nWidth - 1);
+
+		const cxNumber<V> twid(V::LoadA(GetTwiddleRealPtr(n)), V::LoadA(GetTwiddleImagPtr(n)));
+
+		const cxNumber<V> fpk(V::LoadA(fFreqOutR + n), V::LoadA(fFreqOutI + n));
+		const cxNumber<V> fpnk(Reverse(V::LoadU(fFreqOutR + Nmn)), Reverse(V::LoadU(fFreqOutI + Nmn)));
+
+		const cxNumber<V> f1k = cxNumber<V>(fpk.r + fpnk.r, fpk.i - fpnk.i);
+		const cxNumber<V> f2k = cxNumber<V>(fpk.r - fpnk.r, fpk.i + fpnk.i);
+		const cxNumber<V> tw = f2k * twid;
+
+		(vHalf * (f1k.r + tw.r)).StoreA(fFreqOutR + n);
+		(vHalf * (f1k.i + tw.i)).StoreA(fFreqOutI + n);
+		Reverse(vHalf * (f1k.r - tw.r)).StoreU(fFreqOutR + Nmn);
+		Reverse(vHalf * (tw.i - f1k.i)).StoreU(fFreqOutI + Nmn);
+	}
+
+	//	The odd center bin just needs the imaginary part negated.
+	fFreqOutI[N_4] = -fFreqOutI[N_4];
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	sm_fft::m_PostProcessTimer += timer.GetTicks();
+#endif
+}
+
+template <uint M>
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::PreProcessInverse(FixedArray<T, N_2>& fFreqOutR, FixedArray<T, N_2>& fFreqOutI, const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	constexpr uint nWidth = V::GetSize();
+	constexpr uint nScalarEnd = N_4 < nWidth ? N_4 : nWidth;
+
+	//	Special case for 0 index
+	{
+		const T fDC = fFreqInR[0];
+		const T fNy = fFreqInI[0];
+		fFreqOutR[0] = fDC + fNy;
+		fFreqOutI[0] = fDC - fNy;
+	}
+
+	//	Scalar until n is aligned to the vector width.
+	for (uint n = 1; n < nScalarEnd; ++n)
+	{
+		const uint Nmn = N_2 - n;
+
+		const cxNumber<T> twid(GetTwiddleReal(n), GetTwiddleImag(n));
+
+		const cxNumber<T> fk(fFreqInR[n], fFreqInI[n]);
+		const cxNumber<T> fnkc(fFreqInR[Nmn], -fFreqInI[Nmn]);
+
+		const cxNumber<T> fek = fk + fnkc;
+		const cxNumber<T> tmp = fk - fnkc;
+		const cxNumber<T> fok = NegMul(tmp, twid);
+
+		fFreqOutR[n] = fek.r + fok.r;
+		fFreqOutI[n] = fek.i + fok.i;
+		fFreqOutR[Nmn] = fek.r - fok.r;
+		fFreqOutI[Nmn] = fok.i - fek.i;
+	}
+
+	//	N-n loading will be unaligned.
+	for (uint n = nWidth; n < N_4; n += nWidth)
+	{
+		const uint Nmn = N_2 - n - (nWidth - 1);
+
+		const cxNumber<V> twid(V::LoadA(GetTwiddleRealPtr(n)), V::LoadA(GetTwiddleImagPtr(n)));
+
+		const cxNumber<V> fk(V::LoadA(fFreqInR + n), V::LoadA(fFreqInI + n));
+		const cxNumber<V> fnkc(Reverse(V::LoadU(fFreqInR + Nmn)), Reverse(V::LoadU(fFreqInI + Nmn)));
+
+		const cxNumber<V> fek = cxNumber<V>(fk.r + fnkc.r, fk.i - fnkc.i);
+		const cxNumber<V> tmp = cxNumber<V>(fk.r - fnkc.r, fk.i + fnkc.i);
+		const cxNumber<V> fok = NegMul(tmp, twid);
+
+		(fek.r + fok.r).StoreA(fFreqOutR + n);
+		(fek.i + fok.i).StoreA(fFreqOutI + n);
+		Reverse(fek.r - fok.r).StoreU(fFreqOutR + Nmn);
+		Reverse(fok.i - fek.i).StoreU(fFreqOutI + Nmn);
+	}
+
+	//	The odd center bin just needs to be doubled and the imaginary part negated.
+	fFreqOutR[N_4] = fFreqInR[N_4] * +2.0;
+	fFreqOutI[N_4] = fFreqInI[N_4] * -2.0;
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	sm_fft::m_PreProcessTimer += timer.GetTicks();
+#endif
+}
+
 template <uint M>
-void FFT_RealV<M>::TransformForward(const f32* fTimeIn, f32* fFreqOutR, f32* fFreqOutI) const
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::TransformInverse(const FixedArray<T, N_2>& fFreqInR, const FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut)
 {
-	FFT_Real<M, f32>::TransformForward(*reinterpret_cast<const FixedArray<f32, N>*>(fTimeIn), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqOutR), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqOutI));
+	FixedArray<T, N_2>& fFftInR = *reinterpret_cast<FixedArray<T, N_2>*>(fTimeOut + 0);
+	FixedArray<T, N_2>& fFftInI = *reinterpret_cast<FixedArray<T, N_2>*>(fTimeOut + N_2);
+
+	PreProcessInverse(fFftInR, fFftInI, fFreqInR, fFreqInI);
+
+	//	Perform the half size complex inverse FFT
+	FixedArray_Aligned32<T, N_2> fTempR;
+	FixedArray_Aligned32<T, N_2> fTempI;
+	sm_fft::TransformInverse(fFftInR, fFftInI, fTempR, fTempI);
+
+	InterleaveOutput(fTempR, fTempI, fTimeOut);
 }
+
 template <uint M>
-void FFT_RealV<M>::TransformInverse(const f32* fFreqInR, const f32* fFreqInI, f32* fTimeOut) const
+FFTL_COND_INLINE void FFT_Real<M, f64, f64>::TransformInverse_ClobberInput(FixedArray<T, N_2>& fFreqInR, FixedArray<T, N_2>& fFreqInI, FixedArray<T, N>& fTimeOut)
 {
-	FFT_Real<M, f32>::TransformInverse(*reinterpret_cast<const FixedArray<f32, N_2>*>(fFreqInR), *reinterpret_cast<const FixedArray<f32, N_2>*>(fFreqInI), *reinterpret_cast<FixedArray<f32, N>*>(fTimeOut));
+	PreProcessInverse(fFreqInR, fFreqInI, fFreqInR, fFreqInI);
+
+	//	Perform the half size complex inverse FFT
+	sm_fft::TransformForward_InPlace_DIF(fFreqInI, fFreqInR); // Reverse real and imaginary for inverse FFT
+
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	const f64x2 vInv_N = f64x2::Splat(1.0 / N);
+
+	//	Restore the time domain real output as interleaved real and complex. We need to apply bit reversal here as well.
+	for (uint n = 0; n < N_2; ++n)
+	{
+		const uint nR = sm_fft::GetBitReverseIndex(n);
+		(f64x2(fFreqInR[nR], fFreqInI[nR]) * vInv_N).StoreA(fTimeOut + n * 2);
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	sm_fft::m_PostProcessTimer += timer.GetTicks();
+#endif
 }
+
 template <uint M>
-void FFT_RealV<M>::TransformInverse_ClobberInput(f32* fFreqInR, f32* fFreqInI, f32* fTimeOut) const
+FFTL_FORCEINLINE void FFT_Real<M, f64, f64>::InterleaveOutput(const FixedArray<T, N_2>& fInR, const FixedArray<T, N_2>& fInI, FixedArray<T, N>& fTimeOut)
+{
+#if FFTL_STAGE_TIMERS
+	Timer timer;
+	timer.Start();
+#endif
+
+	constexpr uint nWidth = V::GetSize();
+	const V vInv_N = V::Splat(1.0 / N);
+
+	//	Restore the time domain real output as interleaved real and complex.
+	for (uint n = 0; n < N_2; n += nWidth)
+	{
+		const V vInA = V::LoadA(fInR + n) * vInv_N;
+		const V vInB = V::LoadA(fInI + n) * vInv_N;
+		InterleaveLo(vInA, vInB).StoreA(fTimeOut + n * 2 + 0);
+		InterleaveHi(vInA, vInB).StoreA(fTimeOut + n * 2 + nWidth);
+	}
+
+#if FFTL_STAGE_TIMERS
+	timer.Stop();
+	sm_fft::m_PostProcessTimer += timer.GetTicks();
+#endif
+}
+
+#endif // FFTL_SIMD_F64x2
+
+
+
+template <uint M, typename T_FFT>
+void FFT_ComplexV<M, T_FFT>::TransformForward(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const
+{
+	T_FFT::TransformForward(*reinterpret_cast<const FixedArray<f32, N>*>(fInR), *reinterpret_cast<const FixedArray<f32, N>*>(fInI), *reinterpret_cast<FixedArray<f32, N>*>(fOutR), *reinterpret_cast<FixedArray<f32, N>*>(fOutI));
+}
+template <uint M, typename T_FFT>
+void FFT_ComplexV<M, T_FFT>::TransformInverse(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const
+{
+	T_FFT::TransformInverse(*reinterpret_cast<const FixedArray<f32, N>*>(fInR), *reinterpret_cast<const FixedArray<f32, N>*>(fInI), *reinterpret_cast<FixedArray<f32, N>*>(fOutR), *reinterpret_cast<FixedArray<f32, N>*>(fOutI));
+}
+
+template <uint M, typename T_FFT_REAL>
+void FFT_RealV<M, T_FFT_REAL>::TransformForward(const f32* fTimeIn, f32* fFreqOutR, f32* fFreqOutI) const
+{
+	T_FFT_REAL::TransformForward(*reinterpret_cast<const FixedArray<f32, N>*>(fTimeIn), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqOutR), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqOutI));
+}
+template <uint M, typename T_FFT_REAL>
+void FFT_RealV<M, T_FFT_REAL>::TransformInverse(const f32* fFreqInR, const f32* fFreqInI, f32* fTimeOut) const
 {
-	FFT_Real<M, f32>::TransformInverse_ClobberInput(*reinterpret_cast<FixedArray<f32, N_2>*>(fFreqInR), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqInI), *reinterpret_cast<FixedArray<f32, N>*>(fTimeOut));
+	T_FFT_REAL::TransformInverse(*reinterpret_cast<const FixedArray<f32, N_2>*>(fFreqInR), *reinterpret_cast<const FixedArray<f32, N_2>*>(fFreqInI), *reinterpret_cast<FixedArray<f32, N>*>(fTimeOut));
+}
+template <uint M, typename T_FFT_REAL>
+void FFT_RealV<M, T_FFT_REAL>::TransformInverse_ClobberInput(f32* fFreqInR, f32* fFreqInI, f32* fTimeOut) const
+{
+	T_FFT_REAL::TransformInverse_ClobberInput(*reinterpret_cast<FixedArray<f32, N_2>*>(fFreqInR), *reinterpret_cast<FixedArray<f32, N_2>*>(fFreqInI), *reinterpret_cast<FixedArray<f32, N>*>(fTimeOut));
 }
 
 
@@ -2300,7 +4636,8 @@ Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolver()
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArray_FD, size_t kernelArraySize)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArray_FD, size_t kernelArraySize)
 {
 	ConvolveInitial_FirstStage(fInput, pKernelArray_FD, kernelArraySize);
 	ConvolveInitial_LastStage(fOutput);
@@ -2308,7 +4645,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T,
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB)
 {
 	ConvolveInitial_FirstStage(fInput, pKernelArrayA_FD, kernelArraySizeA, fGainA, pKernelArrayB_FD, kernelArraySizeB, fGainB);
 	ConvolveInitial_LastStage(fOutput);
@@ -2317,7 +4655,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(FixedArray_Aligned32<T,
 
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArray_FD, size_t kernelArraySize)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArray_FD, size_t kernelArraySize)
 {
 	FFTL_ASSERT_MSG(kernelArraySize <= T_MAX_KERNELS, "Hitting this assert means a likely crash later in ConvolveResumePartial.");
 
@@ -2338,7 +4677,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const
 		}
 
 		//	Convolve the first segment, perform IFFT, and write to the output
-		const Kernel& kernel = pKernelArray_FD[0];
+		const T_Kernel& kernel = pKernelArray_FD[0];
 		Kernel& curBuffer = m_AccumulationBuffer[0];
 
 		{
@@ -2364,7 +4703,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const FixedArray_Aligned32<T, N>& fInput, const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB)
 {
 	FFTL_ASSERT_MSG(kernelArraySizeA <= T_MAX_KERNELS, "Hitting this assert means a likely crash later in ConvolveResumePartial.");
 	FFTL_ASSERT_MSG(kernelArraySizeB <= T_MAX_KERNELS, "Hitting this assert means a likely crash later in ConvolveResumePartial.");
@@ -2390,8 +4730,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const
 		}
 
 		//	Convolve the first segment
-		const Kernel& kernelA = pKernelArrayA_FD[0];
-		const Kernel& kernelB = pKernelArrayB_FD[0];
+		const T_Kernel& kernelA = pKernelArrayA_FD[0];
+		const T_Kernel& kernelB = pKernelArrayB_FD[0];
 		Kernel& curBuffer = m_AccumulationBuffer[0];
 
 		{
@@ -2419,7 +4759,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const
 		}
 
 		//	Convolve the first segment, perform IFFT, and write to the output
-		const Kernel& kernelA = pKernelArrayA_FD[0];
+		const T_Kernel& kernelA = pKernelArrayA_FD[0];
 		Kernel& curBuffer = m_AccumulationBuffer[0];
 
 		{
@@ -2448,7 +4788,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_FirstStage(const
 
 		{
 			//	Convolve the first segment, perform IFFT, and write to the output
-			const Kernel &kernelB = pKernelArrayB_FD[0];
+			const T_Kernel& kernelB = pKernelArrayB_FD[0];
 			Kernel &curBuffer = m_AccumulationBuffer[0];
 
 			//	Convolution Timer
@@ -2499,7 +4839,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveInitial_LastStage(FixedA
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kernel* pKernelArray_FD, size_t kernelArraySize, size_t endKernelIndex)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const T_Kernel* pKernelArray_FD, size_t kernelArraySize, size_t endKernelIndex)
 {
 	auto TailConvolveLambda = [this](size_t startKernelIndex, size_t endKernelIndex)
 	{
@@ -2544,7 +4885,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 		//	Perform short convolutions on the remaining kernels, accumulating everything as necessary
 		for (size_t k = m_LastKernelIndex; k < endKernelIndex; ++k)
 		{
-			const Kernel& kernel = pKernelArray_FD[k];
+			const T_Kernel& kernel = pKernelArray_FD[k];
 			Kernel& curBuffer = m_AccumulationBuffer[k];
 			Kernel& prvBuffer = m_AccumulationBuffer[k - 1];
 
@@ -2573,7 +4914,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB, size_t endKernelIndex)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const T_Kernel* pKernelArrayA_FD, size_t kernelArraySizeA, T fGainA, const T_Kernel* pKernelArrayB_FD, size_t kernelArraySizeB, T fGainB, size_t endKernelIndex)
 {
 	const size_t minNewKernelCount = Min(kernelArraySizeA, kernelArraySizeB);
 	const size_t minEndKernelIndex = Min(Min(m_LastKernelIndex + minNewKernelCount, endKernelIndex), minNewKernelCount);
@@ -2618,8 +4960,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 		//	Perform short convolutions on the remaining kernels, accumulating everything as necessary
 		for (size_t k = m_LastKernelIndex; k < minEndKernelIndex; ++k)
 		{
-			const Kernel& kernelA = pKernelArrayA_FD[k];
-			const Kernel& kernelB = pKernelArrayB_FD[k];
+			const T_Kernel& kernelA = pKernelArrayA_FD[k];
+			const T_Kernel& kernelB = pKernelArrayB_FD[k];
 			Kernel& curBuffer = m_AccumulationBuffer[k];
 			Kernel& prvBuffer = m_AccumulationBuffer[k - 1];
 
@@ -2634,7 +4976,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 		{
 			for (size_t k = Max(minEndKernelIndex, m_LastKernelIndex); k < endKernelIndex; ++k)
 			{
-				const Kernel& kernelA = pKernelArrayA_FD[k];
+				const T_Kernel& kernelA = pKernelArrayA_FD[k];
 				Kernel& curBuffer = m_AccumulationBuffer[k];
 				Kernel& prvBuffer = m_AccumulationBuffer[k - 1];
 
@@ -2649,7 +4991,7 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 		{
 			for (size_t k = Max(minEndKernelIndex, m_LastKernelIndex); k < endKernelIndex; ++k)
 			{
-				const Kernel& kernelB = pKernelArrayB_FD[k];
+				const T_Kernel& kernelB = pKernelArrayB_FD[k];
 				Kernel& curBuffer = m_AccumulationBuffer[k];
 				Kernel& prvBuffer = m_AccumulationBuffer[k - 1];
 
@@ -2681,11 +5023,12 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveResumePartial(const Kern
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY)
 {
 	//	Cache dc and Nyquist bins
-	const T dc = inX.r()[0] * inY.r()[0];
-	const T nq = inX.i()[0] * inY.i()[0];
+	const T dc = inX.r()[0] * GetKernelValue(inY.r()[0]);
+	const T nq = inX.i()[0] * GetKernelValue(inY.i()[0]);
 
 	//	Perform the convolution in the frequency domain, which corresponds to a complex multiplication by the kernel
 	if constexpr (std::is_same<T, f32>::value)
@@ -2694,8 +5037,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 		{
 			const f32x8 xR = f32x8::LoadA(inX.r() + n);
 			const f32x8 xI = f32x8::LoadA(inX.i() + n);
-			const f32x8 yR = f32x8::LoadA(inY.r() + n);
-			const f32x8 yI = f32x8::LoadA(inY.i() + n);
+			const f32x8 yR = LoadKernel(inY.r() + n);
+			const f32x8 yI = LoadKernel(inY.i() + n);
 
 			const f32x8 rR = AddMul(xI * yI, xR, yR);
 			const f32x8 rI = AddMul(xI * yR, xR, yI);
@@ -2733,11 +5076,12 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inW)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const Kernel& inW)
 {
 	//	Cache dc and Nyquist bins
-	const T dc = AddMul(inW.r()[0], inX.r()[0], inY.r()[0]);
-	const T nq = AddMul(inW.i()[0], inX.i()[0], inY.i()[0]);
+	const T dc = AddMul(inW.r()[0], inX.r()[0], GetKernelValue(inY.r()[0]));
+	const T nq = AddMul(inW.i()[0], inX.i()[0], GetKernelValue(inY.i()[0]));
 
 	//	Perform the convolution in the frequency domain, which corresponds to a complex multiplication by the kernel
 	if constexpr (std::is_same<T, f32>::value)
@@ -2746,8 +5090,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 		{
 			const f32x8 xR = f32x8::LoadA(inX.r() + n);
 			const f32x8 xI = f32x8::LoadA(inX.i() + n);
-			const f32x8 yR = f32x8::LoadA(inY.r() + n);
-			const f32x8 yI = f32x8::LoadA(inY.i() + n);
+			const f32x8 yR = LoadKernel(inY.r() + n);
+			const f32x8 yI = LoadKernel(inY.i() + n);
 			const f32x8 wR = f32x8::LoadA(inW.r() + n);
 			const f32x8 wI = f32x8::LoadA(inW.i() + n);
 
@@ -2789,11 +5133,12 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inW, T fGainY)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const Kernel& inW, T fGainY)
 {
 	//	Cache dc and Nyquist bins
-	const T dc = AddMul(inW.r()[0], inX.r()[0], inY.r()[0] * fGainY);
-	const T nq = AddMul(inW.i()[0], inX.i()[0], inY.i()[0] * fGainY);
+	const T dc = AddMul(inW.r()[0], inX.r()[0], GetKernelValue(inY.r()[0]) * fGainY);
+	const T nq = AddMul(inW.i()[0], inX.i()[0], GetKernelValue(inY.i()[0]) * fGainY);
 
 	//	Perform the convolution in the frequency domain, which corresponds to a complex multiplication by the kernel
 	if constexpr (std::is_same<T, f32>::value)
@@ -2804,8 +5149,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 		{
 			const f32x8 xR = f32x8::LoadA(inX.r() + n);
 			const f32x8 xI = f32x8::LoadA(inX.i() + n);
-			const f32x8 yR = f32x8::LoadA(inY.r() + n);
-			const f32x8 yI = f32x8::LoadA(inY.i() + n);
+			const f32x8 yR = LoadKernel(inY.r() + n);
+			const f32x8 yI = LoadKernel(inY.i() + n);
 			const f32x8 wR = f32x8::LoadA(inW.r() + n);
 			const f32x8 wI = f32x8::LoadA(inW.i() + n);
 
@@ -2849,11 +5194,12 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const Kernel& inY, const Kernel& inZ, const Kernel& inW, T fGainY, T fGainZ)
+template <typename T_Kernel>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const Kernel& inX, const T_Kernel& inY, const T_Kernel& inZ, const Kernel& inW, T fGainY, T fGainZ)
 {
 	//	Cache dc and Nyquist bins
-	const T dc = AddMul(inW.r()[0], inX.r()[0], AddMul(inY.r()[0] * fGainY, inZ.r()[0], fGainZ));
-	const T nq = AddMul(inW.i()[0], inX.i()[0], AddMul(inY.i()[0] * fGainY, inZ.i()[0], fGainZ));
+	const T dc = AddMul(inW.r()[0], inX.r()[0], AddMul(GetKernelValue(inY.r()[0]) * fGainY, GetKernelValue(inZ.r()[0]), fGainZ));
+	const T nq = AddMul(inW.i()[0], inX.i()[0], AddMul(GetKernelValue(inY.i()[0]) * fGainY, GetKernelValue(inZ.i()[0]), fGainZ));
 
 	//	Perform the convolution in the frequency domain, which corresponds to a complex multiplication by the kernel
 	if constexpr (std::is_same<T, f32>::value)
@@ -2865,10 +5211,10 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::ConvolveFD(Kernel& output, const
 		{
 			const f32x8 xR = f32x8::LoadA(inX.r() + n);
 			const f32x8 xI = f32x8::LoadA(inX.i() + n);
-			const f32x8 yR = f32x8::LoadA(inY.r() + n);
-			const f32x8 yI = f32x8::LoadA(inY.i() + n);
-			const f32x8 zR = f32x8::LoadA(inZ.r() + n);
-			const f32x8 zI = f32x8::LoadA(inZ.i() + n);
+			const f32x8 yR = LoadKernel(inY.r() + n);
+			const f32x8 yI = LoadKernel(inY.i() + n);
+			const f32x8 zR = LoadKernel(inZ.r() + n);
+			const f32x8 zI = LoadKernel(inZ.i() + n);
 			const f32x8 wR = f32x8::LoadA(inW.r() + n);
 			const f32x8 wI = f32x8::LoadA(inW.i() + n);
 
@@ -2938,7 +5284,8 @@ void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::AddArrays(FixedArray_Aligned32<T
 }
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
-uint Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::InitKernel(Kernel* pKernelOutput_FD, const T* pKernelInput_TD, size_t kernelLength)
+template <typename T_Kernel>
+uint Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::InitKernel(T_Kernel* pKernelOutput_FD, const T* pKernelInput_TD, size_t kernelLength)
 {
 	//	Determine the number of kernels we need
 	const uint kernelCount = safestatic_cast<uint>(AlignForward<N>(kernelLength) / N);
@@ -2952,10 +5299,8 @@ uint Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::InitKernel(Kernel* pKernelOutput
 
 	for (uint i = 0; i < kernelCount - 1; ++i)
 	{
-		Kernel& kernel = pKernelOutput_FD[i];
-
 		//	Convert to frequency domain, and store
-		sm_fft::TransformForward_1stHalf(*reinterpret_cast<const FixedArray<T, N>*>(pKernelInput_TD + i * N), kernel.r(), kernel.i());
+		TransformKernel(pKernelOutput_FD[i], *reinterpret_cast<const FixedArray<T, N>*>(pKernelInput_TD + i * N));
 
 		samplesRemaining -= N;
 	}
@@ -2965,15 +5310,28 @@ uint Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::InitKernel(Kernel* pKernelOutput
 		MemZero(temp);
 		MemCopy(temp.data(), pKernelInput_TD + N * (kernelCount - 1), samplesRemaining);
 
-		Kernel& kernel = pKernelOutput_FD[kernelCount - 1];
-
 		//	Convert to frequency domain, and store
-		sm_fft::TransformForward_1stHalf(temp, kernel.r(), kernel.i());
+		TransformKernel(pKernelOutput_FD[kernelCount - 1], temp);
 	}
 
 	return kernelCount;
 }
 
+template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::TransformKernel(Kernel& kernel, const FixedArray<T, N>& fKernelInput_TD)
+{
+	sm_fft::TransformForward_1stHalf(fKernelInput_TD, kernel.r(), kernel.i());
+}
+
+template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
+void Convolver<M, T_MAX_KERNELS, T, T_Twiddle>::TransformKernel(KernelF16& kernel, const FixedArray<T, N>& fKernelInput_TD)
+{
+	//	Transformed in full precision, and only rounded once on the way into storage
+	Kernel temp;
+	sm_fft::TransformForward_1stHalf(fKernelInput_TD, temp.r(), temp.i());
+	ConvertF32ToF16(kernel.t.data(), temp.t.data(), _2N);
+}
+
 
 
 template <uint M, size_t T_MAX_KERNELS, typename T, typename T_Twiddle>
@@ -2995,7 +5353,7 @@ void ConvolverV<M, T_MAX_KERNELS, T, T_Twiddle>::Convolve(T* fOutput, const T* f
 template <typename T, uint T_N, uint T_KERNEL_LENGTH>
 void Convolver_Slow<T, T_N, T_KERNEL_LENGTH>::Convolve(FixedArray<T, T_N>& fOutput, const FixedArray<T, T_N> &fInput)
 {
-	memmove(&m_AccumulationBuffer, &m_AccumulationBuffer[T_N], sizeof(T)*T_KERNEL_LENGTH);
+	memmove(m_AccumulationBuffer.data(), m_AccumulationBuffer.data() + T_N, sizeof(T)*T_KERNEL_LENGTH);
 	MemZero(&m_AccumulationBuffer[T_KERNEL_LENGTH], T_N);
 
 	for (uint n = 0; n < T_N; ++n)
@@ -3007,7 +5365,7 @@ void Convolver_Slow<T, T_N, T_KERNEL_LENGTH>::Convolve(FixedArray<T, T_N>& fOutp
 		}
 	}
 
-	MemCopy(fOutput, m_AccumulationBuffer);
+	MemCopy(fOutput.data(), m_AccumulationBuffer.data(), T_N);
 }
 
 
@@ -0,0 +1,119 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+#include "Transpose.h"
+
+
+namespace FFTL
+{
+
+
+//	2D complex transform of NY rows of NX elements, stored row major. The rows are transformed first, then the columns, which are made
+// contiguous by a tiled transpose so the column pass runs the same fast 1D transforms on unit stride data instead of gathering
+// elements NX apart:
+//
+//		1. FFT<MX> on each row, input to work
+//		2. Transpose work to the output, so the columns become rows
+//		3. FFT<MY> on each of those, output to work
+//		4. Transpose back to the output, so the result is in natural [ky][kx] order
+//
+// The caller provides a work buffer of the same size as the output. The input is not modified.
+template <uint MX, uint MY, typename T = f32>
+class FFTL_NODISCARD FFT2D
+{
+	static_assert(MX >= 3 && MY >= 3, "FFT2D needs at least 8 elements per row and column");
+
+public:
+	//	Precomputed constants
+	static constexpr uint NX = 1 << MX;
+	static constexpr uint NY = 1 << MY;
+	static constexpr uint N = NX * NY;
+
+	using sm_fftX = FFT<MX, T>;
+	using sm_fftY = FFT<MY, T>;
+
+	FFT2D() = delete;
+
+	static void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI);
+
+	//	No divide by N. Swap the real and imaginary parts.
+	static void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+	{
+		TransformForward(fInI, fInR, fOutI, fOutR, fWorkI, fWorkR);
+	}
+
+private:
+	static constexpr uint TILE = (NX < NY ? NX : NY) < 16 ? (NX < NY ? NX : NY) : 16;
+};
+
+
+//	2D transform of real input. Hermitian symmetry means only columns kx = 0 to NX / 2 are needed, so each row goes through FFT_Real<MX>,
+// and only half as many column transforms are done as for complex input. The packed DC and Nyquist bins that FFT_Real leaves in
+// element 0 of each row are both real sequences down the columns, so they share a single complex column transform and are separated
+// afterwards.
+//
+// The spectrum is NY rows of NX / 2 bins in [ky][kx] order, for kx = 0 to NX / 2 - 1. The kx = NX / 2 column is returned separately
+// in fNyquistR/I. The round trip is scaled by NY, since the column transforms aren't normalized.
+template <uint MX, uint MY, typename T = f32>
+class FFTL_NODISCARD FFT2D_Real
+{
+	static_assert(MX >= 5 && MY >= 3, "FFT2D_Real needs at least 32 elements per row and 8 per column");
+
+public:
+	//	Precomputed constants
+	static constexpr uint NX = 1 << MX;
+	static constexpr uint NY = 1 << MY;
+	static constexpr uint NX_2 = NX / 2;
+	static constexpr uint N = NX * NY;
+	static constexpr uint N_2 = N / 2;
+
+	using sm_fftX = FFT_Real<MX, T>;
+	using sm_fftY = FFT<MY, T>;
+
+	FFT2D_Real() = delete;
+
+	static void TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N_2>& fOutR, FixedArray<T, N_2>& fOutI, FixedArray<T, NY>& fNyquistR, FixedArray<T, NY>& fNyquistI, FixedArray<T, N_2>& fWorkR, FixedArray<T, N_2>& fWorkI);
+	static void TransformInverse(const FixedArray<T, N_2>& fInR, const FixedArray<T, N_2>& fInI, const FixedArray<T, NY>& fNyquistR, const FixedArray<T, NY>& fNyquistI, FixedArray<T, N>& fOut, FixedArray<T, N_2>& fWorkR, FixedArray<T, N_2>& fWorkI);
+
+private:
+	static constexpr uint TILE = (NX_2 < NY ? NX_2 : NY) < 16 ? (NX_2 < NY ? NX_2 : NY) : 16;
+};
+
+
+} // namespace FFTL
+
+
+#include "FFT2D.inl"
@@ -0,0 +1,166 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint MX, uint MY, typename T>
+void FFT2D<MX, MY, T>::TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+{
+	FFTL_ASSERT(fInR.data() != fWorkR.data() && fOutR.data() != fWorkR.data());
+
+	using RowX = FixedArray<T, NX>;
+	using RowY = FixedArray<T, NY>;
+
+	for (uint y = 0; y < NY; ++y)
+	{
+		const uint uOffset = y * NX;
+		sm_fftX::TransformForward(
+			*reinterpret_cast<const RowX*>(fInR + uOffset), *reinterpret_cast<const RowX*>(fInI + uOffset),
+			*reinterpret_cast<RowX*>(fWorkR + uOffset), *reinterpret_cast<RowX*>(fWorkI + uOffset));
+	}
+
+	//	Column x becomes row x
+	TransposeTiled<NY, NX, TILE>(fWorkR.data(), fOutR.data(), 0, NY / TILE);
+	TransposeTiled<NY, NX, TILE>(fWorkI.data(), fOutI.data(), 0, NY / TILE);
+
+	for (uint x = 0; x < NX; ++x)
+	{
+		const uint uOffset = x * NY;
+		sm_fftY::TransformForward(
+			*reinterpret_cast<const RowY*>(fOutR + uOffset), *reinterpret_cast<const RowY*>(fOutI + uOffset),
+			*reinterpret_cast<RowY*>(fWorkR + uOffset), *reinterpret_cast<RowY*>(fWorkI + uOffset));
+	}
+
+	TransposeTiled<NX, NY, TILE>(fWorkR.data(), fOutR.data(), 0, NX / TILE);
+	TransposeTiled<NX, NY, TILE>(fWorkI.data(), fOutI.data(), 0, NX / TILE);
+}
+
+template <uint MX, uint MY, typename T>
+void FFT2D_Real<MX, MY, T>::TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N_2>& fOutR, FixedArray<T, N_2>& fOutI, FixedArray<T, NY>& fNyquistR, FixedArray<T, NY>& fNyquistI, FixedArray<T, N_2>& fWorkR, FixedArray<T, N_2>& fWorkI)
+{
+	FFTL_ASSERT(fOutR.data() != fWorkR.data());
+
+	using RowX = FixedArray<T, NX>;
+	using RowX_2 = FixedArray<T, NX_2>;
+	using RowY = FixedArray<T, NY>;
+
+	for (uint y = 0; y < NY; ++y)
+	{
+		sm_fftX::TransformForward(*reinterpret_cast<const RowX*>(fIn + y * NX),
+			*reinterpret_cast<RowX_2*>(fWorkR + y * NX_2), *reinterpret_cast<RowX_2*>(fWorkI + y * NX_2));
+	}
+
+	TransposeTiled<NY, NX_2, TILE>(fWorkR.data(), fOutR.data(), 0, NY / TILE);
+	TransposeTiled<NY, NX_2, TILE>(fWorkI.data(), fOutI.data(), 0, NY / TILE);
+
+	//	Row 0 holds DC + i * Nyquist of every input row, so its transform is Z = A + i * B, with A and B the transforms of the real DC
+	// and Nyquist columns. The other rows are ordinary complex columns.
+	for (uint x = 0; x < NX_2; ++x)
+	{
+		const uint uOffset = x * NY;
+		sm_fftY::TransformForward(
+			*reinterpret_cast<const RowY*>(fOutR + uOffset), *reinterpret_cast<const RowY*>(fOutI + uOffset),
+			*reinterpret_cast<RowY*>(fWorkR + uOffset), *reinterpret_cast<RowY*>(fWorkI + uOffset));
+	}
+
+	//	A and B are Hermitian, so A[k] = (Z[k] + conj(Z[-k])) / 2 and B[k] = (Z[k] - conj(Z[-k])) / 2i.
+	T* pZR = fWorkR.data();
+	T* pZI = fWorkI.data();
+	for (uint k = 0; k <= NY / 2; ++k)
+	{
+		const uint j = (NY - k) & (NY - 1);
+		const T fZR = pZR[k];
+		const T fZI = pZI[k];
+		const T fWR = pZR[j];
+		const T fWI = pZI[j];
+
+		pZR[k] = static_cast<T>(0.5) * (fZR + fWR);
+		pZI[k] = static_cast<T>(0.5) * (fZI - fWI);
+		pZR[j] = pZR[k];
+		pZI[j] = -pZI[k];
+
+		fNyquistR[k] = static_cast<T>(0.5) * (fZI + fWI);
+		fNyquistI[k] = static_cast<T>(0.5) * (fWR - fZR);
+		fNyquistR[j] = fNyquistR[k];
+		fNyquistI[j] = -fNyquistI[k];
+	}
+
+	TransposeTiled<NX_2, NY, TILE>(fWorkR.data(), fOutR.data(), 0, NX_2 / TILE);
+	TransposeTiled<NX_2, NY, TILE>(fWorkI.data(), fOutI.data(), 0, NX_2 / TILE);
+}
+
+template <uint MX, uint MY, typename T>
+void FFT2D_Real<MX, MY, T>::TransformInverse(const FixedArray<T, N_2>& fInR, const FixedArray<T, N_2>& fInI, const FixedArray<T, NY>& fNyquistR, const FixedArray<T, NY>& fNyquistI, FixedArray<T, N>& fOut, FixedArray<T, N_2>& fWorkR, FixedArray<T, N_2>& fWorkI)
+{
+	FFTL_ASSERT(fInR.data() != fWorkR.data());
+
+	using RowX = FixedArray<T, NX>;
+	using RowX_2 = FixedArray<T, NX_2>;
+	using RowY = FixedArray<T, NY>;
+
+	TransposeTiled<NY, NX_2, TILE>(fInR.data(), fWorkR.data(), 0, NY / TILE);
+	TransposeTiled<NY, NX_2, TILE>(fInI.data(), fWorkI.data(), 0, NY / TILE);
+
+	//	Repack the DC and Nyquist columns as A + i * B, so the inverse gives DC + i * Nyquist, which is how FFT_Real expects them.
+	for (uint k = 0; k < NY; ++k)
+	{
+		const T fAR = fWorkR[k];
+		const T fAI = fWorkI[k];
+		fWorkR[k] = fAR - fNyquistI[k];
+		fWorkI[k] = fAI + fNyquistR[k];
+	}
+
+	//	The output is twice the size of the spectrum, so its 2 halves hold the column transforms until the rows are done.
+	T* pTempR = fOut.data();
+	T* pTempI = fOut.data() + N_2;
+
+	for (uint x = 0; x < NX_2; ++x)
+	{
+		const uint uOffset = x * NY;
+		sm_fftY::TransformInverse(
+			*reinterpret_cast<const RowY*>(fWorkR + uOffset), *reinterpret_cast<const RowY*>(fWorkI + uOffset),
+			*reinterpret_cast<RowY*>(pTempR + uOffset), *reinterpret_cast<RowY*>(pTempI + uOffset));
+	}
+
+	TransposeTiled<NX_2, NY, TILE>(pTempR, fWorkR.data(), 0, NX_2 / TILE);
+	TransposeTiled<NX_2, NY, TILE>(pTempI, fWorkI.data(), 0, NX_2 / TILE);
+
+	for (uint y = 0; y < NY; ++y)
+	{
+		sm_fftX::TransformInverse(*reinterpret_cast<const RowX_2*>(fWorkR + y * NX_2), *reinterpret_cast<const RowX_2*>(fWorkI + y * NX_2),
+			*reinterpret_cast<RowX*>(fOut + y * NX));
+	}
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,136 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+#include "Transpose.h"
+#include "../Platform/ThreadPool.h"
+
+#include <memory>
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	In place 3D complex transform of NZ slabs of NY rows of NX elements, stored [z][y][x]. Built from the 1D FFT<M> kernels in 2 passes:
+//
+//		1. Slabs: each z slab gets FFT<MX> on its rows into a slab sized scratch buffer, then FFT<MY> down its columns back into place
+//		2. Pencils: FFT<MZ> down each of the NX * NY pencils along z
+//
+// Columns and pencils are done TILE at a time. A TILE wide block is transposed into a small contiguous buffer, the 1D transforms run on
+// its rows, and the result is transposed back, so the strided data is only touched in whole cache lines. Only the scratch memory for
+// 1 slab and 1 block is needed per thread, however large the volume is.
+//
+// Every slab and every block of pencils is independent, so the overloads taking a ThreadPool split each pass across its threads. The
+// instance owns the per thread scratch memory, so it has to be created with at least as many threads as any pool it's used with, and
+// 1 instance can't run more than 1 transform at a time.
+template <uint MX, uint MY, uint MZ, typename T = f32>
+class FFTL_NODISCARD FFT3D
+{
+	static_assert(MX >= 3 && MY >= 3 && MZ >= 3, "FFT3D needs at least 8 elements along each axis");
+
+public:
+	//	Precomputed constants
+	static constexpr uint NX = 1 << MX;
+	static constexpr uint NY = 1 << MY;
+	static constexpr uint NZ = 1 << MZ;
+	static constexpr uint NXY = NX * NY;
+	static constexpr uint N = NXY * NZ;
+
+	explicit FFT3D(uint uMaxThreadCount = 1);
+
+	void TransformForward(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI) const
+	{
+		Transform(fInOutR, fInOutI, nullptr);
+	}
+	void TransformForward(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI, ThreadPool& pool) const
+	{
+		Transform(fInOutR, fInOutI, &pool);
+	}
+
+	//	No divide by N. Swap the real and imaginary parts.
+	void TransformInverse(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI) const
+	{
+		Transform(fInOutI, fInOutR, nullptr);
+	}
+	void TransformInverse(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI, ThreadPool& pool) const
+	{
+		Transform(fInOutI, fInOutR, &pool);
+	}
+
+private:
+	static constexpr uint MIN_N = NX < NY ? (NX < NZ ? NX : NZ) : (NY < NZ ? NY : NZ);
+	static constexpr uint MAX_YZ = NY > NZ ? NY : NZ;
+	static constexpr uint TILE = MIN_N < 16 ? MIN_N : 16;
+
+	struct Scratch
+	{
+		FixedArray_Aligned32<T, NXY> m_SlabR;
+		FixedArray_Aligned32<T, NXY> m_SlabI;
+		FixedArray_Aligned32<T, TILE * MAX_YZ> m_BlockR;
+		FixedArray_Aligned32<T, TILE * MAX_YZ> m_BlockI;
+		FixedArray_Aligned32<T, TILE * MAX_YZ> m_BlockOutR;
+		FixedArray_Aligned32<T, TILE * MAX_YZ> m_BlockOutI;
+	};
+
+	void Transform(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI, ThreadPool* pPool) const;
+
+	//	Runs func(uThread, uBegin, uEnd) over 0 to uCount, across the pool if there is one.
+	template <typename T_Functor> static void ForRange(ThreadPool* pPool, uint uCount, const T_Functor& func);
+
+	//	FFT<MROWS> down the columns of a (1 << MROWS) x COLS matrix, for blocks of TILE columns uBlockBegin to uBlockEnd. In and out may be
+	// the same matrix.
+	template <uint MROWS, uint COLS> static void TransformColumns(const T* pInR, const T* pInI, T* pOutR, T* pOutI, uint uBlockBegin, uint uBlockEnd, Scratch& scratch);
+
+	std::unique_ptr<Scratch[]> m_pScratch;
+	uint m_uScratchCount;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT3D.inl"
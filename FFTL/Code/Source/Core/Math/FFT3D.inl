@@ -0,0 +1,127 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint MX, uint MY, uint MZ, typename T>
+FFT3D<MX, MY, MZ, T>::FFT3D(uint uMaxThreadCount)
+	: m_pScratch(std::make_unique<Scratch[]>(uMaxThreadCount > 1 ? uMaxThreadCount : 1))
+	, m_uScratchCount(uMaxThreadCount > 1 ? uMaxThreadCount : 1)
+{
+}
+
+template <uint MX, uint MY, uint MZ, typename T>
+void FFT3D<MX, MY, MZ, T>::Transform(FixedArray<T, N>& fInOutR, FixedArray<T, N>& fInOutI, ThreadPool* pPool) const
+{
+	FFTL_ASSERT(pPool == nullptr || pPool->GetThreadCount() <= m_uScratchCount);
+
+	using RowX = FixedArray<T, NX>;
+
+	ForRange(pPool, NZ, [&](uint uThread, uint uBegin, uint uEnd)
+	{
+		Scratch& scratch = m_pScratch[uThread];
+		for (uint z = uBegin; z < uEnd; ++z)
+		{
+			T* pSlabR = fInOutR + z * NXY;
+			T* pSlabI = fInOutI + z * NXY;
+
+			for (uint y = 0; y < NY; ++y)
+			{
+				const uint uOffset = y * NX;
+				FFT<MX, T>::TransformForward(
+					*reinterpret_cast<const RowX*>(pSlabR + uOffset), *reinterpret_cast<const RowX*>(pSlabI + uOffset),
+					*reinterpret_cast<RowX*>(scratch.m_SlabR + uOffset), *reinterpret_cast<RowX*>(scratch.m_SlabI + uOffset));
+			}
+
+			TransformColumns<MY, NX>(scratch.m_SlabR.data(), scratch.m_SlabI.data(), pSlabR, pSlabI, 0, NX / TILE, scratch);
+		}
+	});
+
+	//	The volume is an NZ x NXY matrix, with a pencil down each column.
+	ForRange(pPool, NXY / TILE, [&](uint uThread, uint uBegin, uint uEnd)
+	{
+		TransformColumns<MZ, NXY>(fInOutR.data(), fInOutI.data(), fInOutR.data(), fInOutI.data(), uBegin, uEnd, m_pScratch[uThread]);
+	});
+}
+
+template <uint MX, uint MY, uint MZ, typename T>
+template <typename T_Functor>
+FFTL_FORCEINLINE void FFT3D<MX, MY, MZ, T>::ForRange(ThreadPool* pPool, uint uCount, const T_Functor& func)
+{
+	if (pPool != nullptr)
+		pPool->ParallelForThreads(uCount, func);
+	else
+		func(0, 0, uCount);
+}
+
+template <uint MX, uint MY, uint MZ, typename T>
+template <uint MROWS, uint COLS>
+FFTL_FORCEINLINE void FFT3D<MX, MY, MZ, T>::TransformColumns(const T* pInR, const T* pInI, T* pOutR, T* pOutI, uint uBlockBegin, uint uBlockEnd, Scratch& scratch)
+{
+	constexpr uint ROWS = 1 << MROWS;
+	using Row = FixedArray<T, ROWS>;
+
+	T* pBlockR = scratch.m_BlockR.data();
+	T* pBlockI = scratch.m_BlockI.data();
+	T* pBlockOutR = scratch.m_BlockOutR.data();
+	T* pBlockOutI = scratch.m_BlockOutI.data();
+
+	for (uint b = uBlockBegin; b < uBlockEnd; ++b)
+	{
+		const uint c = b * TILE;
+
+		//	TILE columns become TILE contiguous rows of ROWS elements
+		for (uint r = 0; r < ROWS; r += TILE)
+		{
+			TransposeTile<TILE>(pInR + r * COLS + c, COLS, pBlockR + r, ROWS);
+			TransposeTile<TILE>(pInI + r * COLS + c, COLS, pBlockI + r, ROWS);
+		}
+
+		for (uint t = 0; t < TILE; ++t)
+		{
+			const uint uOffset = t * ROWS;
+			FFT<MROWS, T>::TransformForward(
+				*reinterpret_cast<const Row*>(pBlockR + uOffset), *reinterpret_cast<const Row*>(pBlockI + uOffset),
+				*reinterpret_cast<Row*>(pBlockOutR + uOffset), *reinterpret_cast<Row*>(pBlockOutI + uOffset));
+		}
+
+		for (uint r = 0; r < ROWS; r += TILE)
+		{
+			TransposeTile<TILE>(pBlockOutR + r, ROWS, pOutR + r * COLS + c, COLS);
+			TransposeTile<TILE>(pBlockOutI + r, ROWS, pOutI + r * COLS + c, COLS);
+		}
+	}
+}
+
+
+} // namespace FFTL
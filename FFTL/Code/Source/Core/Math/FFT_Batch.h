@@ -0,0 +1,116 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Runs many independent complex transforms of the same size, one channel per SIMD lane. FFT<M, f32_4> and FFT<M, f32_8> already
+// do the work for 4 or 8 channels at once, but they expect the channels interleaved into lanes. This takes K separate planar
+// buffers per call instead, and takes care of the transpose into and out of lanes:
+//
+//		1. Channels are gathered 4 at a time with 4x4 register transposes into a lane buffer (8 channels per group with AVX)
+//		2. In place DIF transform on the lane buffer, all channels of the group at once
+//		3. The bit reversed result is transposed back out in natural order
+//
+// K doesn't need to be a multiple of the lane count. The leftover channels of the last group run with the unused lanes zeroed,
+// dropping down to 4 lanes when no more than 4 are left over, rather than falling back to single channel transforms.
+//
+// Each channel is given by a pointer in ppR[c] and ppI[c]. Channel buffers need no particular alignment. Passing null for a whole
+// pointer array of the input treats it as all zeros, so a batch of real signals can pass ppInI = nullptr. Output may alias input.
+// The lane buffer lives in the instance, so a single instance can't be shared between threads.
+template <uint M>
+class FFTL_NODISCARD FFT_Batch
+{
+	static_assert(M >= 2, "FFT_Batch transposes 4 elements of each channel at a time");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+	static constexpr uint LANES = static_cast<uint>(V::GetSize());
+
+	void TransformForward(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannelCount)
+	{
+		Transform(ppInR, ppInI, ppOutR, ppOutI, uChannelCount);
+	}
+
+	//	No divide by N. Swap the real and imaginary parts.
+	void TransformInverse(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannelCount)
+	{
+		Transform(ppInI, ppInR, ppOutI, ppOutR, uChannelCount);
+	}
+
+private:
+	void Transform(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannelCount);
+
+	//	Transforms up to V::GetSize() channels at once.
+	template <typename T_Lanes> void TransformGroup(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannels);
+
+	//	Element n to n+3 of each channel, transposed so v[k] holds element n+k of every channel.
+	template <typename T_Lanes> static void GatherLanes(const f32* const* ppIn, uint uChannels, uint n, T_Lanes (&v)[4]);
+	template <typename T_Lanes> static void ScatterLanes(f32* const* ppOut, uint uChannels, uint n, const T_Lanes (&v)[4]);
+
+	static void Load4x4(const f32* const* ppIn, uint uChannels, uint n, f32x4 (&v)[4]);
+	static void Store4x4(f32* const* ppOut, uint uChannels, uint n, const f32x4 (&v)[4]);
+	static void Transpose4x4(f32x4 (&v)[4]);
+
+	FixedArray_Aligned32<cxNumber<V>, N> m_Lanes;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_Batch.inl"
@@ -0,0 +1,172 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M>
+void FFT_Batch<M>::Transform(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannelCount)
+{
+	FFTL_ASSERT(ppOutR != nullptr && ppOutI != nullptr);
+
+	uint c = 0;
+	for (; c + LANES <= uChannelCount; c += LANES)
+	{
+		TransformGroup<V>(ppInR ? ppInR + c : nullptr, ppInI ? ppInI + c : nullptr, ppOutR + c, ppOutI + c, LANES);
+	}
+
+	const uint uRemaining = uChannelCount - c;
+	if (uRemaining == 0)
+		return;
+
+	if constexpr (LANES > 4)
+	{
+		if (uRemaining <= 4)
+		{
+			TransformGroup<f32x4>(ppInR ? ppInR + c : nullptr, ppInI ? ppInI + c : nullptr, ppOutR + c, ppOutI + c, uRemaining);
+			return;
+		}
+	}
+
+	TransformGroup<V>(ppInR ? ppInR + c : nullptr, ppInI ? ppInI + c : nullptr, ppOutR + c, ppOutI + c, uRemaining);
+}
+
+template <uint M>
+template <typename T_Lanes>
+void FFT_Batch<M>::TransformGroup(const f32* const* ppInR, const f32* const* ppInI, f32* const* ppOutR, f32* const* ppOutI, uint uChannels)
+{
+	using sm_fft = FFT<M, T_Lanes, f32>;
+
+	//	A narrower group just uses the front of the lane buffer.
+	static_assert(sizeof(FixedArray<cxNumber<T_Lanes>, N>) <= sizeof(m_Lanes));
+	FixedArray<cxNumber<T_Lanes>, N>& cxLanes = *reinterpret_cast<FixedArray<cxNumber<T_Lanes>, N>*>(m_Lanes.data());
+
+	T_Lanes vR[4];
+	T_Lanes vI[4];
+
+	for (uint n = 0; n < N; n += 4)
+	{
+		GatherLanes(ppInR, uChannels, n, vR);
+		GatherLanes(ppInI, uChannels, n, vI);
+		for (uint k = 0; k < 4; ++k)
+			cxLanes[n + k].Set(vR[k], vI[k]);
+	}
+
+	sm_fft::TransformForward_InPlace_DIF(cxLanes);
+
+	for (uint n = 0; n < N; n += 4)
+	{
+		for (uint k = 0; k < 4; ++k)
+		{
+			const cxNumber<T_Lanes>& cx = cxLanes[sm_fft::GetBitReverseIndex(n + k)];
+			vR[k] = cx.r;
+			vI[k] = cx.i;
+		}
+		ScatterLanes(ppOutR, uChannels, n, vR);
+		ScatterLanes(ppOutI, uChannels, n, vI);
+	}
+}
+
+template <uint M>
+template <typename T_Lanes>
+FFTL_FORCEINLINE void FFT_Batch<M>::GatherLanes(const f32* const* ppIn, uint uChannels, uint n, T_Lanes (&v)[4])
+{
+	f32x4 vLo[4];
+	Load4x4(ppIn, uChannels, n, vLo);
+
+	if constexpr (std::is_same_v<T_Lanes, f32x4>)
+	{
+		for (uint k = 0; k < 4; ++k)
+			v[k] = vLo[k];
+	}
+	else
+	{
+		f32x4 vHi[4];
+		Load4x4(ppIn ? ppIn + 4 : nullptr, uChannels > 4 ? uChannels - 4 : 0, n, vHi);
+		for (uint k = 0; k < 4; ++k)
+			v[k] = T_Lanes(vLo[k], vHi[k]);
+	}
+}
+
+template <uint M>
+template <typename T_Lanes>
+FFTL_FORCEINLINE void FFT_Batch<M>::ScatterLanes(f32* const* ppOut, uint uChannels, uint n, const T_Lanes (&v)[4])
+{
+	if constexpr (std::is_same_v<T_Lanes, f32x4>)
+	{
+		Store4x4(ppOut, uChannels, n, v);
+	}
+	else
+	{
+		const f32x4 vLo[4] = { v[0].Get0123(), v[1].Get0123(), v[2].Get0123(), v[3].Get0123() };
+		Store4x4(ppOut, uChannels, n, vLo);
+		if (uChannels > 4)
+		{
+			const f32x4 vHi[4] = { v[0].Get4567(), v[1].Get4567(), v[2].Get4567(), v[3].Get4567() };
+			Store4x4(ppOut + 4, uChannels - 4, n, vHi);
+		}
+	}
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT_Batch<M>::Load4x4(const f32* const* ppIn, uint uChannels, uint n, f32x4 (&v)[4])
+{
+	for (uint c = 0; c < 4; ++c)
+		v[c] = ppIn != nullptr && c < uChannels ? f32x4::LoadU(ppIn[c] + n) : f32x4::Zero();
+	Transpose4x4(v);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT_Batch<M>::Store4x4(f32* const* ppOut, uint uChannels, uint n, const f32x4 (&v)[4])
+{
+	f32x4 vT[4] = { v[0], v[1], v[2], v[3] };
+	Transpose4x4(vT);
+	for (uint c = 0; c < 4 && c < uChannels; ++c)
+		vT[c].StoreU(ppOut[c] + n);
+}
+
+template <uint M>
+FFTL_FORCEINLINE void FFT_Batch<M>::Transpose4x4(f32x4 (&v)[4])
+{
+	const f32x4 v01Lo = MergeXY(v[0], v[1]);
+	const f32x4 v23Lo = MergeXY(v[2], v[3]);
+	const f32x4 v01Hi = MergeZW(v[0], v[1]);
+	const f32x4 v23Hi = MergeZW(v[2], v[3]);
+
+	v[0] = Permute<0, 1, 4, 5>(v01Lo, v23Lo);
+	v[1] = Permute<2, 3, 6, 7>(v01Lo, v23Lo);
+	v[2] = Permute<0, 1, 4, 5>(v01Hi, v23Hi);
+	v[3] = Permute<2, 3, 6, 7>(v01Hi, v23Hi);
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,114 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Chirp-z transform using Bluestein's algorithm. Computes K bins of the DFT of N samples, for any N and K, at evenly spaced
+// frequencies along the unit circle:
+//
+//		X[k] = sum(n = 0 to N - 1) x[n] * e^(-i * n * (startAngle + k * stepAngle))
+//
+// With the default InitDFT(), this is the plain DFT of a length that need not be a power of 2, or even composite.
+// InitZoom() instead spreads the K bins over an arbitrary band at an arbitrary resolution, which is far cheaper than zero
+// padding a full band FFT out to the same bin spacing.
+//
+// The work is done by a pair of power of 2 FFT<M, f32> passes of at least N + K - 1 points, with a fixed chirp filter in
+// between. Those passes use the in-place DIF and DIT variants, like Convolver, so there is no bit reversal. Buffers are
+// members of the class, so a single instance should not transform on multiple threads at once.
+template <uint N, uint K = N>
+class FFTL_NODISCARD FFT_ChirpZ
+{
+public:
+	using T = f32;
+
+	//	Precomputed constants
+	static constexpr uint CalcM() { uint m = 3; while ((1u << m) < N + K - 1) ++m; return m; }
+	static constexpr uint M = CalcM();
+	static constexpr uint FFT_N = 1 << M;
+
+	using sm_fft = FFT<M, T>;
+
+	FFT_ChirpZ() { InitDFT(); }
+
+	//	Angles are in radians per sample.
+	void Init(f64 fStartAngle, f64 fStepAngle);
+
+	//	Bins k = 0 to K - 1 of the DFT of length N.
+	void InitDFT() { Init(0, 2 * PI_64 / N); }
+
+	//	K bins starting at fStartFreq, fStepFreq apart. Any units may be used, as long as they're the same as fSampleRate.
+	void InitZoom(f64 fStartFreq, f64 fStepFreq, f64 fSampleRate) { Init(2 * PI_64 * fStartFreq / fSampleRate, 2 * PI_64 * fStepFreq / fSampleRate); }
+
+	void Transform(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI);
+	void Transform(const FixedArray<T, N>& fInput, FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI);
+
+private:
+	void Transform_Main(FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI);
+
+	static void MultiplyComplex(const T* pfAR, const T* pfAI, const T* pfBR, const T* pfBI, T* pfOutR, T* pfOutI, uint uCount);
+	static void MultiplyReal(const T* pfA, const T* pfBR, const T* pfBI, T* pfOutR, T* pfOutI, uint uCount);
+
+	FixedArray_Aligned32<T, N> m_PreChirpR;		// e^(-i * n * startAngle) * W^(n^2 / 2), applied to the input
+	FixedArray_Aligned32<T, N> m_PreChirpI;
+	FixedArray_Aligned32<T, K> m_PostChirpR;	// W^(k^2 / 2), applied to the output
+	FixedArray_Aligned32<T, K> m_PostChirpI;
+	FixedArray_Aligned32<T, FFT_N> m_FilterR;	// Frequency domain W^(-m^2 / 2), in bit reversed order and divided by FFT_N
+	FixedArray_Aligned32<T, FFT_N> m_FilterI;
+
+	FixedArray_Aligned32<T, FFT_N> m_WorkR;
+	FixedArray_Aligned32<T, FFT_N> m_WorkI;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_ChirpZ.inl"
@@ -0,0 +1,167 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint N, uint K>
+void FFT_ChirpZ<N, K>::Init(f64 fStartAngle, f64 fStepAngle)
+{
+	//	n * k = (n^2 + k^2 - (k - n)^2) / 2, so with W = e^(-i * stepAngle), the sum becomes a convolution of the
+	// pre chirped input with W^(-m^2 / 2), followed by a post chirp. Angles are computed in double precision, since
+	// n^2 gets large enough to lose all the fractional bits of the phase in single precision.
+	const f64 fHalfStep = 0.5 * fStepAngle;
+
+	for (uint n = 0; n < N; ++n)
+	{
+		const f64 fAngle = -(fStartAngle * n + fHalfStep * (static_cast<f64>(n) * n));
+		m_PreChirpR[n] = static_cast<T>(Cos(fAngle));
+		m_PreChirpI[n] = static_cast<T>(Sin(fAngle));
+	}
+
+	for (uint k = 0; k < K; ++k)
+	{
+		const f64 fAngle = -fHalfStep * (static_cast<f64>(k) * k);
+		m_PostChirpR[k] = static_cast<T>(Cos(fAngle));
+		m_PostChirpI[k] = static_cast<T>(Sin(fAngle));
+	}
+
+	//	The filter spans lags -(N - 1) to K - 1, with the negative lags wrapped around to the end. Fold in the 1/FFT_N of
+	// the inverse transform here so it costs nothing per transform.
+	const f64 fScale = 1.0 / FFT_N;
+	MemZero(m_FilterR);
+	MemZero(m_FilterI);
+	for (uint m = 0; m < K; ++m)
+	{
+		const f64 fAngle = fHalfStep * (static_cast<f64>(m) * m);
+		m_FilterR[m] = static_cast<T>(fScale * Cos(fAngle));
+		m_FilterI[m] = static_cast<T>(fScale * Sin(fAngle));
+	}
+	for (uint m = 1; m < N; ++m)
+	{
+		const f64 fAngle = fHalfStep * (static_cast<f64>(m) * m);
+		m_FilterR[FFT_N - m] = static_cast<T>(fScale * Cos(fAngle));
+		m_FilterI[FFT_N - m] = static_cast<T>(fScale * Sin(fAngle));
+	}
+
+	sm_fft::TransformForward_InPlace_DIF(m_FilterR, m_FilterI);
+}
+
+template <uint N, uint K>
+void FFT_ChirpZ<N, K>::Transform(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI)
+{
+	MultiplyComplex(fInR.data(), fInI.data(), m_PreChirpR.data(), m_PreChirpI.data(), m_WorkR.data(), m_WorkI.data(), N);
+	Transform_Main(fOutR, fOutI);
+}
+
+template <uint N, uint K>
+void FFT_ChirpZ<N, K>::Transform(const FixedArray<T, N>& fInput, FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI)
+{
+	MultiplyReal(fInput.data(), m_PreChirpR.data(), m_PreChirpI.data(), m_WorkR.data(), m_WorkI.data(), N);
+	Transform_Main(fOutR, fOutI);
+}
+
+template <uint N, uint K>
+FFTL_FORCEINLINE void FFT_ChirpZ<N, K>::Transform_Main(FixedArray<T, K>& fOutR, FixedArray<T, K>& fOutI)
+{
+	MemZero(m_WorkR.data() + N, FFT_N - N);
+	MemZero(m_WorkI.data() + N, FFT_N - N);
+
+	//	Both the work buffer and the filter end up in the same bit reversed order, which the inverse DIT transform expects.
+	sm_fft::TransformForward_InPlace_DIF(m_WorkR, m_WorkI);
+	MultiplyComplex(m_WorkR.data(), m_WorkI.data(), m_FilterR.data(), m_FilterI.data(), m_WorkR.data(), m_WorkI.data(), FFT_N);
+	sm_fft::TransformInverse_InPlace_DIT(m_WorkR, m_WorkI);
+
+	MultiplyComplex(m_WorkR.data(), m_WorkI.data(), m_PostChirpR.data(), m_PostChirpI.data(), fOutR.data(), fOutI.data(), K);
+}
+
+template <uint N, uint K>
+FFTL_FORCEINLINE void FFT_ChirpZ<N, K>::MultiplyComplex(const T* pfAR, const T* pfAI, const T* pfBR, const T* pfBI, T* pfOutR, T* pfOutI, uint uCount)
+{
+	uint n = 0;
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#elif FFTL_SIMD_F32x4
+	using V = f32x4;
+#endif
+#if FFTL_SIMD_F32x4
+	constexpr uint nWidth = sizeof(V) / sizeof(T);
+	for (; n + nWidth <= uCount; n += nWidth)
+	{
+		const V vAR = V::LoadU(pfAR + n);
+		const V vAI = V::LoadU(pfAI + n);
+		const V vBR = V::LoadU(pfBR + n);
+		const V vBI = V::LoadU(pfBI + n);
+		StoreU(pfOutR + n, SubMul(vAR * vBR, vAI, vBI));
+		StoreU(pfOutI + n, AddMul(vAR * vBI, vAI, vBR));
+	}
+#endif
+
+	for (; n < uCount; ++n)
+	{
+		const T fAR = pfAR[n];
+		const T fAI = pfAI[n];
+		pfOutR[n] = fAR * pfBR[n] - fAI * pfBI[n];
+		pfOutI[n] = fAR * pfBI[n] + fAI * pfBR[n];
+	}
+}
+
+template <uint N, uint K>
+FFTL_FORCEINLINE void FFT_ChirpZ<N, K>::MultiplyReal(const T* pfA, const T* pfBR, const T* pfBI, T* pfOutR, T* pfOutI, uint uCount)
+{
+	uint n = 0;
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#elif FFTL_SIMD_F32x4
+	using V = f32x4;
+#endif
+#if FFTL_SIMD_F32x4
+	constexpr uint nWidth = sizeof(V) / sizeof(T);
+	for (; n + nWidth <= uCount; n += nWidth)
+	{
+		const V vA = V::LoadU(pfA + n);
+		StoreU(pfOutR + n, vA * V::LoadU(pfBR + n));
+		StoreU(pfOutI + n, vA * V::LoadU(pfBI + n));
+	}
+#endif
+
+	for (; n < uCount; ++n)
+	{
+		pfOutR[n] = pfA[n] * pfBR[n];
+		pfOutI[n] = pfA[n] * pfBI[n];
+	}
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,155 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	DCT-II by way of a real FFT of the same size (Makhoul). The even samples in order followed by the odd samples in reverse make a
+// sequence whose FFT V[k] gives X[k] = Re(e^(-i * pi * k / 2N) * V[k]), and X[N - k] comes from the imaginary part of the same product,
+// so only the N / 2 bins that FFT_Real returns are needed. The inverse runs the same steps backwards. The work buffers live in the
+// instance, so a single instance can't be shared between threads.
+template <uint M>
+class FFTL_NODISCARD FFT_DCT2
+{
+	static_assert(M >= 5, "FFT_DCT2 needs at least 32 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N / 2;
+
+	using T = f32;
+	using sm_fft = FFT_Real<M, T>;
+
+	FFT_DCT2();
+
+	//	X[k] = sum(x[n] * cos(pi / N * (n + 1/2) * k))
+	void TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut);
+
+	//	DCT-III, x[n] = 2 / N * (X[0] / 2 + sum(X[k] * cos(pi / N * k * (n + 1/2)))), which is the exact inverse of TransformForward().
+	void TransformInverse(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut);
+
+private:
+	FixedArray_Aligned32<T, N_2> m_TwiddleR;	// e^(-i * pi * k / 2N)
+	FixedArray_Aligned32<T, N_2> m_TwiddleI;
+
+	FixedArray_Aligned32<T, N> m_Work;
+	FixedArray_Aligned32<T, N_2> m_WorkR;
+	FixedArray_Aligned32<T, N_2> m_WorkI;
+};
+
+
+//	DCT-IV by way of a complex FFT of half the size. Even samples become the real parts and odd samples in reverse the imaginary parts,
+// with a twiddle multiply either side of the FFT. As with FFT_DCT2, an instance can't be shared between threads.
+template <uint M>
+class FFTL_NODISCARD FFT_DCT4
+{
+	static_assert(M >= 4, "FFT_DCT4 needs at least 16 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N / 2;
+
+	using T = f32;
+	using sm_fft = FFT<M - 1, T>;
+
+	FFT_DCT4();
+
+	//	X[k] = sum(x[n] * cos(pi / N * (n + 1/2) * (k + 1/2))). The DCT-IV is its own inverse, scaled by N / 2.
+	void Transform(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut);
+
+private:
+	FixedArray_Aligned32<T, N_2> m_PreTwiddleR;	// e^(-i * pi * (n + 1/4) / N)
+	FixedArray_Aligned32<T, N_2> m_PreTwiddleI;
+	FixedArray_Aligned32<T, N_2> m_PostTwiddleR;	// e^(-i * pi * k / N)
+	FixedArray_Aligned32<T, N_2> m_PostTwiddleI;
+
+	FixedArray_Aligned32<T, N_2> m_WorkR;
+	FixedArray_Aligned32<T, N_2> m_WorkI;
+	FixedArray_Aligned32<T, N_2> m_WorkOutR;
+	FixedArray_Aligned32<T, N_2> m_WorkOutI;
+};
+
+
+//	MDCT of N samples to N / 2 coefficients. The 4 quarters of the input are folded into the N / 2 point DCT-IV, so the whole thing
+// comes down to an N / 4 point complex FFT. The inverse is the DCT-IV, unfolded. Windowing is left to the caller. As with FFT_DCT2,
+// an instance can't be shared between threads.
+template <uint M>
+class FFTL_NODISCARD FFT_MDCT
+{
+	static_assert(M >= 5, "FFT_MDCT needs at least 32 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N / 2;
+	static constexpr uint N_4 = N / 4;
+
+	using T = f32;
+
+	//	X[k] = sum(x[n] * cos(2 * pi / N * (n + 1/2 + N / 4) * (k + 1/2))), for k = 0 to N / 2 - 1
+	void TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N_2>& fOut);
+
+	//	y[n] = sum(X[k] * cos(2 * pi / N * (n + 1/2 + N / 4) * (k + 1/2))), for n = 0 to N - 1. Windowing both transforms with a
+	// Princen-Bradley window and overlap adding by N / 2 gives the input back, scaled by N / 4.
+	void TransformInverse(const FixedArray<T, N_2>& fIn, FixedArray<T, N>& fOut);
+
+private:
+	FFT_DCT4<M - 1> m_DCT4;
+
+	FixedArray_Aligned32<T, N_2> m_Work;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_DCT.inl"
@@ -0,0 +1,311 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M>
+FFT_DCT2<M>::FFT_DCT2()
+{
+	for (uint k = 0; k < N_2; ++k)
+	{
+		const f64 fAngle = -PI_64 * k / (2 * N);
+		m_TwiddleR[k] = static_cast<T>(Cos(fAngle));
+		m_TwiddleI[k] = static_cast<T>(Sin(fAngle));
+	}
+}
+
+template <uint M>
+void FFT_DCT2<M>::TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut)
+{
+	const T* pIn = fIn.data();
+	T* pOut = fOut.data();
+	T* pWork = m_Work.data();
+	const T* pWorkR = m_WorkR.data();
+	const T* pWorkI = m_WorkI.data();
+	const T* pTwR = m_TwiddleR.data();
+	const T* pTwI = m_TwiddleI.data();
+
+	//	Even samples in order, then odd samples reversed
+	uint n = 0;
+#if FFTL_SIMD_F32x4
+	for (; n < N_2; n += 4)
+	{
+		const f32x4 v0 = f32x4::LoadU(pIn + 2 * n + 0);
+		const f32x4 v1 = f32x4::LoadU(pIn + 2 * n + 4);
+		SplitXZ(v0, v1).StoreA(pWork + n);
+		Permute<3, 2, 1, 0>(SplitYW(v0, v1)).StoreA(pWork + N - 4 - n);
+	}
+#endif
+	for (; n < N_2; ++n)
+	{
+		pWork[n] = pIn[2 * n + 0];
+		pWork[N - 1 - n] = pIn[2 * n + 1];
+	}
+
+	sm_fft::TransformForward(m_Work, m_WorkR, m_WorkI);
+
+	//	Bin 0 holds the DC and Nyquist bins, which are both real
+	pOut[0] = pWorkR[0];
+	pOut[N_2] = pWorkI[0] * INV_SQRT2;
+
+	//	Y = e^(-i * pi * k / 2N) * V[k], X[k] = Re(Y), X[N - k] = -Im(Y)
+	uint k = 1;
+	for (; k < 4; ++k)
+	{
+		pOut[k] = pWorkR[k] * pTwR[k] - pWorkI[k] * pTwI[k];
+		pOut[N - k] = -(pWorkR[k] * pTwI[k] + pWorkI[k] * pTwR[k]);
+	}
+#if FFTL_SIMD_F32x4
+	for (; k < N_2; k += 4)
+	{
+		const f32x4 vR = f32x4::LoadA(pWorkR + k);
+		const f32x4 vI = f32x4::LoadA(pWorkI + k);
+		const f32x4 vTwR = f32x4::LoadA(pTwR + k);
+		const f32x4 vTwI = f32x4::LoadA(pTwI + k);
+		SubMul(vR * vTwR, vI, vTwI).StoreU(pOut + k);
+		Permute<3, 2, 1, 0>(f32x4::Zero() - AddMul(vR * vTwI, vI, vTwR)).StoreU(pOut + N - 3 - k);
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		pOut[k] = pWorkR[k] * pTwR[k] - pWorkI[k] * pTwI[k];
+		pOut[N - k] = -(pWorkR[k] * pTwI[k] + pWorkI[k] * pTwR[k]);
+	}
+}
+
+template <uint M>
+void FFT_DCT2<M>::TransformInverse(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut)
+{
+	const T* pIn = fIn.data();
+	T* pOut = fOut.data();
+	const T* pWork = m_Work.data();
+	T* pWorkR = m_WorkR.data();
+	T* pWorkI = m_WorkI.data();
+	const T* pTwR = m_TwiddleR.data();
+	const T* pTwI = m_TwiddleI.data();
+
+	pWorkR[0] = pIn[0];
+	pWorkI[0] = pIn[N_2] * (2 * INV_SQRT2);
+
+	//	Y = X[k] - i * X[N - k], V[k] = e^(i * pi * k / 2N) * Y
+	uint k = 1;
+	for (; k < 4; ++k)
+	{
+		pWorkR[k] = pIn[k] * pTwR[k] - pIn[N - k] * pTwI[k];
+		pWorkI[k] = -(pIn[N - k] * pTwR[k] + pIn[k] * pTwI[k]);
+	}
+#if FFTL_SIMD_F32x4
+	for (; k < N_2; k += 4)
+	{
+		const f32x4 vYR = f32x4::LoadU(pIn + k);
+		const f32x4 vNegYI = Permute<3, 2, 1, 0>(f32x4::LoadU(pIn + N - 3 - k));
+		const f32x4 vTwR = f32x4::LoadA(pTwR + k);
+		const f32x4 vTwI = f32x4::LoadA(pTwI + k);
+		SubMul(vYR * vTwR, vNegYI, vTwI).StoreA(pWorkR + k);
+		(f32x4::Zero() - AddMul(vNegYI * vTwR, vYR, vTwI)).StoreA(pWorkI + k);
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		pWorkR[k] = pIn[k] * pTwR[k] - pIn[N - k] * pTwI[k];
+		pWorkI[k] = -(pIn[N - k] * pTwR[k] + pIn[k] * pTwI[k]);
+	}
+
+	sm_fft::TransformInverse(m_WorkR, m_WorkI, m_Work);
+
+	//	Undo the even / odd reordering
+	uint n = 0;
+#if FFTL_SIMD_F32x4
+	for (; n < N_2; n += 4)
+	{
+		const f32x4 vEven = f32x4::LoadA(pWork + n);
+		const f32x4 vOdd = Permute<3, 2, 1, 0>(f32x4::LoadA(pWork + N - 4 - n));
+		MergeXY(vEven, vOdd).StoreU(pOut + 2 * n + 0);
+		MergeZW(vEven, vOdd).StoreU(pOut + 2 * n + 4);
+	}
+#endif
+	for (; n < N_2; ++n)
+	{
+		pOut[2 * n + 0] = pWork[n];
+		pOut[2 * n + 1] = pWork[N - 1 - n];
+	}
+}
+
+template <uint M>
+FFT_DCT4<M>::FFT_DCT4()
+{
+	for (uint n = 0; n < N_2; ++n)
+	{
+		const f64 fPreAngle = -PI_64 * (n + 0.25) / N;
+		m_PreTwiddleR[n] = static_cast<T>(Cos(fPreAngle));
+		m_PreTwiddleI[n] = static_cast<T>(Sin(fPreAngle));
+
+		const f64 fPostAngle = -PI_64 * n / N;
+		m_PostTwiddleR[n] = static_cast<T>(Cos(fPostAngle));
+		m_PostTwiddleI[n] = static_cast<T>(Sin(fPostAngle));
+	}
+}
+
+template <uint M>
+void FFT_DCT4<M>::Transform(const FixedArray<T, N>& fIn, FixedArray<T, N>& fOut)
+{
+	const T* pIn = fIn.data();
+	T* pOut = fOut.data();
+	T* pWorkR = m_WorkR.data();
+	T* pWorkI = m_WorkI.data();
+	const T* pPreR = m_PreTwiddleR.data();
+	const T* pPreI = m_PreTwiddleI.data();
+	const T* pPostR = m_PostTwiddleR.data();
+	const T* pPostI = m_PostTwiddleI.data();
+
+	//	z[n] = (x[2n] + i * x[N - 1 - 2n]) * e^(-i * pi * (n + 1/4) / N)
+	uint n = 0;
+#if FFTL_SIMD_F32x4
+	for (; n < N_2; n += 4)
+	{
+		const f32x4 vR = SplitXZ(f32x4::LoadU(pIn + 2 * n + 0), f32x4::LoadU(pIn + 2 * n + 4));
+		const f32x4 vI = Permute<3, 2, 1, 0>(SplitYW(f32x4::LoadU(pIn + N - 8 - 2 * n), f32x4::LoadU(pIn + N - 4 - 2 * n)));
+		const f32x4 vTwR = f32x4::LoadA(pPreR + n);
+		const f32x4 vTwI = f32x4::LoadA(pPreI + n);
+		SubMul(vR * vTwR, vI, vTwI).StoreA(pWorkR + n);
+		AddMul(vR * vTwI, vI, vTwR).StoreA(pWorkI + n);
+	}
+#endif
+	for (; n < N_2; ++n)
+	{
+		const T fR = pIn[2 * n];
+		const T fI = pIn[N - 1 - 2 * n];
+		pWorkR[n] = fR * pPreR[n] - fI * pPreI[n];
+		pWorkI[n] = fR * pPreI[n] + fI * pPreR[n];
+	}
+
+	sm_fft::TransformForward(m_WorkR, m_WorkI, m_WorkOutR, m_WorkOutI);
+
+	//	d[k] = Z[k] * e^(-i * pi * k / N)
+	const T* pZR = m_WorkOutR.data();
+	const T* pZI = m_WorkOutI.data();
+	uint k = 0;
+#if FFTL_SIMD_F32x4
+	for (; k < N_2; k += 4)
+	{
+		const f32x4 vR = f32x4::LoadA(pZR + k);
+		const f32x4 vI = f32x4::LoadA(pZI + k);
+		const f32x4 vTwR = f32x4::LoadA(pPostR + k);
+		const f32x4 vTwI = f32x4::LoadA(pPostI + k);
+		SubMul(vR * vTwR, vI, vTwI).StoreA(pWorkR + k);
+		AddMul(vR * vTwI, vI, vTwR).StoreA(pWorkI + k);
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		pWorkR[k] = pZR[k] * pPostR[k] - pZI[k] * pPostI[k];
+		pWorkI[k] = pZR[k] * pPostI[k] + pZI[k] * pPostR[k];
+	}
+
+	//	X[2k] = Re(d[k]), X[N - 1 - 2k] = -Im(d[k])
+	k = 0;
+#if FFTL_SIMD_F32x4
+	for (; k < N_2; k += 4)
+	{
+		const f32x4 vEven = f32x4::LoadA(pWorkR + k);
+		const f32x4 vOdd = f32x4::Zero() - Permute<3, 2, 1, 0>(f32x4::LoadA(pWorkI + N_2 - 4 - k));
+		MergeXY(vEven, vOdd).StoreU(pOut + 2 * k + 0);
+		MergeZW(vEven, vOdd).StoreU(pOut + 2 * k + 4);
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		pOut[2 * k] = pWorkR[k];
+		pOut[N - 1 - 2 * k] = -pWorkI[k];
+	}
+}
+
+template <uint M>
+void FFT_MDCT<M>::TransformForward(const FixedArray<T, N>& fIn, FixedArray<T, N_2>& fOut)
+{
+	const T* pIn = fIn.data();
+	T* pWork = m_Work.data();
+
+	//	With the input as quarters a, b, c, d, the DCT-IV input is (-c_reversed - d, a - b_reversed)
+	uint n = 0;
+#if FFTL_SIMD_F32x4
+	for (; n < N_4; n += 4)
+	{
+		const f32x4 vC = Permute<3, 2, 1, 0>(f32x4::LoadU(pIn + 3 * N_4 - 4 - n));
+		const f32x4 vD = f32x4::LoadU(pIn + 3 * N_4 + n);
+		(f32x4::Zero() - vC - vD).StoreA(pWork + n);
+
+		const f32x4 vA = f32x4::LoadU(pIn + n);
+		const f32x4 vB = Permute<3, 2, 1, 0>(f32x4::LoadU(pIn + N_2 - 4 - n));
+		(vA - vB).StoreA(pWork + N_4 + n);
+	}
+#endif
+	for (; n < N_4; ++n)
+	{
+		pWork[n] = -pIn[3 * N_4 - 1 - n] - pIn[3 * N_4 + n];
+		pWork[N_4 + n] = pIn[n] - pIn[N_2 - 1 - n];
+	}
+
+	m_DCT4.Transform(m_Work, fOut);
+}
+
+template <uint M>
+void FFT_MDCT<M>::TransformInverse(const FixedArray<T, N_2>& fIn, FixedArray<T, N>& fOut)
+{
+	m_DCT4.Transform(fIn, m_Work);
+
+	const T* pWork = m_Work.data();
+	T* pOut = fOut.data();
+
+	//	With the DCT-IV output as halves w1, w2, the output is (w2, -w2_reversed, -w1_reversed, -w1)
+	uint n = 0;
+#if FFTL_SIMD_F32x4
+	for (; n < N_4; n += 4)
+	{
+		f32x4::LoadA(pWork + N_4 + n).StoreU(pOut + n);
+		(f32x4::Zero() - Permute<3, 2, 1, 0>(f32x4::LoadA(pWork + N_2 - 4 - n))).StoreU(pOut + N_4 + n);
+		(f32x4::Zero() - Permute<3, 2, 1, 0>(f32x4::LoadA(pWork + N_4 - 4 - n))).StoreU(pOut + N_2 + n);
+		(f32x4::Zero() - f32x4::LoadA(pWork + n)).StoreU(pOut + 3 * N_4 + n);
+	}
+#endif
+	for (; n < N_4; ++n)
+	{
+		pOut[n] = pWork[N_4 + n];
+		pOut[N_4 + n] = -pWork[N_2 - 1 - n];
+		pOut[N_2 + n] = -pWork[N_4 - 1 - n];
+		pOut[3 * N_4 + n] = -pWork[n];
+	}
+}
+
+
+} // namespace FFTL
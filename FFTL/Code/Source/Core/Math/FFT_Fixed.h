@@ -0,0 +1,171 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+#include <memory>
+
+#if defined(FFTL_AVX2)
+#	include <immintrin.h>
+#elif defined(FFTL_SSE4)
+#	include <tmmintrin.h>
+#	include <smmintrin.h>
+#endif
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+namespace FFTL
+{
+
+
+//	Fixed point complex FFT of split s16 (Q15) or s32 (Q31) data, with block floating point scaling. Each radix 2 stage tracks
+// the largest magnitude it writes, and the next stage shifts its inputs down by 0, 1 or 2 bits, just enough that its butterflies
+// can't overflow. The transforms return the total number of bits shifted out, the block exponent, so the unnormalized result is
+// the output times 2^exponent. Quiet signals keep all of their precision, and loud ones only lose as many bits as the transform
+// actually grows them by.
+//
+// Twiddles are stored in the same Q format as the data, and products are rounded the way pmulhrsw rounds them. With SSE4 or
+// AVX2, every stage runs on integer vectors, and transforms too small to fill a pair of vectors are scalar.
+template <uint M, typename T>
+class FFTL_NODISCARD FFT_Fixed
+{
+	static_assert(std::is_same_v<T, s16> || std::is_same_v<T, s32>, "FFT_Fixed works on s16 (Q15) or s32 (Q31) data");
+	static_assert(M >= 1, "FFT_Fixed needs at least 2 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+
+	FFT_Fixed() = delete;
+
+	//	Both return the block exponent. The inverse is unnormalized, same as FFT<M, T>::TransformInverse, so a round trip gives
+	// N times the input after applying both exponents.
+	FFTL_NODISCARD static int TransformForward(const FixedArray<T, N>& inR, const FixedArray<T, N>& inI, FixedArray<T, N>& outR, FixedArray<T, N>& outI);
+	FFTL_NODISCARD static int TransformInverse(const FixedArray<T, N>& inR, const FixedArray<T, N>& inI, FixedArray<T, N>& outR, FixedArray<T, N>& outI);
+
+private:
+	template <uint, typename> friend class FFT_Real_Fixed;
+
+	static constexpr uint BITS = sizeof(T) * 8;
+	using T_Wide = typename std::conditional<std::is_same_v<T, s16>, s32, s64>::type;
+
+	struct Tables
+	{
+		Tables();
+
+		//	The twiddles of the stage with butterfly span h start at index h, so every stage reads its own with unit stride.
+		alignas(32) FixedArray<T, N> m_R;
+		alignas(32) FixedArray<T, N> m_I;
+	};
+
+	template <uint STRIDE> static int Transform(const T* pInR, const T* pInI, T* pOutR, T* pOutI, u32& uMagnitudeBits);
+	template <uint STRIDE> static void BitReverseCopy(const T* pInR, const T* pInI, T* pOutR, T* pOutI);
+	static u32 Stage(T* pR, T* pI, uint h, uint uShift, const Tables& twiddles);
+
+	FFTL_NODISCARD static u32 GetMagnitudeBits(const T* p, uint uCount);
+	FFTL_NODISCARD static uint GetShift(u32 uMagnitudeBits);
+	FFTL_NODISCARD static T Quantize(f64 f, f64 fScale);
+	FFTL_NODISCARD static FFTL_FORCEINLINE u32 GetMagnitudeBits(T x) { return static_cast<u32>(x ^ (x >> (BITS - 1))); }
+	static FFTL_FORCEINLINE void MulComplex(T ar, T ai, T br, T bi, T& outR, T& outI);
+
+#if defined(FFTL_AVX2)
+	using V = __m256i;
+#elif defined(FFTL_SSE4)
+	using V = __m128i;
+#endif
+#if defined(FFTL_SSE4)
+	static constexpr uint LANES = sizeof(V) / sizeof(T);
+
+	//	Stages with a span of less than a vector deinterleave each pair of vectors into the 2 halves of its butterflies, and
+	// interleave the results back again. H is the span, and the stages run through to the first one wide enough for Stage_SIMD.
+	template <uint H> static void Stages_SIMD_Narrow(T* pR, T* pI, const Tables& twiddles, u32& uMagnitudeBits, int& nExponent);
+	static u32 Stage_SIMD(T* pR, T* pI, uint h, uint uShift, const Tables& twiddles);
+
+	template <uint H> static FFTL_FORCEINLINE void Deinterleave(const V& v0, const V& v1, V& a, V& b);
+	template <uint H> static FFTL_FORCEINLINE void Interleave(const V& a, const V& b, V& v0, V& v1);
+	static FFTL_FORCEINLINE void Butterfly(V& ar, V& ai, V& br, V& bi, const V& wr, const V& wi, const __m128i& vShift, bool bMultiply);
+	static FFTL_FORCEINLINE void MulComplex(const V& ar, const V& ai, const V& br, const V& bi, V& outR, V& outI);
+	template <bool SUB> FFTL_NODISCARD static FFTL_FORCEINLINE V MulAddQ31(const V& a, const V& b, const V& c, const V& d);
+	FFTL_NODISCARD static FFTL_FORCEINLINE V GetMagnitudeBits(const V& x);
+	FFTL_NODISCARD static FFTL_FORCEINLINE u32 ReduceMagnitudeBits(const V& x);
+#endif
+};
+
+//	Real input transform of size N, on top of the N / 2 point FFT_Fixed. Output is laid out like FFT_Real::TransformForward,
+// with the real part of the Nyquist bin in the imaginary part of the DC bin.
+template <uint M, typename T>
+class FFTL_NODISCARD FFT_Real_Fixed
+{
+	static_assert(M >= 3, "FFT_Real_Fixed needs at least 8 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N >> 1;
+	static constexpr uint N_4 = N >> 2;
+
+	using sm_fft = FFT_Fixed<M - 1, T>;
+
+	FFT_Real_Fixed() = delete;
+
+	//	Returns the block exponent, same as FFT_Fixed.
+	FFTL_NODISCARD static int TransformForward(const FixedArray<T, N>& timeIn, FixedArray<T, N_2>& freqOutR, FixedArray<T, N_2>& freqOutI);
+
+private:
+	static constexpr uint BITS = sizeof(T) * 8;
+	using T_Wide = typename sm_fft::T_Wide;
+
+	//	The post process twiddles, halved so the 1/2 of the split is folded into them.
+	struct Tables
+	{
+		Tables();
+
+		FixedArray<T, N_4> m_R;
+		FixedArray<T, N_4> m_I;
+	};
+};
+
+
+} // namespace FFTL
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+#include "FFT_Fixed.inl"
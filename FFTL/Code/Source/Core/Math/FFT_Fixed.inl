@@ -0,0 +1,592 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, typename T>
+FFT_Fixed<M, T>::Tables::Tables()
+{
+	constexpr uint N_2 = N >> 1;
+	constexpr f64 fScale = static_cast<f64>(1ull << (BITS - 1));
+
+	//	Every stage's twiddles are a subset of the top stage's, so the trig only needs doing once.
+	auto pCos = std::make_unique<f64[]>(N_2);
+	auto pSin = std::make_unique<f64[]>(N_2);
+	FFT_ComputeCosSin(pCos.get(), pSin.get(), N_2, 2 * PI_64 / N, 1.0, -1.0);
+
+	m_R[0] = 0;
+	m_I[0] = 0;
+	for (uint h = 1; h < N; h <<= 1)
+	{
+		const uint uStride = N_2 / h;
+		for (uint j = 0; j < h; ++j)
+		{
+			m_R[h + j] = Quantize(pCos[j * uStride], fScale);
+			m_I[h + j] = Quantize(pSin[j * uStride], fScale);
+		}
+	}
+}
+
+template <uint M, typename T>
+int FFT_Fixed<M, T>::TransformForward(const FixedArray<T, N>& inR, const FixedArray<T, N>& inI, FixedArray<T, N>& outR, FixedArray<T, N>& outI)
+{
+	u32 uMagnitudeBits = GetMagnitudeBits(inR.data(), N) | GetMagnitudeBits(inI.data(), N);
+	return Transform<1>(inR.data(), inI.data(), outR.data(), outI.data(), uMagnitudeBits);
+}
+
+template <uint M, typename T>
+int FFT_Fixed<M, T>::TransformInverse(const FixedArray<T, N>& inR, const FixedArray<T, N>& inI, FixedArray<T, N>& outR, FixedArray<T, N>& outI)
+{
+	//	Swapping real and imaginary on the way in and out conjugates the twiddles.
+	u32 uMagnitudeBits = GetMagnitudeBits(inR.data(), N) | GetMagnitudeBits(inI.data(), N);
+	return Transform<1>(inI.data(), inR.data(), outI.data(), outR.data(), uMagnitudeBits);
+}
+
+//	uMagnitudeBits comes in describing the input, and goes out describing the output.
+template <uint M, typename T>
+template <uint STRIDE>
+int FFT_Fixed<M, T>::Transform(const T* pInR, const T* pInI, T* pOutR, T* pOutI, u32& uMagnitudeBits)
+{
+	const Tables& twiddles = FFT_LazyTable<Tables>::Get();
+
+	BitReverseCopy<STRIDE>(pInR, pInI, pOutR, pOutI);
+
+	int nExponent = 0;
+	uint h = 1;
+#if defined(FFTL_SSE4)
+	if constexpr (N >= 2 * LANES)
+	{
+		Stages_SIMD_Narrow<1>(pOutR, pOutI, twiddles, uMagnitudeBits, nExponent);
+		for (h = LANES; h < N; h <<= 1)
+		{
+			const uint uShift = GetShift(uMagnitudeBits);
+			nExponent += uShift;
+			uMagnitudeBits = Stage_SIMD(pOutR, pOutI, h, uShift, twiddles);
+		}
+	}
+#endif
+
+	for (; h < N; h <<= 1)
+	{
+		const uint uShift = GetShift(uMagnitudeBits);
+		nExponent += uShift;
+		uMagnitudeBits = Stage(pOutR, pOutI, h, uShift, twiddles);
+	}
+
+	return nExponent;
+}
+
+template <uint M, typename T>
+template <uint STRIDE>
+void FFT_Fixed<M, T>::BitReverseCopy(const T* pInR, const T* pInI, T* pOutR, T* pOutI)
+{
+	const auto& bitReverseIndices = FFT_Bitreversal<M>::Get();
+	for (uint n = 0; n < N; ++n)
+	{
+		const uint i = bitReverseIndices[n] * STRIDE;
+		pOutR[n] = pInR[i];
+		pOutI[n] = pInI[i];
+	}
+}
+
+template <uint M, typename T>
+u32 FFT_Fixed<M, T>::Stage(T* pR, T* pI, uint h, uint uShift, const Tables& twiddles)
+{
+	u32 uMagnitudeBits = 0;
+	for (uint g = 0; g < N; g += 2 * h)
+	{
+		for (uint j = 0; j < h; ++j)
+		{
+			const uint a = g + j;
+			const uint b = a + h;
+
+			const T ar = static_cast<T>(pR[a] >> uShift);
+			const T ai = static_cast<T>(pI[a] >> uShift);
+			T tr = static_cast<T>(pR[b] >> uShift);
+			T ti = static_cast<T>(pI[b] >> uShift);
+
+			//	The first stage's only twiddle is 1, which Q15 and Q31 can't quite represent.
+			if (h > 1)
+				MulComplex(tr, ti, twiddles.m_R[h + j], twiddles.m_I[h + j], tr, ti);
+
+			const T outAR = static_cast<T>(ar + tr);
+			const T outAI = static_cast<T>(ai + ti);
+			const T outBR = static_cast<T>(ar - tr);
+			const T outBI = static_cast<T>(ai - ti);
+			pR[a] = outAR;
+			pI[a] = outAI;
+			pR[b] = outBR;
+			pI[b] = outBI;
+
+			uMagnitudeBits |= GetMagnitudeBits(outAR) | GetMagnitudeBits(outAI) | GetMagnitudeBits(outBR) | GetMagnitudeBits(outBI);
+		}
+	}
+	return uMagnitudeBits;
+}
+
+template <uint M, typename T>
+u32 FFT_Fixed<M, T>::GetMagnitudeBits(const T* p, uint uCount)
+{
+	u32 uMagnitudeBits = 0;
+	uint n = 0;
+
+#if defined(FFTL_AVX2)
+	V vMagnitudeBits = _mm256_setzero_si256();
+	for (; n + LANES <= uCount; n += LANES)
+		vMagnitudeBits = _mm256_or_si256(vMagnitudeBits, GetMagnitudeBits(_mm256_loadu_si256(reinterpret_cast<const V*>(p + n))));
+	uMagnitudeBits = ReduceMagnitudeBits(vMagnitudeBits);
+#elif defined(FFTL_SSE4)
+	V vMagnitudeBits = _mm_setzero_si128();
+	for (; n + LANES <= uCount; n += LANES)
+		vMagnitudeBits = _mm_or_si128(vMagnitudeBits, GetMagnitudeBits(_mm_loadu_si128(reinterpret_cast<const V*>(p + n))));
+	uMagnitudeBits = ReduceMagnitudeBits(vMagnitudeBits);
+#endif
+
+	for (; n < uCount; ++n)
+		uMagnitudeBits |= GetMagnitudeBits(p[n]);
+	return uMagnitudeBits;
+}
+
+template <uint M, typename T>
+uint FFT_Fixed<M, T>::GetShift(u32 uMagnitudeBits)
+{
+	//	With the highest magnitude bit at b, every component is within 2^(b+1). A butterfly can grow a component by up to 1 + sqrt(2),
+	// so a stage stays in range as long as its inputs are within 2^(BITS-3).
+	constexpr uint uMaxBit = BITS - 4;
+	if (uMagnitudeBits == 0)
+		return 0;
+	const uint uBit = MS1Bit(uMagnitudeBits);
+	return uBit > uMaxBit ? uBit - uMaxBit : 0;
+}
+
+template <uint M, typename T>
+T FFT_Fixed<M, T>::Quantize(f64 f, f64 fScale)
+{
+	//	Symmetric, so negating a twiddle can't overflow.
+	constexpr f64 fMax = static_cast<f64>(std::numeric_limits<T>::max());
+	const f64 fRounded = std::floor(f * fScale + 0.5);
+	return static_cast<T>(fRounded > fMax ? fMax : fRounded < -fMax ? -fMax : fRounded);
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE void FFT_Fixed<M, T>::MulComplex(T ar, T ai, T br, T bi, T& outR, T& outI)
+{
+	if constexpr (std::is_same_v<T, s16>)
+	{
+		//	Rounded per product, same as pmulhrsw.
+		const auto MulQ15 = [](T a, T b) { return static_cast<s32>((static_cast<s32>(a) * b + 0x4000) >> 15); };
+		outR = static_cast<T>(MulQ15(ar, br) - MulQ15(ai, bi));
+		outI = static_cast<T>(MulQ15(ar, bi) + MulQ15(ai, br));
+	}
+	else
+	{
+		//	Summed at full precision and rounded once.
+		constexpr s64 nRound = s64(1) << 30;
+		outR = static_cast<T>((static_cast<s64>(ar) * br - static_cast<s64>(ai) * bi + nRound) >> 31);
+		outI = static_cast<T>((static_cast<s64>(ar) * bi + static_cast<s64>(ai) * br + nRound) >> 31);
+	}
+}
+
+#if defined(FFTL_SSE4)
+template <uint M, typename T>
+template <uint H>
+void FFT_Fixed<M, T>::Stages_SIMD_Narrow(T* pR, T* pI, const Tables& twiddles, u32& uMagnitudeBits, int& nExponent)
+{
+	const uint uShift = GetShift(uMagnitudeBits);
+	nExponent += uShift;
+	const __m128i vShift = _mm_cvtsi32_si128(static_cast<int>(uShift));
+
+	//	Each deinterleaved half has the twiddles for its span repeated across it.
+	alignas(32) T twR[LANES];
+	alignas(32) T twI[LANES];
+	for (uint n = 0; n < LANES; ++n)
+	{
+		twR[n] = twiddles.m_R[H + n % H];
+		twI[n] = twiddles.m_I[H + n % H];
+	}
+
+#if defined(FFTL_AVX2)
+	const auto Load = [](const T* p) { return _mm256_loadu_si256(reinterpret_cast<const V*>(p)); };
+	const auto Store = [](T* p, const V& v) { _mm256_storeu_si256(reinterpret_cast<V*>(p), v); };
+	const auto Or = [](const V& a, const V& b) { return _mm256_or_si256(a, b); };
+	V vMagnitudeBits = _mm256_setzero_si256();
+	const V wr = _mm256_load_si256(reinterpret_cast<const V*>(twR));
+	const V wi = _mm256_load_si256(reinterpret_cast<const V*>(twI));
+#else
+	const auto Load = [](const T* p) { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); };
+	const auto Store = [](T* p, const V& v) { _mm_storeu_si128(reinterpret_cast<V*>(p), v); };
+	const auto Or = [](const V& a, const V& b) { return _mm_or_si128(a, b); };
+	V vMagnitudeBits = _mm_setzero_si128();
+	const V wr = _mm_load_si128(reinterpret_cast<const V*>(twR));
+	const V wi = _mm_load_si128(reinterpret_cast<const V*>(twI));
+#endif
+
+	for (uint n = 0; n < N; n += 2 * LANES)
+	{
+		V ar, br, ai, bi;
+		Deinterleave<H>(Load(pR + n), Load(pR + n + LANES), ar, br);
+		Deinterleave<H>(Load(pI + n), Load(pI + n + LANES), ai, bi);
+
+		Butterfly(ar, ai, br, bi, wr, wi, vShift, H > 1);
+		vMagnitudeBits = Or(vMagnitudeBits, Or(Or(GetMagnitudeBits(ar), GetMagnitudeBits(ai)), Or(GetMagnitudeBits(br), GetMagnitudeBits(bi))));
+
+		V v0, v1;
+		Interleave<H>(ar, br, v0, v1);
+		Store(pR + n, v0);
+		Store(pR + n + LANES, v1);
+		Interleave<H>(ai, bi, v0, v1);
+		Store(pI + n, v0);
+		Store(pI + n + LANES, v1);
+	}
+
+	uMagnitudeBits = ReduceMagnitudeBits(vMagnitudeBits);
+
+	if constexpr (2 * H < LANES)
+		Stages_SIMD_Narrow<2 * H>(pR, pI, twiddles, uMagnitudeBits, nExponent);
+}
+
+template <uint M, typename T>
+u32 FFT_Fixed<M, T>::Stage_SIMD(T* pR, T* pI, uint h, uint uShift, const Tables& twiddles)
+{
+	const __m128i vShift = _mm_cvtsi32_si128(static_cast<int>(uShift));
+
+#if defined(FFTL_AVX2)
+	const auto Load = [](const T* p) { return _mm256_loadu_si256(reinterpret_cast<const V*>(p)); };
+	const auto LoadA = [](const T* p) { return _mm256_load_si256(reinterpret_cast<const V*>(p)); };
+	const auto Store = [](T* p, const V& v) { _mm256_storeu_si256(reinterpret_cast<V*>(p), v); };
+	const auto Or = [](const V& a, const V& b) { return _mm256_or_si256(a, b); };
+	V vMagnitudeBits = _mm256_setzero_si256();
+#else
+	const auto Load = [](const T* p) { return _mm_loadu_si128(reinterpret_cast<const V*>(p)); };
+	const auto LoadA = [](const T* p) { return _mm_load_si128(reinterpret_cast<const V*>(p)); };
+	const auto Store = [](T* p, const V& v) { _mm_storeu_si128(reinterpret_cast<V*>(p), v); };
+	const auto Or = [](const V& a, const V& b) { return _mm_or_si128(a, b); };
+	V vMagnitudeBits = _mm_setzero_si128();
+#endif
+
+	for (uint g = 0; g < N; g += 2 * h)
+	{
+		for (uint j = 0; j < h; j += LANES)
+		{
+			T* pAR = pR + g + j;
+			T* pAI = pI + g + j;
+			T* pBR = pAR + h;
+			T* pBI = pAI + h;
+
+			V ar = Load(pAR);
+			V ai = Load(pAI);
+			V br = Load(pBR);
+			V bi = Load(pBI);
+			Butterfly(ar, ai, br, bi, LoadA(twiddles.m_R.data() + h + j), LoadA(twiddles.m_I.data() + h + j), vShift, true);
+
+			Store(pAR, ar);
+			Store(pAI, ai);
+			Store(pBR, br);
+			Store(pBI, bi);
+
+			vMagnitudeBits = Or(vMagnitudeBits, Or(Or(GetMagnitudeBits(ar), GetMagnitudeBits(ai)), Or(GetMagnitudeBits(br), GetMagnitudeBits(bi))));
+		}
+	}
+
+	return ReduceMagnitudeBits(vMagnitudeBits);
+}
+
+//	Splits 2 vectors of consecutive butterfly groups, each made of H elements of the first half then H of the second, into the
+// first halves and second halves. Within each 128 bit lane, a shuffle puts the first halves in the low 64 bits.
+template <uint M, typename T>
+template <uint H>
+FFTL_FORCEINLINE void FFT_Fixed<M, T>::Deinterleave(const V& v0, const V& v1, V& a, V& b)
+{
+	constexpr uint uBytes = H * sizeof(T);
+#if defined(FFTL_AVX2)
+	if constexpr (uBytes == 16)
+	{
+		a = _mm256_permute2x128_si256(v0, v1, 0x20);
+		b = _mm256_permute2x128_si256(v0, v1, 0x31);
+		return;
+	}
+	V x0 = v0, x1 = v1;
+	if constexpr (uBytes == 2)
+	{
+		const V vMask = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15, 0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+		x0 = _mm256_shuffle_epi8(v0, vMask);
+		x1 = _mm256_shuffle_epi8(v1, vMask);
+	}
+	else if constexpr (uBytes == 4)
+	{
+		x0 = _mm256_shuffle_epi32(v0, _MM_SHUFFLE(3, 1, 2, 0));
+		x1 = _mm256_shuffle_epi32(v1, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+	a = _mm256_unpacklo_epi64(x0, x1);
+	b = _mm256_unpackhi_epi64(x0, x1);
+#else
+	V x0 = v0, x1 = v1;
+	if constexpr (uBytes == 2)
+	{
+		const V vMask = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+		x0 = _mm_shuffle_epi8(v0, vMask);
+		x1 = _mm_shuffle_epi8(v1, vMask);
+	}
+	else if constexpr (uBytes == 4)
+	{
+		x0 = _mm_shuffle_epi32(v0, _MM_SHUFFLE(3, 1, 2, 0));
+		x1 = _mm_shuffle_epi32(v1, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+	a = _mm_unpacklo_epi64(x0, x1);
+	b = _mm_unpackhi_epi64(x0, x1);
+#endif
+}
+
+template <uint M, typename T>
+template <uint H>
+FFTL_FORCEINLINE void FFT_Fixed<M, T>::Interleave(const V& a, const V& b, V& v0, V& v1)
+{
+	constexpr uint uBytes = H * sizeof(T);
+#if defined(FFTL_AVX2)
+	if constexpr (uBytes == 16)
+	{
+		v0 = _mm256_permute2x128_si256(a, b, 0x20);
+		v1 = _mm256_permute2x128_si256(a, b, 0x31);
+		return;
+	}
+	v0 = _mm256_unpacklo_epi64(a, b);
+	v1 = _mm256_unpackhi_epi64(a, b);
+	if constexpr (uBytes == 2)
+	{
+		const V vMask = _mm256_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15, 0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+		v0 = _mm256_shuffle_epi8(v0, vMask);
+		v1 = _mm256_shuffle_epi8(v1, vMask);
+	}
+	else if constexpr (uBytes == 4)
+	{
+		v0 = _mm256_shuffle_epi32(v0, _MM_SHUFFLE(3, 1, 2, 0));
+		v1 = _mm256_shuffle_epi32(v1, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+#else
+	v0 = _mm_unpacklo_epi64(a, b);
+	v1 = _mm_unpackhi_epi64(a, b);
+	if constexpr (uBytes == 2)
+	{
+		const V vMask = _mm_setr_epi8(0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15);
+		v0 = _mm_shuffle_epi8(v0, vMask);
+		v1 = _mm_shuffle_epi8(v1, vMask);
+	}
+	else if constexpr (uBytes == 4)
+	{
+		v0 = _mm_shuffle_epi32(v0, _MM_SHUFFLE(3, 1, 2, 0));
+		v1 = _mm_shuffle_epi32(v1, _MM_SHUFFLE(3, 1, 2, 0));
+	}
+#endif
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE void FFT_Fixed<M, T>::Butterfly(V& ar, V& ai, V& br, V& bi, const V& wr, const V& wi, const __m128i& vShift, bool bMultiply)
+{
+#if defined(FFTL_AVX2)
+	const auto Shift = [&vShift](const V& v) { if constexpr (std::is_same_v<T, s16>) return _mm256_sra_epi16(v, vShift); else return _mm256_sra_epi32(v, vShift); };
+	const auto Add = [](const V& a, const V& b) { if constexpr (std::is_same_v<T, s16>) return _mm256_add_epi16(a, b); else return _mm256_add_epi32(a, b); };
+	const auto Sub = [](const V& a, const V& b) { if constexpr (std::is_same_v<T, s16>) return _mm256_sub_epi16(a, b); else return _mm256_sub_epi32(a, b); };
+#else
+	const auto Shift = [&vShift](const V& v) { if constexpr (std::is_same_v<T, s16>) return _mm_sra_epi16(v, vShift); else return _mm_sra_epi32(v, vShift); };
+	const auto Add = [](const V& a, const V& b) { if constexpr (std::is_same_v<T, s16>) return _mm_add_epi16(a, b); else return _mm_add_epi32(a, b); };
+	const auto Sub = [](const V& a, const V& b) { if constexpr (std::is_same_v<T, s16>) return _mm_sub_epi16(a, b); else return _mm_sub_epi32(a, b); };
+#endif
+
+	const V sar = Shift(ar);
+	const V sai = Shift(ai);
+	V tr = Shift(br);
+	V ti = Shift(bi);
+	if (bMultiply)
+		MulComplex(V(tr), V(ti), wr, wi, tr, ti);
+
+	ar = Add(sar, tr);
+	ai = Add(sai, ti);
+	br = Sub(sar, tr);
+	bi = Sub(sai, ti);
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE void FFT_Fixed<M, T>::MulComplex(const V& ar, const V& ai, const V& br, const V& bi, V& outR, V& outI)
+{
+	if constexpr (std::is_same_v<T, s16>)
+	{
+#if defined(FFTL_AVX2)
+		outR = _mm256_sub_epi16(_mm256_mulhrs_epi16(ar, br), _mm256_mulhrs_epi16(ai, bi));
+		outI = _mm256_add_epi16(_mm256_mulhrs_epi16(ar, bi), _mm256_mulhrs_epi16(ai, br));
+#else
+		outR = _mm_sub_epi16(_mm_mulhrs_epi16(ar, br), _mm_mulhrs_epi16(ai, bi));
+		outI = _mm_add_epi16(_mm_mulhrs_epi16(ar, bi), _mm_mulhrs_epi16(ai, br));
+#endif
+	}
+	else
+	{
+		outR = MulAddQ31<true>(ar, br, ai, bi);
+		outI = MulAddQ31<false>(ar, bi, ai, br);
+	}
+}
+
+//	Rounded Q31 a * b + c * d, or a * b - c * d, at full 64 bit precision. pmuldq only multiplies the even lanes, so the odd lanes
+// are shifted down into them for a second set of multiplies, and the two halves blended back together.
+template <uint M, typename T>
+template <bool SUB>
+FFTL_FORCEINLINE typename FFT_Fixed<M, T>::V FFT_Fixed<M, T>::MulAddQ31(const V& a, const V& b, const V& c, const V& d)
+{
+#if defined(FFTL_AVX2)
+	const V vRound = _mm256_set1_epi64x(s64(1) << 30);
+	const auto Combine = [](const V& x, const V& y) { if constexpr (SUB) return _mm256_sub_epi64(x, y); else return _mm256_add_epi64(x, y); };
+
+	const V vEven = Combine(_mm256_mul_epi32(a, b), _mm256_mul_epi32(c, d));
+	const V vOdd = Combine(_mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32)), _mm256_mul_epi32(_mm256_srli_epi64(c, 32), _mm256_srli_epi64(d, 32)));
+
+	//	The low 32 bits of (x >> 31) are the high 32 bits of (x << 1).
+	return _mm256_blend_epi32(_mm256_srli_epi64(_mm256_add_epi64(vEven, vRound), 31), _mm256_slli_epi64(_mm256_add_epi64(vOdd, vRound), 1), 0xaa);
+#else
+	const V vRound = _mm_set1_epi64x(s64(1) << 30);
+	const auto Combine = [](const V& x, const V& y) { if constexpr (SUB) return _mm_sub_epi64(x, y); else return _mm_add_epi64(x, y); };
+
+	const V vEven = Combine(_mm_mul_epi32(a, b), _mm_mul_epi32(c, d));
+	const V vOdd = Combine(_mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32)), _mm_mul_epi32(_mm_srli_epi64(c, 32), _mm_srli_epi64(d, 32)));
+
+	//	The low 32 bits of (x >> 31) are the high 32 bits of (x << 1).
+	return _mm_blend_epi16(_mm_srli_epi64(_mm_add_epi64(vEven, vRound), 31), _mm_slli_epi64(_mm_add_epi64(vOdd, vRound), 1), 0xcc);
+#endif
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE typename FFT_Fixed<M, T>::V FFT_Fixed<M, T>::GetMagnitudeBits(const V& x)
+{
+#if defined(FFTL_AVX2)
+	if constexpr (std::is_same_v<T, s16>)
+		return _mm256_xor_si256(x, _mm256_srai_epi16(x, 15));
+	else
+		return _mm256_xor_si256(x, _mm256_srai_epi32(x, 31));
+#else
+	if constexpr (std::is_same_v<T, s16>)
+		return _mm_xor_si128(x, _mm_srai_epi16(x, 15));
+	else
+		return _mm_xor_si128(x, _mm_srai_epi32(x, 31));
+#endif
+}
+template <uint M, typename T>
+FFTL_FORCEINLINE u32 FFT_Fixed<M, T>::ReduceMagnitudeBits(const V& x)
+{
+	alignas(32) u32 uLanes[sizeof(V) / sizeof(u32)];
+#if defined(FFTL_AVX2)
+	_mm256_store_si256(reinterpret_cast<V*>(uLanes), x);
+#else
+	_mm_store_si128(reinterpret_cast<V*>(uLanes), x);
+#endif
+
+	u32 uMagnitudeBits = 0;
+	for (u32 u : uLanes)
+		uMagnitudeBits |= u;
+	if constexpr (std::is_same_v<T, s16>)
+		uMagnitudeBits = (uMagnitudeBits | (uMagnitudeBits >> 16)) & 0xffff;
+	return uMagnitudeBits;
+}
+#endif // defined(FFTL_SSE4)
+
+
+template <uint M, typename T>
+FFT_Real_Fixed<M, T>::Tables::Tables()
+{
+	constexpr f64 fScale = static_cast<f64>(1ull << (BITS - 2));
+
+	auto pCos = std::make_unique<f64[]>(N_4);
+	auto pSin = std::make_unique<f64[]>(N_4);
+	FFT_ComputeCosSin(pCos.get(), pSin.get(), N_4, 2 * PI_64 / N, -1.0, -1.0);
+
+	//	Same twiddles as FFT_Real, -sin and -cos of 2 * pi * k / N, times 1/2.
+	for (uint k = 0; k < N_4; ++k)
+	{
+		m_R[k] = sm_fft::Quantize(pSin[k], fScale);
+		m_I[k] = sm_fft::Quantize(pCos[k], fScale);
+	}
+}
+
+template <uint M, typename T>
+int FFT_Real_Fixed<M, T>::TransformForward(const FixedArray<T, N>& timeIn, FixedArray<T, N_2>& freqOutR, FixedArray<T, N_2>& freqOutI)
+{
+	const Tables& twiddles = FFT_LazyTable<Tables>::Get();
+
+	//	Even samples as the real part and odd as the imaginary, gathered by the bit reversal.
+	u32 uMagnitudeBits = sm_fft::GetMagnitudeBits(timeIn.data(), N);
+	int nExponent = sm_fft::template Transform<2>(timeIn.data(), timeIn.data() + 1, freqOutR.data(), freqOutI.data(), uMagnitudeBits);
+
+	//	Splitting the spectra can grow components by the same 1 + sqrt(2) as a butterfly.
+	const uint uShift = sm_fft::GetShift(uMagnitudeBits);
+	nExponent += uShift;
+
+	{
+		const T_Wide fDcR = freqOutR[0] >> uShift;
+		const T_Wide fDcI = freqOutI[0] >> uShift;
+		freqOutR[0] = static_cast<T>(fDcR + fDcI);
+		freqOutI[0] = static_cast<T>(fDcR - fDcI); // The Nyquist bin goes in the imaginary DC bin, as in FFT_Real.
+	}
+
+	//	X[k] = (f1 + f2 * twiddle) / 2, with the 1/2 folded into the twiddles and into the shift of f1, so it's all rounded once.
+	constexpr T_Wide nRound = T_Wide(1) << (BITS - 2);
+	for (uint k = 1; k < N_4; ++k)
+	{
+		const uint Nmk = N_2 - k;
+
+		const T_Wide zkR = freqOutR[k] >> uShift;
+		const T_Wide zkI = freqOutI[k] >> uShift;
+		const T_Wide znkR = freqOutR[Nmk] >> uShift;
+		const T_Wide znkI = -(freqOutI[Nmk] >> uShift);
+
+		const T_Wide f1R = zkR + znkR;
+		const T_Wide f1I = zkI + znkI;
+		const T_Wide f2R = zkR - znkR;
+		const T_Wide f2I = zkI - znkI;
+
+		const T_Wide twR = f2R * twiddles.m_R[k] - f2I * twiddles.m_I[k];
+		const T_Wide twI = f2R * twiddles.m_I[k] + f2I * twiddles.m_R[k];
+		const T_Wide f1RScaled = f1R * (T_Wide(1) << (BITS - 2));
+		const T_Wide f1IScaled = f1I * (T_Wide(1) << (BITS - 2));
+
+		freqOutR[k] = static_cast<T>((f1RScaled + twR + nRound) >> (BITS - 1));
+		freqOutI[k] = static_cast<T>((f1IScaled + twI + nRound) >> (BITS - 1));
+		freqOutR[Nmk] = static_cast<T>((f1RScaled - twR + nRound) >> (BITS - 1));
+		freqOutI[Nmk] = static_cast<T>((twI - f1IScaled + nRound) >> (BITS - 1));
+	}
+
+	//	The odd center bin just needs the imaginary part negated.
+	freqOutR[N_4] = static_cast<T>(freqOutR[N_4] >> uShift);
+	freqOutI[N_4] = static_cast<T>(-(freqOutI[N_4] >> uShift));
+
+	return nExponent;
+}
+
+
+} // namespace FFTL
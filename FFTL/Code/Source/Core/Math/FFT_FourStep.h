@@ -0,0 +1,139 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+#include "Transpose.h"
+#include "../Platform/ThreadPool.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Four step FFT (Bailey) for transforms too large to stay in cache. The N = N1 * N2 input is viewed as a matrix, and the transform
+// becomes N2 FFTs of length N1 and N1 FFTs of length N2, separated by a twiddle multiply by W_N^(n2 * k1):
+//
+//		1. Transpose the N1 x N2 input, so each length N1 column becomes a contiguous row
+//		2. FFT<M1> on each row
+//		3. Multiply by the twiddle factors while transposing back
+//		4. FFT<M2> on each row
+//		5. Transpose, so the output comes out in natural order
+//
+// The row FFTs are small enough to run entirely in cache, so the whole array only streams through memory a handful of times instead
+// of once per radix 2 stage. Transposes are done in small tiles for the same reason. Rather than an N sized twiddle table, W_N^e is
+// the product of 2 tables indexed by the high and low halves of the bits of e.
+//
+// The caller provides a work buffer of the same size as the output. The input is not modified. Every pass is made of independent
+// rows or tiles, so the overloads taking a ThreadPool split each pass across its threads.
+template <uint M, typename T = f32>
+class FFTL_NODISCARD FFT_FourStep
+{
+	static_assert(M >= 6, "FFT_FourStep needs sub transforms of at least 8 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint M1 = M / 2;
+	static constexpr uint M2 = M - M1;
+	static constexpr uint N1 = 1 << M1;
+	static constexpr uint N2 = 1 << M2;
+
+	using sm_fft1 = FFT<M1, T>;
+	using sm_fft2 = FFT<M2, T>;
+
+	FFT_FourStep();
+
+	void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI) const
+	{
+		Transform(fInR, fInI, fOutR, fOutI, fWorkR, fWorkI, nullptr);
+	}
+	void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI, ThreadPool& pool) const
+	{
+		Transform(fInR, fInI, fOutR, fOutI, fWorkR, fWorkI, &pool);
+	}
+
+	//	No divide by N. Swap the real and imaginary parts.
+	void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI) const
+	{
+		Transform(fInI, fInR, fOutI, fOutR, fWorkI, fWorkR, nullptr);
+	}
+	void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI, ThreadPool& pool) const
+	{
+		Transform(fInI, fInR, fOutI, fOutR, fWorkI, fWorkR, &pool);
+	}
+
+private:
+	static constexpr uint TWIDDLE_LO_BITS = M / 2;
+	static constexpr uint TWIDDLE_LO_N = 1 << TWIDDLE_LO_BITS;
+	static constexpr uint TWIDDLE_HI_N = 1 << (M - TWIDDLE_LO_BITS);
+	static constexpr uint TILE = N1 < 16 ? N1 : 16;
+
+	void Transform(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI, ThreadPool* pPool) const;
+
+	//	Runs func(uBegin, uEnd) over 0 to uCount, across the pool if there is one.
+	template <typename T_Functor> static void ForRange(ThreadPool* pPool, uint uCount, const T_Functor& func);
+
+	//	Works on rows of tiles, uTileRowBegin to uTileRowEnd.
+	void TransposeTwiddle(const T* pInR, const T* pInI, T* pOutR, T* pOutI, uint uTileRowBegin, uint uTileRowEnd) const;
+
+	//	W_N^e, as the product of the high and low bit tables.
+	void GetTwiddle(uint e, T& fWR, T& fWI) const;
+#if FFTL_SIMD_F32x4
+	//	W_N^(e + i * uStep) in lane i.
+	cxNumber<f32x4> GetTwiddles4(uint e, uint uStep) const;
+#endif
+
+	FixedArray_Aligned32<T, TWIDDLE_LO_N> m_TwiddleLoR;	// W_N^e for the low bits of e
+	FixedArray_Aligned32<T, TWIDDLE_LO_N> m_TwiddleLoI;
+	FixedArray_Aligned32<T, TWIDDLE_HI_N> m_TwiddleHiR;	// W_N^e for the high bits of e
+	FixedArray_Aligned32<T, TWIDDLE_HI_N> m_TwiddleHiI;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_FourStep.inl"
@@ -0,0 +1,221 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, typename T>
+FFT_FourStep<M, T>::FFT_FourStep()
+{
+	//	Angles are computed in double precision, and each table only needs about sqrt(N) entries.
+	for (uint n = 0; n < TWIDDLE_LO_N; ++n)
+	{
+		const f64 fAngle = -2 * PI_64 * static_cast<f64>(n) / N;
+		m_TwiddleLoR[n] = static_cast<T>(Cos(fAngle));
+		m_TwiddleLoI[n] = static_cast<T>(Sin(fAngle));
+	}
+	for (uint n = 0; n < TWIDDLE_HI_N; ++n)
+	{
+		const f64 fAngle = -2 * PI_64 * static_cast<f64>(n << TWIDDLE_LO_BITS) / N;
+		m_TwiddleHiR[n] = static_cast<T>(Cos(fAngle));
+		m_TwiddleHiI[n] = static_cast<T>(Sin(fAngle));
+	}
+}
+
+template <uint M, typename T>
+void FFT_FourStep<M, T>::Transform(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI, ThreadPool* pPool) const
+{
+	FFTL_ASSERT(fInR.data() != fOutR.data() && fInR.data() != fWorkR.data());
+
+	using Row1 = FixedArray<T, N1>;
+	using Row2 = FixedArray<T, N2>;
+
+	//	Input column n2 becomes row n2
+	ForRange(pPool, N1 / TILE, [&](uint uBegin, uint uEnd)
+	{
+		TransposeTiled<N1, N2, TILE>(fInR.data(), fOutR.data(), uBegin, uEnd);
+		TransposeTiled<N1, N2, TILE>(fInI.data(), fOutI.data(), uBegin, uEnd);
+	});
+
+	ForRange(pPool, N2, [&](uint uBegin, uint uEnd)
+	{
+		for (uint n2 = uBegin; n2 < uEnd; ++n2)
+		{
+			const uint uOffset = n2 * N1;
+			sm_fft1::TransformForward(
+				*reinterpret_cast<const Row1*>(fOutR + uOffset), *reinterpret_cast<const Row1*>(fOutI + uOffset),
+				*reinterpret_cast<Row1*>(fWorkR + uOffset), *reinterpret_cast<Row1*>(fWorkI + uOffset));
+		}
+	});
+
+	ForRange(pPool, N2 / TILE, [&](uint uBegin, uint uEnd)
+	{
+		TransposeTwiddle(fWorkR.data(), fWorkI.data(), fOutR.data(), fOutI.data(), uBegin, uEnd);
+	});
+
+	ForRange(pPool, N1, [&](uint uBegin, uint uEnd)
+	{
+		for (uint k1 = uBegin; k1 < uEnd; ++k1)
+		{
+			const uint uOffset = k1 * N2;
+			sm_fft2::TransformForward(
+				*reinterpret_cast<const Row2*>(fOutR + uOffset), *reinterpret_cast<const Row2*>(fOutI + uOffset),
+				*reinterpret_cast<Row2*>(fWorkR + uOffset), *reinterpret_cast<Row2*>(fWorkI + uOffset));
+		}
+	});
+
+	//	Row k1 holds bins k1 + N1 * k2, so one more transpose puts them in order
+	ForRange(pPool, N1 / TILE, [&](uint uBegin, uint uEnd)
+	{
+		TransposeTiled<N1, N2, TILE>(fWorkR.data(), fOutR.data(), uBegin, uEnd);
+		TransposeTiled<N1, N2, TILE>(fWorkI.data(), fOutI.data(), uBegin, uEnd);
+	});
+}
+
+template <uint M, typename T>
+template <typename T_Functor>
+FFTL_FORCEINLINE void FFT_FourStep<M, T>::ForRange(ThreadPool* pPool, uint uCount, const T_Functor& func)
+{
+	if (pPool != nullptr)
+		pPool->ParallelFor(uCount, func);
+	else
+		func(0, uCount);
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE void FFT_FourStep<M, T>::TransposeTwiddle(const T* pInR, const T* pInI, T* pOutR, T* pOutI, uint uTileRowBegin, uint uTileRowEnd) const
+{
+	//	The input is N2 rows of N1, with element [n2][k1] multiplied by W_N^(n2 * k1) on its way to [k1][n2] of the output.
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T, f32>)
+	{
+		//	Each 4x4 block is transposed in registers, after which a vector holds 4 consecutive n2 of output row k1. Its twiddles are
+		// looked up at the start of every tile, then stepped by W_N^n2 from one k1 to the next.
+		for (uint r = uTileRowBegin * TILE; r < uTileRowEnd * TILE; r += TILE)
+		{
+			for (uint c = 0; c < N1; c += TILE)
+			{
+				for (uint n2 = r; n2 < r + TILE; n2 += 4)
+				{
+					cxNumber<f32x4> vW = GetTwiddles4(n2 * c, c);
+					const cxNumber<f32x4> vStep = GetTwiddles4(n2, 1);
+
+					for (uint k1 = c; k1 < c + TILE; k1 += 4)
+					{
+						f32x4 vR[4] =
+						{
+							f32x4::LoadA(pInR + (n2 + 0) * N1 + k1),
+							f32x4::LoadA(pInR + (n2 + 1) * N1 + k1),
+							f32x4::LoadA(pInR + (n2 + 2) * N1 + k1),
+							f32x4::LoadA(pInR + (n2 + 3) * N1 + k1),
+						};
+						f32x4 vI[4] =
+						{
+							f32x4::LoadA(pInI + (n2 + 0) * N1 + k1),
+							f32x4::LoadA(pInI + (n2 + 1) * N1 + k1),
+							f32x4::LoadA(pInI + (n2 + 2) * N1 + k1),
+							f32x4::LoadA(pInI + (n2 + 3) * N1 + k1),
+						};
+						Transpose4x4(vR);
+						Transpose4x4(vI);
+
+						const cxNumber<f32x4> vOut0 = cxNumber<f32x4>(vR[0], vI[0]) * vW;
+						vW *= vStep;
+						const cxNumber<f32x4> vOut1 = cxNumber<f32x4>(vR[1], vI[1]) * vW;
+						vW *= vStep;
+						const cxNumber<f32x4> vOut2 = cxNumber<f32x4>(vR[2], vI[2]) * vW;
+						vW *= vStep;
+						const cxNumber<f32x4> vOut3 = cxNumber<f32x4>(vR[3], vI[3]) * vW;
+						vW *= vStep;
+
+						vOut0.r.StoreA(pOutR + (k1 + 0) * N2 + n2);
+						vOut0.i.StoreA(pOutI + (k1 + 0) * N2 + n2);
+						vOut1.r.StoreA(pOutR + (k1 + 1) * N2 + n2);
+						vOut1.i.StoreA(pOutI + (k1 + 1) * N2 + n2);
+						vOut2.r.StoreA(pOutR + (k1 + 2) * N2 + n2);
+						vOut2.i.StoreA(pOutI + (k1 + 2) * N2 + n2);
+						vOut3.r.StoreA(pOutR + (k1 + 3) * N2 + n2);
+						vOut3.i.StoreA(pOutI + (k1 + 3) * N2 + n2);
+					}
+				}
+			}
+		}
+		return;
+	}
+#endif
+
+	for (uint r = uTileRowBegin * TILE; r < uTileRowEnd * TILE; r += TILE)
+	{
+		for (uint c = 0; c < N1; c += TILE)
+		{
+			for (uint n2 = r; n2 < r + TILE; ++n2)
+			{
+				for (uint k1 = c; k1 < c + TILE; ++k1)
+				{
+					T fWR, fWI;
+					GetTwiddle(n2 * k1, fWR, fWI);
+
+					const T fR = pInR[n2 * N1 + k1];
+					const T fI = pInI[n2 * N1 + k1];
+
+					pOutR[k1 * N2 + n2] = fR * fWR - fI * fWI;
+					pOutI[k1 * N2 + n2] = fR * fWI + fI * fWR;
+				}
+			}
+		}
+	}
+}
+
+template <uint M, typename T>
+FFTL_FORCEINLINE void FFT_FourStep<M, T>::GetTwiddle(uint e, T& fWR, T& fWI) const
+{
+	constexpr uint LO_MASK = TWIDDLE_LO_N - 1;
+	const uint uLo = e & LO_MASK;
+	const uint uHi = e >> TWIDDLE_LO_BITS;
+
+	fWR = m_TwiddleHiR[uHi] * m_TwiddleLoR[uLo] - m_TwiddleHiI[uHi] * m_TwiddleLoI[uLo];
+	fWI = m_TwiddleHiR[uHi] * m_TwiddleLoI[uLo] + m_TwiddleHiI[uHi] * m_TwiddleLoR[uLo];
+}
+
+#if FFTL_SIMD_F32x4
+template <uint M, typename T>
+FFTL_FORCEINLINE cxNumber<f32x4> FFT_FourStep<M, T>::GetTwiddles4(uint e, uint uStep) const
+{
+	alignas(16) f32 fWR[4];
+	alignas(16) f32 fWI[4];
+	for (uint i = 0; i < 4; ++i)
+		GetTwiddle(e + i * uStep, fWR[i], fWI[i]);
+	return cxNumber<f32x4>(f32x4::LoadA(fWR), f32x4::LoadA(fWI));
+}
+#endif
+
+} // namespace FFTL
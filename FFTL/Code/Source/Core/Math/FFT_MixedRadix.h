@@ -0,0 +1,151 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Radix plan of FFT_MixedRadix. The size is broken down into radix 4 stages first, then 2, 3, 5 and 7, so that all but
+// the first few stages work on contiguous runs of butterflies that are a multiple of the SIMD width.
+template <uint N>
+class FFTL_NODISCARD FFT_MixedRadix_Factors
+{
+public:
+	static constexpr uint MAX_STAGES = 32;
+	static constexpr uint TWIDDLE_ALIGN = 8; // Each stage's twiddles start on a multiple of this many floats
+
+	constexpr FFT_MixedRadix_Factors();
+
+	uint m_StageCount = 0;
+	uint m_Remainder = N; // Anything left over that isn't a factor of 2, 3, 5 or 7. Must be 1 for a usable N.
+	uint m_TwiddleCount = 0;
+	FixedArray<uint, MAX_STAGES> m_Radix{};
+	FixedArray<uint, MAX_STAGES> m_Span{}; // Size of each sub DFT the stage combines, ie, the product of all the previous radices
+	FixedArray<uint, MAX_STAGES> m_TwiddleOffset{};
+};
+
+template <uint N>
+class FFTL_NODISCARD FFT_MixedRadix_TablesContainer
+{
+private:
+	template <uint, bool> friend class FFT_MixedRadix_Tables;
+	template <uint> friend class FFT_MixedRadix;
+	template <typename> friend class FFT_LazyTable;
+
+	static constexpr FFT_MixedRadix_Factors<N> FACTORS{};
+	using T_DR = typename std::conditional<N <= (1 << 16), u16, u32>::type;
+
+	constexpr FFT_MixedRadix_TablesContainer();
+
+	//	Input index for each output position of the first stage, the mixed radix equivalent of the bit reverse indices.
+	FixedArray<T_DR, N> m_DigitReverse;
+
+	//	Twiddle factors of every stage after the first, laid out as [stage][leg - 1][butterfly] so consecutive butterflies load contiguously.
+	alignas(32) FixedArray<f32, FACTORS.m_TwiddleCount + 1> m_TwiddlesR;
+	alignas(32) FixedArray<f32, FACTORS.m_TwiddleCount + 1> m_TwiddlesI;
+};
+
+template <uint N, bool USE_CONSTEXPR = (N <= (1 << FFT_MAX_TWIDDLES_CONSTEXPR))>
+class FFTL_NODISCARD FFT_MixedRadix_Tables
+{
+private:
+	template <uint> friend class FFT_MixedRadix;
+
+	static constexpr const FFT_MixedRadix_TablesContainer<N>& Get() { return sm_Tables; }
+
+	static constexpr FFT_MixedRadix_TablesContainer<N> sm_Tables{ };
+};
+
+template <uint N>
+class FFTL_NODISCARD FFT_MixedRadix_Tables<N, false>
+{
+private:
+	template <uint> friend class FFT_MixedRadix;
+
+	static FFTL_FORCEINLINE const FFT_MixedRadix_TablesContainer<N>& Get() { return FFT_LazyTable<FFT_MixedRadix_TablesContainer<N>>::Get(); }
+};
+
+//	Mixed radix complex FFT for any size N that is a product of 2, 3, 5 and 7, eg, 480 or 1920 sample audio frames, without
+// zero padding to the next power of 2. Uses the same split real/imaginary layout as FFT<M, f32, f32>, and the same alignment
+// requirements. The first stage is scalar and is merged with the digit reversal, the rest use SIMD whenever the stage's
+// sub DFT size is a multiple of the vector width.
+template <uint N>
+class FFTL_NODISCARD FFT_MixedRadix
+{
+public:
+	using T = f32;
+	using cxT = cxNumber<T>;
+
+	static constexpr FFT_MixedRadix_Factors<N> FACTORS{};
+	static_assert(N >= 2 && FACTORS.m_Remainder == 1, "FFT_MixedRadix only supports sizes whose prime factors are 2, 3, 5 and 7");
+
+	FFT_MixedRadix() = delete;
+
+	static void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+
+	//	No divide by N.
+	static void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI) { TransformForward(fInI, fInR, fOutI, fOutR); }
+
+private:
+	using Tables = FFT_MixedRadix_Tables<N>;
+
+	template <uint P, uint IN_STRIDE> static void Transform_Stage0(const T* pfInR, const T* pfInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	template <uint STAGE> static void Transform_Stage(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+	static void Transform_Stages(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI);
+
+	template <uint P, uint SPAN, typename V> static void CalculateVButterflies(const T* pfTwiddleR, const T* pfTwiddleI, T* pfR, T* pfI);
+	template <uint P, typename V> static void CalculateDFT(V (&vR)[P], V (&vI)[P]);
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_MixedRadix.inl"
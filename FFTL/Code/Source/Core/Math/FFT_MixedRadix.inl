@@ -0,0 +1,348 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#include "../Utils/MetaProgramming.h"
+
+
+namespace FFTL
+{
+
+
+template <uint N>
+constexpr FFT_MixedRadix_Factors<N>::FFT_MixedRadix_Factors()
+{
+	constexpr uint RADICES[] = { 4, 2, 3, 5, 7 };
+
+	uint uSpan = 1;
+	for (const uint uRadix : RADICES)
+	{
+		while (m_Remainder % uRadix == 0 && m_StageCount < MAX_STAGES)
+		{
+			m_Radix[m_StageCount] = uRadix;
+			m_Span[m_StageCount] = uSpan;
+
+			//	The first stage has only unity twiddles, so it gets none.
+			if (m_StageCount > 0)
+			{
+				m_TwiddleOffset[m_StageCount] = m_TwiddleCount;
+				m_TwiddleCount += (uRadix - 1) * uSpan;
+				m_TwiddleCount = (m_TwiddleCount + TWIDDLE_ALIGN - 1) & ~(TWIDDLE_ALIGN - 1);
+			}
+
+			m_Remainder /= uRadix;
+			uSpan *= uRadix;
+			++m_StageCount;
+		}
+	}
+}
+
+template <uint N>
+constexpr FFT_MixedRadix_TablesContainer<N>::FFT_MixedRadix_TablesContainer()
+	: m_DigitReverse{}
+	, m_TwiddlesR{}
+	, m_TwiddlesI{}
+{
+	//	The last stage combines sub DFTs of every Nth / P input, each of which was computed in place in its own contiguous
+	// block of the output. Recursing down to the first stage gives the input index for each output position.
+	for (uint n = 0; n < N; ++n)
+	{
+		uint uPos = n;
+		uint uIndex = 0;
+		uint uInputStride = 1;
+		for (uint s = FACTORS.m_StageCount - 1; s > 0; --s)
+		{
+			const uint uRadix = FACTORS.m_Radix[s];
+			const uint uSpan = FACTORS.m_Span[s];
+			uIndex += (uPos / uSpan) * uInputStride;
+			uPos %= uSpan;
+			uInputStride *= uRadix;
+		}
+		uIndex += uPos * uInputStride;
+		m_DigitReverse[n] = safestatic_cast<T_DR>(uIndex);
+	}
+
+	for (uint s = 1; s < FFT_MixedRadix_Factors<N>::MAX_STAGES && s < FACTORS.m_StageCount; ++s)
+	{
+		const uint uRadix = FACTORS.m_Radix[s];
+		const uint uSpan = FACTORS.m_Span[s];
+		const uint uOffset = FACTORS.m_TwiddleOffset[s];
+		for (uint r = 1; r < uRadix; ++r)
+		{
+			for (uint j = 0; j < uSpan; ++j)
+			{
+				const long double fAngle = -2 * PI_<long double> * static_cast<long double>(r * j) / static_cast<long double>(uRadix * uSpan);
+				m_TwiddlesR[uOffset + (r - 1) * uSpan + j] = static_cast<f32>(math_constexpr::Cos(fAngle));
+				m_TwiddlesI[uOffset + (r - 1) * uSpan + j] = static_cast<f32>(math_constexpr::Sin(fAngle));
+			}
+		}
+	}
+}
+
+
+template <uint N>
+void FFT_MixedRadix<N>::TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	Transform_Stage0<FACTORS.m_Radix[0], 1>(fInR.data(), fInI.data(), fOutR, fOutI);
+	Transform_Stages(fOutR, fOutI);
+}
+
+template <uint N>
+void FFT_MixedRadix<N>::TransformForward(const FixedArray<cxT, N>& cxInput, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	Transform_Stage0<FACTORS.m_Radix[0], 2>(&cxInput[0].r, &cxInput[0].i, fOutR, fOutI);
+	Transform_Stages(fOutR, fOutI);
+}
+
+template <uint N>
+template <uint P, uint IN_STRIDE>
+FFTL_FORCEINLINE void FFT_MixedRadix<N>::Transform_Stage0(const T* pfInR, const T* pfInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	const auto& digitReverse = Tables::Get().m_DigitReverse;
+
+	//	Copy the input to the output in digit reversed order, simultaneously completing the first stage, which has only unity twiddles.
+	for (uint n = 0; n < N; n += P)
+	{
+		T fR[P], fI[P];
+		constexpr_for<0u, P, 1>([&](auto r)
+		{
+			const uint uIndex = digitReverse[n + r] * IN_STRIDE;
+			fR[r] = pfInR[uIndex];
+			fI[r] = pfInI[uIndex];
+		});
+
+		CalculateDFT<P>(fR, fI);
+
+		constexpr_for<0u, P, 1>([&](auto k)
+		{
+			fOutR[n + k] = fR[k];
+			fOutI[n + k] = fI[k];
+		});
+	}
+}
+
+template <uint N>
+FFTL_FORCEINLINE void FFT_MixedRadix<N>::Transform_Stages(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	constexpr_for<1u, FACTORS.m_StageCount, 1>([&](auto STAGE)
+	{
+		Transform_Stage<STAGE>(fOutR, fOutI);
+	});
+}
+
+template <uint N>
+template <uint STAGE>
+FFTL_FORCEINLINE void FFT_MixedRadix<N>::Transform_Stage(FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI)
+{
+	constexpr uint P = FACTORS.m_Radix[STAGE];
+	constexpr uint SPAN = FACTORS.m_Span[STAGE];
+	constexpr uint nStageExp = P * SPAN;
+
+	//	Use the widest vector that evenly divides the contiguous run of butterflies.
+#if FFTL_SIMD_F32x8
+	constexpr uint nWidth = SPAN % 8 == 0 ? 8 : SPAN % 4 == 0 ? 4 : 1;
+#elif FFTL_SIMD_F32x4
+	constexpr uint nWidth = SPAN % 4 == 0 ? 4 : 1;
+#else
+	constexpr uint nWidth = 1;
+#endif
+	using V = std::conditional_t<nWidth == 8, f32x8, std::conditional_t<nWidth == 4, f32x4, f32>>;
+
+	const auto& tables = Tables::Get();
+	const T* pfTwiddleR = tables.m_TwiddlesR.data() + FACTORS.m_TwiddleOffset[STAGE];
+	const T* pfTwiddleI = tables.m_TwiddlesI.data() + FACTORS.m_TwiddleOffset[STAGE];
+
+	//	Loop for each sub DFT
+	for (uint uButterfly = 0; uButterfly < N; uButterfly += nStageExp)
+	{
+		//	Loop for each group of P legs
+		for (uint j = 0; j < SPAN; j += nWidth)
+		{
+			CalculateVButterflies<P, SPAN, V>(pfTwiddleR + j, pfTwiddleI + j, &fOutR[uButterfly + j], &fOutI[uButterfly + j]);
+		}
+	}
+}
+
+template <uint N>
+template <uint P, uint SPAN, typename V>
+FFTL_FORCEINLINE void FFT_MixedRadix<N>::CalculateVButterflies(const T* pfTwiddleR, const T* pfTwiddleI, T* pfR, T* pfI)
+{
+	V vR[P], vI[P];
+
+	if constexpr (std::is_same_v<V, f32>)
+	{
+		vR[0] = pfR[0];
+		vI[0] = pfI[0];
+	}
+	else
+	{
+		vR[0] = V::LoadA(pfR);
+		vI[0] = V::LoadA(pfI);
+	}
+
+	//	Leg 0 always has a unity twiddle
+	constexpr_for<1u, P, 1>([&](auto r)
+	{
+		if constexpr (std::is_same_v<V, f32>)
+		{
+			const V vUr = pfTwiddleR[(r - 1) * SPAN];
+			const V vUi = pfTwiddleI[(r - 1) * SPAN];
+			const V vXr = pfR[r * SPAN];
+			const V vXi = pfI[r * SPAN];
+			vR[r] = vXr * vUr - vXi * vUi;
+			vI[r] = vXr * vUi + vXi * vUr;
+		}
+		else
+		{
+			const V vUr = V::LoadA(pfTwiddleR + (r - 1) * SPAN);
+			const V vUi = V::LoadA(pfTwiddleI + (r - 1) * SPAN);
+			const V vXr = V::LoadA(pfR + r * SPAN);
+			const V vXi = V::LoadA(pfI + r * SPAN);
+			vR[r] = SubMul(vXr * vUr, vXi, vUi);
+			vI[r] = AddMul(vXr * vUi, vXi, vUr);
+		}
+	});
+
+	CalculateDFT<P>(vR, vI);
+
+	constexpr_for<0u, P, 1>([&](auto k)
+	{
+		if constexpr (std::is_same_v<V, f32>)
+		{
+			pfR[k * SPAN] = vR[k];
+			pfI[k * SPAN] = vI[k];
+		}
+		else
+		{
+			StoreA(pfR + k * SPAN, vR[k]);
+			StoreA(pfI + k * SPAN, vI[k]);
+		}
+	});
+}
+
+template <uint N>
+template <uint P, typename V>
+FFTL_FORCEINLINE void FFT_MixedRadix<N>::CalculateDFT(V (&vR)[P], V (&vI)[P])
+{
+	if constexpr (P == 2)
+	{
+		const V vSumR = vR[0] + vR[1];
+		const V vSumI = vI[0] + vI[1];
+		vR[1] = vR[0] - vR[1];
+		vI[1] = vI[0] - vI[1];
+		vR[0] = vSumR;
+		vI[0] = vSumI;
+	}
+	else if constexpr (P == 4)
+	{
+		const V vSum02R = vR[0] + vR[2];
+		const V vSum02I = vI[0] + vI[2];
+		const V vDif02R = vR[0] - vR[2];
+		const V vDif02I = vI[0] - vI[2];
+		const V vSum13R = vR[1] + vR[3];
+		const V vSum13I = vI[1] + vI[3];
+		const V vDif13R = vR[1] - vR[3];
+		const V vDif13I = vI[1] - vI[3];
+
+		//	Legs 1 and 3 are rotated by -i and +i respectively
+		vR[0] = vSum02R + vSum13R;
+		vI[0] = vSum02I + vSum13I;
+		vR[1] = vDif02R + vDif13I;
+		vI[1] = vDif02I - vDif13R;
+		vR[2] = vSum02R - vSum13R;
+		vI[2] = vSum02I - vSum13I;
+		vR[3] = vDif02R - vDif13I;
+		vI[3] = vDif02I + vDif13R;
+	}
+	else
+	{
+		static_assert(P == 3 || P == 5 || P == 7, "Unsupported radix");
+
+		//	Odd radices pair up legs r and P - r, whose twiddles are complex conjugates of each other. This leaves
+		// (P - 1) / 2 cosine and sine terms per output pair, rather than a full P * P complex multiply.
+		constexpr uint H = (P - 1) / 2;
+		static constexpr struct Coefficients
+		{
+			constexpr Coefficients() : m_Cos{}, m_Sin{}
+			{
+				for (uint k = 0; k < P; ++k)
+				{
+					const long double fAngle = 2 * PI_<long double> * static_cast<long double>(k) / static_cast<long double>(P);
+					m_Cos[k] = static_cast<f32>(math_constexpr::Cos(fAngle));
+					m_Sin[k] = static_cast<f32>(math_constexpr::Sin(fAngle));
+				}
+			}
+			f32 m_Cos[P];
+			f32 m_Sin[P];
+		} coeff;
+
+		V vSumR[H + 1], vSumI[H + 1], vDifR[H + 1], vDifI[H + 1];
+		V vOut0R = vR[0];
+		V vOut0I = vI[0];
+		constexpr_for<1u, H + 1, 1>([&](auto r)
+		{
+			vSumR[r] = vR[r] + vR[P - r];
+			vSumI[r] = vI[r] + vI[P - r];
+			vDifR[r] = vR[r] - vR[P - r];
+			vDifI[r] = vI[r] - vI[P - r];
+			vOut0R = vOut0R + vSumR[r];
+			vOut0I = vOut0I + vSumI[r];
+		});
+
+		constexpr_for<1u, H + 1, 1>([&](auto k)
+		{
+			V vAccR = vR[0];
+			V vAccI = vI[0];
+			V vRotR = Splat<V>(0.f);
+			V vRotI = Splat<V>(0.f);
+			constexpr_for<1u, H + 1, 1>([&](auto r)
+			{
+				const V vCos = Splat<V>(coeff.m_Cos[(r * k) % P]);
+				const V vSin = Splat<V>(coeff.m_Sin[(r * k) % P]);
+				vAccR = AddMul(vAccR, vSumR[r], vCos);
+				vAccI = AddMul(vAccI, vSumI[r], vCos);
+				vRotR = AddMul(vRotR, vDifI[r], vSin);
+				vRotI = AddMul(vRotI, vDifR[r], vSin);
+			});
+
+			//	Forward transform, so the sine terms are multiplied by -i
+			vR[k] = vAccR + vRotR;
+			vI[k] = vAccI - vRotI;
+			vR[P - k] = vAccR - vRotR;
+			vI[P - k] = vAccI + vRotI;
+		});
+
+		vR[0] = vOut0R;
+		vI[0] = vOut0I;
+	}
+}
+
+
+} // namespace FFTL
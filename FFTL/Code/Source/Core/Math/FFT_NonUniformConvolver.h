@@ -0,0 +1,139 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+#include <tuple>
+#include <utility>
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Convolves with long impulse responses by splitting them into partitions that grow with their distance from the start,
+// so that the cost per block grows with the log of the response length rather than linearly. Each stage S is a uniformly
+// partitioned Convolver with blocks of N << S samples. Every stage but the last covers HEAD_KERNELS partitions, and the
+// last covers the rest of the response, up to T_MAX_TAIL_KERNELS partitions:
+//
+//		|  N  |  N  | 2N  | 2N  |    4N     |    4N     |   ...   |   N << (STAGE_COUNT - 1), T_MAX_TAIL_KERNELS times
+//
+// Latency is one block of N samples, the same as Convolver<M_MIN>. Stage 0 runs every block like a plain Convolver.
+// A larger stage collects its input from the blocks in between, and it runs its forward transform as soon as a block is
+// complete. The inverse transform runs on the next call, since the output isn't due for at least one more block. The
+// products with the remaining partitions only feed later blocks, so ConvolveResumePartial spreads them evenly over the
+// calls until the stage's next block. Each call then does a share of the work instead of all of it landing in one
+// call. The forward and inverse transforms of every stage still land on power of two block boundaries. As an example, a
+// 6 second response at 48kHz needs about 1100 partitions of 256 samples with Convolver<8>. With
+// Convolver_NonUniform<8, 13, 34>, it needs 10 head partitions from 256 to 4096 samples and 34 tail partitions of 8192.
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T = f32>
+class FFTL_NODISCARD Convolver_NonUniform
+{
+	static_assert(M_MIN >= 3, "Blocks of at least 8 samples are needed for the SIMD paths");
+	static_assert(M_MAX > M_MIN, "Use Convolver for a single partition size");
+
+public:
+	static constexpr uint N = 1 << M_MIN;	// Block size, and the latency
+	static constexpr uint STAGE_COUNT = M_MAX - M_MIN + 1;
+	static constexpr size_t HEAD_KERNELS = 2;
+
+	template <uint S> static constexpr size_t GetStageKernelCapacity() { return S + 1 < STAGE_COUNT ? HEAD_KERNELS : T_MAX_TAIL_KERNELS; }
+	template <uint S> static constexpr size_t GetStageOffset() { return HEAD_KERNELS * (N << S) - HEAD_KERNELS * N; } // Where stage S starts in the response
+	static constexpr size_t MAX_KERNEL_LENGTH = GetStageOffset<STAGE_COUNT - 1>() + T_MAX_TAIL_KERNELS * (N << (STAGE_COUNT - 1));
+
+	template <uint S> using StageConvolver = Convolver<M_MIN + S, GetStageKernelCapacity<S>(), T>;
+	template <uint S> using StageKernelArray = FixedArray<typename StageConvolver<S>::Kernel, GetStageKernelCapacity<S>()>;
+
+private:
+	template <typename T_Seq> struct StageTypes;
+	template <uint... S> struct StageTypes<std::integer_sequence<uint, S...>>
+	{
+		using Convolvers = std::tuple<StageConvolver<S>...>;
+		using KernelArrays = std::tuple<StageKernelArray<S>...>;
+	};
+	using Stages = StageTypes<std::make_integer_sequence<uint, STAGE_COUNT>>;
+
+public:
+	//	The frequency domain response for every stage. Like Convolver's kernels, these can be shared between any number of
+	// Convolver_NonUniform instances.
+	struct Kernels
+	{
+		typename Stages::KernelArrays m_Arrays;
+		FixedArray<size_t, STAGE_COUNT> m_Counts;	// Partitions in use per stage, 0 for stages past the end of the response
+
+		template <uint S> FFTL_NODISCARD const StageKernelArray<S>& Get() const { return std::get<S>(m_Arrays); }
+		template <uint S> FFTL_NODISCARD StageKernelArray<S>& Get() { return std::get<S>(m_Arrays); }
+	};
+
+	Convolver_NonUniform();
+
+	//	kernelLength may be anything up to MAX_KERNEL_LENGTH.
+	static void InitKernel(Kernels& kernels, const T* pKernelInput_TD, size_t kernelLength);
+
+	//	OK for input and output arrays to share the same memory space.
+	void Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernels& kernels);
+
+private:
+	static constexpr uint N_MAX = N << (STAGE_COUNT - 1);
+	static constexpr uint OUTPUT_RING_SIZE = 2 * N_MAX;	// Holds everything from GetStageOffset, which is under 2 * N_MAX
+
+	template <uint S> static void InitStageKernel(Kernels& kernels, const T* pKernelInput_TD, size_t kernelLength);
+	template <uint S> void ProcessStage(const Kernels& kernels);
+	void AddToOutputRing(const T* pfInput, uint uOffset, uint uCount);
+
+	typename Stages::Convolvers m_Stages;
+	FixedArray_Aligned32<T, N_MAX> m_InputHistory;			// The last N_MAX input samples, where each stage's blocks are contiguous
+	FixedArray_Aligned32<T, N_MAX> m_StageOutput;			// Scratch for each stage's block of output
+	FixedArray_Aligned32<T, OUTPUT_RING_SIZE> m_OutputRing;	// Output of stages 1 and up that's due in later blocks
+	u32 m_uBlockCount = 0;
+	uint m_uOutputPos = 0;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_NonUniformConvolver.inl"
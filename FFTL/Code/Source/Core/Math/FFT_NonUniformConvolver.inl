@@ -0,0 +1,171 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::Convolver_NonUniform()
+{
+	MemZero(m_InputHistory);
+	MemZero(m_StageOutput);
+	MemZero(m_OutputRing);
+}
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+void Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::InitKernel(Kernels& kernels, const T* pKernelInput_TD, size_t kernelLength)
+{
+	FFTL_ASSERT(kernelLength > 0);
+	FFTL_ASSERT(kernelLength <= MAX_KERNEL_LENGTH);
+
+	InitStageKernel<0>(kernels, pKernelInput_TD, kernelLength);
+}
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+template <uint S>
+void Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::InitStageKernel(Kernels& kernels, const T* pKernelInput_TD, size_t kernelLength)
+{
+	constexpr size_t uOffset = GetStageOffset<S>();
+	constexpr size_t uCapacity = GetStageKernelCapacity<S>() * (N << S);
+
+	const size_t uLength = kernelLength > uOffset ? Min(kernelLength - uOffset, uCapacity) : 0;
+	kernels.m_Counts[S] = uLength > 0 ? StageConvolver<S>::InitKernel(kernels.template Get<S>().data(), pKernelInput_TD + uOffset, uLength) : 0;
+
+	if constexpr (S + 1 < STAGE_COUNT)
+		InitStageKernel<S + 1>(kernels, pKernelInput_TD, kernelLength);
+}
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+void Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::Convolve(FixedArray_Aligned32<T, N>& fOutput, const FixedArray_Aligned32<T, N>& fInput, const Kernels& kernels)
+{
+	//	Keep the input before the output can overwrite it
+	constexpr uint uHistoryBlocks = N_MAX / N;
+	MemCopy(m_InputHistory.data() + (m_uBlockCount & (uHistoryBlocks - 1)) * N, fInput.data(), N);
+
+	std::get<0>(m_Stages).Convolve(fOutput, fInput, kernels.template Get<0>().data(), kernels.m_Counts[0]);
+
+	ProcessStage<1>(kernels);
+
+	//	Collect what the larger stages left for this block, and clear it for the next time around the ring
+	T* pfRing = m_OutputRing.data() + m_uOutputPos;
+	if constexpr (std::is_same<T, f32>::value)
+	{
+		for (uint n = 0; n < N; n += 8)
+		{
+			(f32x8::LoadA(fOutput.data() + n) + f32x8::LoadA(pfRing + n)).StoreA(fOutput.data() + n);
+			f32x8::Zero().StoreA(pfRing + n);
+		}
+	}
+	else
+	{
+		for (uint n = 0; n < N; ++n)
+		{
+			fOutput[n] += pfRing[n];
+			pfRing[n] = 0;
+		}
+	}
+
+	m_uOutputPos = (m_uOutputPos + N) & (OUTPUT_RING_SIZE - 1);
+	++m_uBlockCount;
+}
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+template <uint S>
+void Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::ProcessStage(const Kernels& kernels)
+{
+	constexpr uint N_S = N << S;
+	constexpr uint uPeriod = 1 << S; // Blocks of N per block of this stage
+	constexpr uint uHistoryBlocks = N_MAX / N;
+
+	StageConvolver<S>& stage = std::get<S>(m_Stages);
+	const auto* pKernels = kernels.template Get<S>().data();
+	const size_t kernelCount = kernels.m_Counts[S];
+	const uint uPhase = m_uBlockCount & (uPeriod - 1);
+
+	if (kernelCount > 0 || stage.GetLeftoverKernels() > 0)
+	{
+		if (m_uBlockCount >= uPeriod)
+		{
+			//	The block completed last call is due GetStageOffset samples after its start, which is at least one block from now
+			if (uPhase == 0)
+			{
+				FixedArray_Aligned32<T, N_S>& fStageOutput = *reinterpret_cast<FixedArray_Aligned32<T, N_S>*>(m_StageOutput.data());
+				stage.ConvolveInitial_LastStage(fStageOutput);
+				AddToOutputRing(fStageOutput.data(), static_cast<uint>(GetStageOffset<S>()) - N_S, N_S);
+			}
+
+			//	An even share of the remaining partitions, finishing before the next block needs the accumulation buffers
+			const size_t endKernelIndex = kernelCount > 0 ? 1 + (kernelCount - 1) * (uPhase + 1) / uPeriod : 1;
+			stage.ConvolveResumePartial(kernelCount > 0 ? pKernels : nullptr, kernelCount, endKernelIndex);
+		}
+
+		if (uPhase == uPeriod - 1)
+		{
+			//	The block is contiguous in the history, since N_S divides its length and the block ends on a multiple of N_S
+			const uint uStart = ((m_uBlockCount + 1 - uPeriod) & (uHistoryBlocks - 1)) * N;
+			stage.ConvolveInitial_FirstStage(*reinterpret_cast<const FixedArray_Aligned32<T, N_S>*>(m_InputHistory.data() + uStart), pKernels, kernelCount);
+		}
+	}
+
+	if constexpr (S + 1 < STAGE_COUNT)
+		ProcessStage<S + 1>(kernels);
+}
+
+template <uint M_MIN, uint M_MAX, size_t T_MAX_TAIL_KERNELS, typename T>
+void Convolver_NonUniform<M_MIN, M_MAX, T_MAX_TAIL_KERNELS, T>::AddToOutputRing(const T* pfInput, uint uOffset, uint uCount)
+{
+	//	Offsets and counts are all multiples of N, so both sides stay aligned across the wrap
+	uint uPos = (m_uOutputPos + uOffset) & (OUTPUT_RING_SIZE - 1);
+	while (uCount > 0)
+	{
+		const uint uSpan = Min(uCount, OUTPUT_RING_SIZE - uPos);
+		T* pfRing = m_OutputRing.data() + uPos;
+
+		if constexpr (std::is_same<T, f32>::value)
+		{
+			for (uint n = 0; n < uSpan; n += 8)
+				(f32x8::LoadA(pfRing + n) + f32x8::LoadA(pfInput + n)).StoreA(pfRing + n);
+		}
+		else
+		{
+			for (uint n = 0; n < uSpan; ++n)
+				pfRing[n] += pfInput[n];
+		}
+
+		pfInput += uSpan;
+		uCount -= uSpan;
+		uPos = 0;
+	}
+}
+
+
+} // namespace FFTL
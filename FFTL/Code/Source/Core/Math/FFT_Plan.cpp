@@ -0,0 +1,126 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#if __has_include("../_pch_Core.h")
+#	include "../_pch_Core.h"
+#endif
+
+#include "../defs.h"
+
+#include "FFT_Plan.h"
+
+#include "../Platform/CpuInfo.h"
+#include "../Utils/MetaProgramming.h"
+
+#include <type_traits>
+
+
+namespace FFTL
+{
+
+
+namespace
+{
+
+//	The SIMD specializations have minimum sizes, so fall back to the scalar versions below those.
+constexpr uint FFT_PLAN_COMPLEX_SIMD_MIN_M = 3;
+constexpr uint FFT_PLAN_REAL_SIMD_MIN_M = 5;
+template <uint M> using FFT_Plan_ComplexSimd = std::conditional_t<(M >= FFT_PLAN_COMPLEX_SIMD_MIN_M), FFT<M, f32>, FFT_Base<M, f32>>;
+template <uint M> using FFT_Plan_RealSimd = std::conditional_t<(M >= FFT_PLAN_REAL_SIMD_MIN_M), FFT_Real<M, f32>, FFT_Real_Base<M, f32>>;
+
+template <uint M>
+struct FFT_Plan_Instances
+{
+	static inline const FFT_ComplexV<M, FFT_Plan_ComplexSimd<M>> s_complexSimd{};
+	static inline const FFT_ComplexV<M, FFT_Base<M, f32>> s_complexScalar{};
+	static inline const FFT_RealV<M, FFT_Plan_RealSimd<M>> s_realSimd{};
+	static inline const FFT_RealV<M, FFT_Real_Base<M, f32>> s_realScalar{};
+};
+
+bool FFT_Plan_GetIsSimdEnabled()
+{
+#if defined(FFTL_SIMD_F32x8)
+	return CpuInfo::GetIsArchitectureEnabled(CpuInfo::Architecture::AVX);
+#elif defined(FFTL_SSE)
+	return CpuInfo::GetIsArchitectureEnabled(CpuInfo::Architecture::SSE);
+#else
+	return CpuInfo::GetSupports_SIMD_F32x4() == CpuInfo::Supported::YES;
+#endif
+}
+
+} // namespace
+
+
+ReturnCode FFT_Plan::Init(uint N, Type type, Direction direction)
+{
+	Reset();
+
+	if (N == 0 || (N & (N - 1)) != 0)
+		return ReturnCode::ERROR_INVALID_BUFFER_SIZE;
+
+	const uint M = LS1Bit(static_cast<u32>(N));
+	if (M < MIN_M || M > MAX_M)
+		return ReturnCode::ERROR_INVALID_BUFFER_SIZE;
+
+	const bool bSimd = FFT_Plan_GetIsSimdEnabled();
+
+	constexpr_for<MIN_M, MAX_M + 1, 1>([&](auto i)
+	{
+		if (i == M)
+		{
+			using Instances = FFT_Plan_Instances<i>;
+			if (type == Type::COMPLEX)
+				m_pComplex = bSimd ? static_cast<const FFT_ComplexV_Base*>(&Instances::s_complexSimd) : &Instances::s_complexScalar;
+			else
+				m_pReal = bSimd ? static_cast<const FFT_RealV_Base*>(&Instances::s_realSimd) : &Instances::s_realScalar;
+		}
+	});
+
+	m_M = static_cast<u8>(M);
+	m_type = type;
+	m_direction = direction;
+	m_bSimd = bSimd && M >= (type == Type::COMPLEX ? FFT_PLAN_COMPLEX_SIMD_MIN_M : FFT_PLAN_REAL_SIMD_MIN_M);
+
+	return ReturnCode::OK;
+}
+
+void FFT_Plan::Reset()
+{
+	m_pComplex = nullptr;
+	m_pReal = nullptr;
+	m_M = 0;
+	m_type = Type::COMPLEX;
+	m_direction = Direction::FORWARD;
+	m_bSimd = false;
+}
+
+
+} // namespace FFTL
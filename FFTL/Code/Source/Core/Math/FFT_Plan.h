@@ -0,0 +1,136 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+#include "../ReturnCodes.h"
+
+#include "FFT.h"
+
+//	Largest transform size, as 2^M, that FFT_Plan can be initialized to. Every size up to this one is compiled in, but
+// its twiddle factors and bit reverse indices are only built the first time a plan bound to it by Init() transforms,
+// so unused sizes cost code size and nothing else.
+// With FFTL_SHARED_TWIDDLES, it is also capped to what FFTL_SHARED_TWIDDLES_MAX_M covers.
+#ifndef FFTL_FFT_PLAN_MAX_M
+#	define FFTL_FFT_PLAN_MAX_M 20
+#endif
+
+
+namespace FFTL
+{
+
+
+//	FFT_Plan allows choosing the transform size, type and direction at runtime. The templated transforms for all sizes
+// from 2^MIN_M to 2^MAX_M are instantiated once in FFT_Plan.cpp, and Init() binds to one of them. The SIMD version
+// is used if the matching architecture is enabled in CpuInfo at the time Init() is called, otherwise the scalar version.
+// The smallest sizes have no SIMD version and are always scalar. GetIsSimd() reports which one was bound.
+class FFTL_NODISCARD FFT_Plan
+{
+public:
+	enum class Type : u8
+	{
+		COMPLEX,
+		REAL,
+	};
+
+	enum class Direction : u8
+	{
+		FORWARD,
+		INVERSE,
+	};
+
+	static constexpr uint MIN_M = 2;
+#if FFTL_SHARED_TWIDDLES
+	//	The shared twiddle table only reaches FFTL_SHARED_TWIDDLES_MAX_M, which covers transforms 1 size larger than that.
+	static constexpr uint MAX_M = FFTL_FFT_PLAN_MAX_M <= FFTL_SHARED_TWIDDLES_MAX_M + 1 ? FFTL_FFT_PLAN_MAX_M : FFTL_SHARED_TWIDDLES_MAX_M + 1;
+#else
+	static constexpr uint MAX_M = FFTL_FFT_PLAN_MAX_M;
+#endif
+	static_assert(MAX_M >= MIN_M && MAX_M <= 24, "FFTL_FFT_PLAN_MAX_M out of range");
+
+	FFT_Plan() = default;
+	FFT_Plan(uint N, Type type, Direction direction) { Init(N, type, direction); }
+
+	//	N must be a power of 2 between 2^MIN_M and 2^MAX_M, else ERROR_INVALID_BUFFER_SIZE is returned and the plan is left invalid.
+	ReturnCode Init(uint N, Type type, Direction direction);
+	void Reset();
+
+	FFTL_NODISCARD bool IsValid() const { return m_pComplex != nullptr || m_pReal != nullptr; }
+	FFTL_NODISCARD uint GetN() const { return 1u << m_M; }
+	FFTL_NODISCARD uint GetM() const { return m_M; }
+	FFTL_NODISCARD Type GetType() const { return m_type; }
+	FFTL_NODISCARD Direction GetDirection() const { return m_direction; }
+	FFTL_NODISCARD bool GetIsSimd() const { return m_bSimd; }
+
+	//	Complex plans only. All arrays are N elements long. The inverse transform is not divided by N.
+	void Execute(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const;
+
+	//	Real forward plans only. N time domain samples in, N/2 frequency bins out. The real component of the
+	// Nyquist bin is stored in fFreqOutI[0], in the same manner as FFT_Real.
+	void ExecuteRealForward(const f32* fTimeIn, f32* fFreqOutR, f32* fFreqOutI) const;
+
+	//	Real inverse plans only. Input is in the format output by ExecuteRealForward. The output is divided by N.
+	void ExecuteRealInverse(const f32* fFreqInR, const f32* fFreqInI, f32* fTimeOut) const;
+
+private:
+	const FFT_ComplexV_Base* m_pComplex = nullptr;
+	const FFT_RealV_Base* m_pReal = nullptr;
+	u8 m_M = 0;
+	Type m_type = Type::COMPLEX;
+	Direction m_direction = Direction::FORWARD;
+	bool m_bSimd = false;
+};
+
+
+inline void FFT_Plan::Execute(const f32* fInR, const f32* fInI, f32* fOutR, f32* fOutI) const
+{
+	FFTL_ASSERT(m_pComplex != nullptr);
+	if (m_direction == Direction::FORWARD)
+		m_pComplex->TransformForward(fInR, fInI, fOutR, fOutI);
+	else
+		m_pComplex->TransformInverse(fInR, fInI, fOutR, fOutI);
+}
+
+inline void FFT_Plan::ExecuteRealForward(const f32* fTimeIn, f32* fFreqOutR, f32* fFreqOutI) const
+{
+	FFTL_ASSERT(m_pReal != nullptr && m_direction == Direction::FORWARD);
+	m_pReal->TransformForward(fTimeIn, fFreqOutR, fFreqOutI);
+}
+
+inline void FFT_Plan::ExecuteRealInverse(const f32* fFreqInR, const f32* fFreqInI, f32* fTimeOut) const
+{
+	FFTL_ASSERT(m_pReal != nullptr && m_direction == Direction::INVERSE);
+	m_pReal->TransformInverse(fFreqInR, fFreqInI, fTimeOut);
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,95 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+namespace FFTL
+{
+
+
+//	Pruned transforms of size N = 2^M, for when most of the input is known to be zero or most of the output isn't needed.
+// Both split the transform into P = 2^K transforms of size L = N / P, so the work drops from N * log2(N) to about
+// N * log2(L) plus a pass of N complex multiplies.
+//
+// Input pruning, only the first L samples nonzero, as in zero padding by P for an oversampled spectrum: in the usual DIF
+// graph the first K stages only have zeros for one of their two inputs. Splitting the output bins into the P residue
+// classes k = P * q + r removes those stages:
+//
+//		X[P * q + r] = sum(n = 0 to L - 1) (x[n] * W_N^(n * r)) * W_L^(n * q)
+//
+// Output pruning, only bins in [uBinBegin, uBinEnd) needed, at most L of them: the last K DIT stages mostly produce bins
+// that get thrown away. Splitting the input into P polyphase components computes all of their L point spectra, which
+// the K combining stages would need anyway, and only the wanted bins are combined:
+//
+//		X[k] = sum(p = 0 to P - 1) W_N^(p * k) * Y_p[k mod L],   Y_p = FFT_L(x[P * m + p])
+//
+// Results are in normal order and unnormalized, same as FFT<M, T>::TransformForward. The work buffers hold one L point
+// transform at a time.
+template <uint M, uint K, typename T = f32>
+class FFTL_NODISCARD FFT_Pruned
+{
+	static_assert(K >= 1 && M >= K + 3, "FFT_Pruned needs at least 8 elements in each of the smaller transforms");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint P = 1 << K;
+	static constexpr uint L = N >> K;
+
+	using sm_fft = FFT<M - K, T>;
+
+	FFT_Pruned() = delete;
+
+	//	Only the first L samples of the length N input are nonzero, so only those are passed in.
+	static void TransformForward_PrunedInput(const FixedArray<T, L>& fInR, const FixedArray<T, L>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI);
+	static void TransformForward_PrunedInput(const FixedArray<T, L>& fIn, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI); // Real input
+
+	//	Bins uBinBegin to uBinEnd - 1 are written to the start of fOutR and fOutI. uBinEnd - uBinBegin can't exceed L.
+	static void TransformForward_PrunedOutput(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, L>& fOutR, FixedArray<T, L>& fOutI, uint uBinBegin, uint uBinEnd, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI);
+
+private:
+	//	W_N^m for m in [0, N). The table only covers the first half circle, so the second half is its negative.
+	static void GetTwiddle(uint m, T& fR, T& fI);
+
+	//	Writes the bit reversed output of an in-place DIF transform to every P-th bin, starting at bin r.
+	static void ScatterResidue(const FixedArray<T, L>& fInR, const FixedArray<T, L>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, uint r);
+};
+
+
+} // namespace FFTL
+
+
+#include "FFT_Pruned.inl"
@@ -0,0 +1,156 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, uint K, typename T>
+FFTL_FORCEINLINE void FFT_Pruned<M, K, T>::GetTwiddle(uint m, T& fR, T& fI)
+{
+	const auto& twiddlesR = FFT_Twiddles<M - 1, T>::GetCplxR();
+	const auto& twiddlesI = FFT_Twiddles<M - 1, T>::GetCplxI();
+
+	if (m < N / 2)
+	{
+		fR = twiddlesR[m];
+		fI = twiddlesI[m];
+	}
+	else
+	{
+		fR = -twiddlesR[m - N / 2];
+		fI = -twiddlesI[m - N / 2];
+	}
+}
+
+template <uint M, uint K, typename T>
+FFTL_FORCEINLINE void FFT_Pruned<M, K, T>::ScatterResidue(const FixedArray<T, L>& fInR, const FixedArray<T, L>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, uint r)
+{
+	for (uint j = 0; j < L; ++j)
+	{
+		const uint k = P * sm_fft::GetBitReverseIndex(j) + r;
+		fOutR[k] = fInR[j];
+		fOutI[k] = fInI[j];
+	}
+}
+
+template <uint M, uint K, typename T>
+void FFT_Pruned<M, K, T>::TransformForward_PrunedInput(const FixedArray<T, L>& fInR, const FixedArray<T, L>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI)
+{
+	//	r = 0 has no twiddles. n * r < N for all the rest, so the index never wraps.
+	MemCopy(fWorkR, fInR);
+	MemCopy(fWorkI, fInI);
+	sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+	ScatterResidue(fWorkR, fWorkI, fOutR, fOutI, 0);
+
+	for (uint r = 1; r < P; ++r)
+	{
+		for (uint n = 0; n < L; ++n)
+		{
+			T fWR, fWI;
+			GetTwiddle(n * r, fWR, fWI);
+			fWorkR[n] = fInR[n] * fWR - fInI[n] * fWI;
+			fWorkI[n] = fInR[n] * fWI + fInI[n] * fWR;
+		}
+
+		sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+		ScatterResidue(fWorkR, fWorkI, fOutR, fOutI, r);
+	}
+}
+
+template <uint M, uint K, typename T>
+void FFT_Pruned<M, K, T>::TransformForward_PrunedInput(const FixedArray<T, L>& fIn, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI)
+{
+	MemCopy(fWorkR, fIn);
+	MemZero(fWorkI);
+	sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+	ScatterResidue(fWorkR, fWorkI, fOutR, fOutI, 0);
+
+	for (uint r = 1; r < P; ++r)
+	{
+		for (uint n = 0; n < L; ++n)
+		{
+			T fWR, fWI;
+			GetTwiddle(n * r, fWR, fWI);
+			fWorkR[n] = fIn[n] * fWR;
+			fWorkI[n] = fIn[n] * fWI;
+		}
+
+		sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+		ScatterResidue(fWorkR, fWorkI, fOutR, fOutI, r);
+	}
+}
+
+template <uint M, uint K, typename T>
+void FFT_Pruned<M, K, T>::TransformForward_PrunedOutput(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, L>& fOutR, FixedArray<T, L>& fOutI, uint uBinBegin, uint uBinEnd, FixedArray<T, L>& fWorkR, FixedArray<T, L>& fWorkI)
+{
+	FFTL_ASSERT(uBinBegin <= uBinEnd && uBinEnd <= N && uBinEnd - uBinBegin <= L);
+
+	const uint uBinCount = uBinEnd - uBinBegin;
+
+	//	p = 0 has no twiddles, so it initializes the output.
+	for (uint m = 0; m < L; ++m)
+	{
+		fWorkR[m] = fInR[P * m];
+		fWorkI[m] = fInI[P * m];
+	}
+	sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+	for (uint b = 0; b < uBinCount; ++b)
+	{
+		const uint j = sm_fft::GetBitReverseIndex((uBinBegin + b) & (L - 1));
+		fOutR[b] = fWorkR[j];
+		fOutI[b] = fWorkI[j];
+	}
+
+	for (uint p = 1; p < P; ++p)
+	{
+		for (uint m = 0; m < L; ++m)
+		{
+			fWorkR[m] = fInR[P * m + p];
+			fWorkI[m] = fInI[P * m + p];
+		}
+		sm_fft::TransformForward_InPlace_DIF(fWorkR, fWorkI);
+
+		for (uint b = 0; b < uBinCount; ++b)
+		{
+			const uint k = uBinBegin + b;
+			const uint j = sm_fft::GetBitReverseIndex(k & (L - 1));
+
+			T fWR, fWI;
+			GetTwiddle((p * k) & (N - 1), fWR, fWI);
+			fOutR[b] += fWorkR[j] * fWR - fWorkI[j] * fWI;
+			fOutI[b] += fWorkR[j] * fWI + fWorkI[j] * fWR;
+		}
+	}
+}
+
+
+} // namespace FFTL
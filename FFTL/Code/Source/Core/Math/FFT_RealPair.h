@@ -0,0 +1,76 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+namespace FFTL
+{
+
+
+//	Transforms 2 real signals with a single complex FFT, one in the real part and one in the imaginary part. Since the spectrum of a
+// real signal is Hermitian, the 2 are separated afterwards with A[k] = (Z[k] + conj(Z[N - k])) / 2 and B[k] = (Z[k] - conj(Z[N - k])) / 2i.
+// Good for stereo pairs, or any 2 signals of the same size that are ready at the same time.
+//
+// The spectra use the same layout as FFT_Real: N / 2 bins, with the real valued DC and Nyquist bins packed into the real and imaginary
+// parts of bin 0. The inverse is normalized the same way FFT_Real's is, so spectra from either one can be passed to either inverse.
+//
+// The caller provides work buffers of the same size as the input.
+template <uint M, typename T = f32>
+class FFTL_NODISCARD FFT_RealPair
+{
+	static_assert(M >= 3, "FFT_RealPair needs at least 8 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N / 2;
+
+	using sm_fft = FFT<M, T>;
+
+	FFT_RealPair() = delete;
+
+	static void TransformForward(const FixedArray<T, N>& fInA, const FixedArray<T, N>& fInB, FixedArray<T, N_2>& fOutAR, FixedArray<T, N_2>& fOutAI,
+		FixedArray<T, N_2>& fOutBR, FixedArray<T, N_2>& fOutBI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI);
+
+	static void TransformInverse(const FixedArray<T, N_2>& fInAR, const FixedArray<T, N_2>& fInAI, const FixedArray<T, N_2>& fInBR, const FixedArray<T, N_2>& fInBI,
+		FixedArray<T, N>& fOutA, FixedArray<T, N>& fOutB, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI);
+};
+
+
+} // namespace FFTL
+
+
+#include "FFT_RealPair.inl"
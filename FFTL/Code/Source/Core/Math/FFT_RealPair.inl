@@ -0,0 +1,154 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, typename T>
+void FFT_RealPair<M, T>::TransformForward(const FixedArray<T, N>& fInA, const FixedArray<T, N>& fInB, FixedArray<T, N_2>& fOutAR, FixedArray<T, N_2>& fOutAI,
+	FixedArray<T, N_2>& fOutBR, FixedArray<T, N_2>& fOutBI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+{
+	sm_fft::TransformForward(fInA, fInB, fWorkR, fWorkI);
+
+	const T* pZR = fWorkR.data();
+	const T* pZI = fWorkI.data();
+	T* pAR = fOutAR.data();
+	T* pAI = fOutAI.data();
+	T* pBR = fOutBR.data();
+	T* pBI = fOutBI.data();
+
+	//	DC and Nyquist are packed into bin 0
+	pAR[0] = pZR[0];
+	pAI[0] = pZR[N_2];
+	pBR[0] = pZI[0];
+	pBI[0] = pZI[N_2];
+
+	uint k = 1;
+	for (; k < 4; ++k)
+	{
+		const T fZR = pZR[k];
+		const T fZI = pZI[k];
+		const T fWR = pZR[N - k];
+		const T fWI = pZI[N - k];
+		pAR[k] = static_cast<T>(0.5) * (fZR + fWR);
+		pAI[k] = static_cast<T>(0.5) * (fZI - fWI);
+		pBR[k] = static_cast<T>(0.5) * (fZI + fWI);
+		pBI[k] = static_cast<T>(0.5) * (fWR - fZR);
+	}
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T, f32>)
+	{
+		const f32x4 vHalf = f32x4::Splat(0.5f);
+		for (; k < N_2; k += 4)
+		{
+			//	Z[N - k] for the same 4 values of k is 4 elements further back, in reverse order
+			const f32x4 vZR = f32x4::LoadA(pZR + k);
+			const f32x4 vZI = f32x4::LoadA(pZI + k);
+			const f32x4 vWR = Permute<3, 2, 1, 0>(f32x4::LoadU(pZR + N - 3 - k));
+			const f32x4 vWI = Permute<3, 2, 1, 0>(f32x4::LoadU(pZI + N - 3 - k));
+			((vZR + vWR) * vHalf).StoreA(pAR + k);
+			((vZI - vWI) * vHalf).StoreA(pAI + k);
+			((vZI + vWI) * vHalf).StoreA(pBR + k);
+			((vWR - vZR) * vHalf).StoreA(pBI + k);
+		}
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		const T fZR = pZR[k];
+		const T fZI = pZI[k];
+		const T fWR = pZR[N - k];
+		const T fWI = pZI[N - k];
+		pAR[k] = static_cast<T>(0.5) * (fZR + fWR);
+		pAI[k] = static_cast<T>(0.5) * (fZI - fWI);
+		pBR[k] = static_cast<T>(0.5) * (fZI + fWI);
+		pBI[k] = static_cast<T>(0.5) * (fWR - fZR);
+	}
+}
+
+template <uint M, typename T>
+void FFT_RealPair<M, T>::TransformInverse(const FixedArray<T, N_2>& fInAR, const FixedArray<T, N_2>& fInAI, const FixedArray<T, N_2>& fInBR, const FixedArray<T, N_2>& fInBI,
+	FixedArray<T, N>& fOutA, FixedArray<T, N>& fOutB, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+{
+	const T* pAR = fInAR.data();
+	const T* pAI = fInAI.data();
+	const T* pBR = fInBR.data();
+	const T* pBI = fInBI.data();
+	T* pZR = fWorkR.data();
+	T* pZI = fWorkI.data();
+
+	//	Z[k] = A[k] + i * B[k], and Z[N - k] = conj(A[k]) + i * conj(B[k]). The 1 / N normalization is folded in here.
+	constexpr T fScale = static_cast<T>(1.0 / N);
+
+	pZR[0] = fScale * pAR[0];
+	pZI[0] = fScale * pBR[0];
+	pZR[N_2] = fScale * pAI[0];
+	pZI[N_2] = fScale * pBI[0];
+
+	uint k = 1;
+	for (; k < 4; ++k)
+	{
+		pZR[k] = fScale * (pAR[k] - pBI[k]);
+		pZI[k] = fScale * (pAI[k] + pBR[k]);
+		pZR[N - k] = fScale * (pAR[k] + pBI[k]);
+		pZI[N - k] = fScale * (pBR[k] - pAI[k]);
+	}
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T, f32>)
+	{
+		const f32x4 vScale = f32x4::Splat(fScale);
+		for (; k < N_2; k += 4)
+		{
+			const f32x4 vAR = f32x4::LoadA(pAR + k) * vScale;
+			const f32x4 vAI = f32x4::LoadA(pAI + k) * vScale;
+			const f32x4 vBR = f32x4::LoadA(pBR + k) * vScale;
+			const f32x4 vBI = f32x4::LoadA(pBI + k) * vScale;
+			(vAR - vBI).StoreA(pZR + k);
+			(vAI + vBR).StoreA(pZI + k);
+			Permute<3, 2, 1, 0>(vAR + vBI).StoreU(pZR + N - 3 - k);
+			Permute<3, 2, 1, 0>(vBR - vAI).StoreU(pZI + N - 3 - k);
+		}
+	}
+#endif
+	for (; k < N_2; ++k)
+	{
+		pZR[k] = fScale * (pAR[k] - pBI[k]);
+		pZI[k] = fScale * (pAI[k] + pBR[k]);
+		pZR[N - k] = fScale * (pAR[k] + pBI[k]);
+		pZI[N - k] = fScale * (pBR[k] - pAI[k]);
+	}
+
+	sm_fft::TransformInverse(fWorkR, fWorkI, fOutA, fOutB);
+}
+
+
+} // namespace FFTL
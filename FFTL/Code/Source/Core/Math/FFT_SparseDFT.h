@@ -0,0 +1,173 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+#ifdef _MSC_VER
+#	pragma warning(push)
+#	pragma warning(disable : 4324) // structure was padded due to alignment specifier
+#endif
+
+
+namespace FFTL
+{
+
+
+//	Tracks K arbitrary frequencies over a block of samples with the Goertzel recurrence, one frequency per SIMD lane:
+//
+//		s[n] = x[n] + 2 * cos(w) * s[n - 1] - s[n - 2]
+//
+// Each sample costs one multiply-add and one subtract per lane, compared to N * log2(N) for the full block with FFT_Real.
+// It pays off when K is well under log2(N). Process() may be called any number of times between Reset() calls, and
+// the results are the DFT of everything since the last Reset(). The recurrence is marginally stable, and its rounding
+// error grows with the block length and as w approaches 0 or pi, so reset once per analysis block rather than running
+// it indefinitely. For a result every sample, use FFT_SlidingDFT.
+template <uint K>
+class FFTL_NODISCARD FFT_GoertzelBank
+{
+public:
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+	static constexpr uint LANES = static_cast<uint>(V::GetSize());
+	static constexpr uint K_PADDED = (K + LANES - 1) / LANES * LANES;
+
+	FFT_GoertzelBank() { Reset(); }
+
+	//	Angles are in radians per sample, so bin k of an N point DFT is 2 * pi * k / N.
+	void Init(const FixedArray<f64, K>& fAngles);
+
+	//	Any units may be used, as long as they're the same as fSampleRate.
+	void InitFrequencies(const FixedArray<f64, K>& fFrequencies, f64 fSampleRate);
+
+	void Reset();
+	void Process(const f32* pfInput, uint uCount);
+
+	//	Same scale and phase as the DFT sum over the samples since Reset(), so for an integer bin over N samples this matches FFT_Real.
+	void GetResult(FixedArray<f32, K>& fOutR, FixedArray<f32, K>& fOutI) const;
+	void GetPower(FixedArray<f32, K>& fOut) const;
+
+	FFTL_NODISCARD uint GetSampleCount() const { return m_uSampleCount; }
+
+private:
+	static constexpr uint GROUPS = K_PADDED / LANES;
+
+	//	Each recurrence waits a full multiply-add latency per sample, so this many run side by side to fill the pipeline.
+	// With fewer groups than that, the input is split into RUNS consecutive runs that go at the same time.
+	static constexpr uint CHAINS = 4;
+	static constexpr uint RUNS = GROUPS < CHAINS ? CHAINS / GROUPS : 1;
+	static constexpr uint MIN_RUN_LENGTH = 32;
+
+	static FFTL_FORCEINLINE void Step(const V& vIn, const V& vCoeff, V& vS1, V& vS2);
+	template <uint G_BEGIN, uint G_END>
+	void ProcessGroups(const f32* pfInput, uint uCount);
+	void ProcessRuns(const f32* pfInput, uint uCount, uint uRunLength);
+
+	FixedArray_Aligned32<f32, K_PADDED> m_Coeff;	// 2 * cos(w), padded lanes are 0
+	FixedArray_Aligned32<f32, K_PADDED> m_S1;		// s[n - 1]
+	FixedArray_Aligned32<f32, K_PADDED> m_S2;		// s[n - 2]
+	FixedArray<f64, K> m_Angle;
+	FixedArray<f64, K> m_Cos;
+	FixedArray<f64, K> m_Sin;
+	uint m_uSampleCount = 0;
+};
+
+
+//	DFT of the most recent N = 2^M samples at K chosen bins, updated every sample in O(K) as the window slides:
+//
+//		A_k[n] = A_k[n - 1] + (x[n] - x[n - N]) * W_N^(k * n),	X_k[n] = W_N^(-k * (n + 1)) * A_k[n]
+//
+// This is the modulated form of the sliding DFT. The textbook form multiplies the running sum by a twiddle every sample,
+// which puts its pole right on the unit circle, so rounding errors compound until it's unusable. Here the twiddles come
+// from an exact table lookup at (k * n) mod N and never enter the recursion. That leaves the running sum to drift by
+// adding and subtracting the same samples with different rounding. To stop that, a second sum is built from scratch over
+// each N samples with no subtractions, and it replaces the running sum when each period completes. The error is
+// therefore bounded by one window's worth of rounding, however long it runs. Bins are processed SIMD lanes at a time.
+template <uint M, uint K>
+class FFTL_NODISCARD FFT_SlidingDFT
+{
+	static_assert(M >= 2, "FFT_SlidingDFT needs at least 4 samples in the window");
+
+public:
+	static constexpr uint N = 1 << M;
+
+#if FFTL_SIMD_F32x8
+	using V = f32x8;
+#else
+	using V = f32x4;
+#endif
+	static constexpr uint LANES = static_cast<uint>(V::GetSize());
+	static constexpr uint K_PADDED = (K + LANES - 1) / LANES * LANES;
+
+	FFT_SlidingDFT();
+
+	//	Bins are in [0, N). Also resets.
+	void Init(const FixedArray<uint, K>& uBins);
+
+	//	Clears the window to all zeros.
+	void Reset();
+	void Process(const f32* pfInput, uint uCount);
+
+	//	Bin k of the DFT of the last N samples, same scale and phase as FFT_Real on that window.
+	void GetResult(FixedArray<f32, K>& fOutR, FixedArray<f32, K>& fOutI) const;
+
+private:
+	V GatherTwiddles(const f32* pfTable, uint uGroup) const;
+
+	FixedArray_Aligned32<f32, N> m_TwiddleR;	// W_N^j = e^(-2 * pi * i * j / N)
+	FixedArray_Aligned32<f32, N> m_TwiddleI;
+	FixedArray_Aligned32<f32, N> m_History;		// Ring buffer of the window, oldest sample at m_uPos
+	FixedArray_Aligned32<f32, K_PADDED> m_AR;	// Running sum
+	FixedArray_Aligned32<f32, K_PADDED> m_AI;
+	FixedArray_Aligned32<f32, K_PADDED> m_BR;	// Sum since the start of the current period
+	FixedArray_Aligned32<f32, K_PADDED> m_BI;
+	FixedArray<uint, K_PADDED> m_Bins;			// Padded lanes track bin 0
+	FixedArray<uint, K_PADDED> m_Index;			// (k * n) mod N for the next sample
+	uint m_uPos = 0;
+};
+
+
+} // namespace FFTL
+
+
+#ifdef _MSC_VER
+#	pragma warning(pop)
+#endif
+
+
+#include "FFT_SparseDFT.inl"
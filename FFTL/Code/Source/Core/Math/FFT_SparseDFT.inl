@@ -0,0 +1,364 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint K>
+void FFT_GoertzelBank<K>::Init(const FixedArray<f64, K>& fAngles)
+{
+	MemZero(m_Coeff);
+	for (uint k = 0; k < K; ++k)
+	{
+		m_Angle[k] = fAngles[k];
+		m_Cos[k] = Cos(fAngles[k]);
+		m_Sin[k] = Sin(fAngles[k]);
+		m_Coeff[k] = static_cast<f32>(2 * m_Cos[k]);
+	}
+	Reset();
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::InitFrequencies(const FixedArray<f64, K>& fFrequencies, f64 fSampleRate)
+{
+	FixedArray<f64, K> fAngles;
+	for (uint k = 0; k < K; ++k)
+		fAngles[k] = 2 * PI_64 * fFrequencies[k] / fSampleRate;
+	Init(fAngles);
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::Reset()
+{
+	MemZero(m_S1);
+	MemZero(m_S2);
+	m_uSampleCount = 0;
+}
+
+template <uint K>
+FFTL_FORCEINLINE void FFT_GoertzelBank<K>::Step(const V& vIn, const V& vCoeff, V& vS1, V& vS2)
+{
+	const V vS0 = AddMul(vIn - vS2, vCoeff, vS1);
+	vS2 = vS1;
+	vS1 = vS0;
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::Process(const f32* pfInput, uint uCount)
+{
+	if constexpr (RUNS > 1)
+	{
+		const uint uRunLength = uCount / RUNS;
+		if (uRunLength >= MIN_RUN_LENGTH)
+		{
+			ProcessRuns(pfInput, uCount, uRunLength);
+			m_uSampleCount += uCount;
+			return;
+		}
+	}
+
+	constexpr_for<0u, GROUPS, CHAINS>([&](auto G_BEGIN)
+	{
+		constexpr uint G_END = G_BEGIN + CHAINS < GROUPS ? G_BEGIN + CHAINS : GROUPS;
+		this->template ProcessGroups<G_BEGIN, G_END>(pfInput, uCount);
+	});
+
+	m_uSampleCount += uCount;
+}
+
+template <uint K>
+template <uint G_BEGIN, uint G_END>
+void FFT_GoertzelBank<K>::ProcessGroups(const f32* pfInput, uint uCount)
+{
+	//	The groups keep their state in registers for the whole input, and each sample steps all of them, so their
+	// recurrences overlap instead of each one waiting on its own previous sample.
+	constexpr uint G = G_END - G_BEGIN;
+	V vCoeff[G], vS1[G], vS2[G];
+	constexpr_for<0u, G, 1>([&](auto g)
+	{
+		vCoeff[g] = V::LoadA(m_Coeff + (G_BEGIN + g) * LANES);
+		vS1[g] = V::LoadA(m_S1 + (G_BEGIN + g) * LANES);
+		vS2[g] = V::LoadA(m_S2 + (G_BEGIN + g) * LANES);
+	});
+
+	//	Spelled out, because a loop or lambda here leaves the state on the stack with some compilers
+	static_assert(G <= CHAINS && CHAINS == 4, "Step every chain below");
+	for (uint n = 0; n < uCount; ++n)
+	{
+		const V vIn = V::Splat(pfInput + n);
+		Step(vIn, vCoeff[0], vS1[0], vS2[0]);
+		if constexpr (G > 1)
+			Step(vIn, vCoeff[1], vS1[1], vS2[1]);
+		if constexpr (G > 2)
+			Step(vIn, vCoeff[2], vS1[2], vS2[2]);
+		if constexpr (G > 3)
+			Step(vIn, vCoeff[3], vS1[3], vS2[3]);
+	}
+
+	constexpr_for<0u, G, 1>([&](auto g)
+	{
+		vS1[g].StoreA(m_S1 + (G_BEGIN + g) * LANES);
+		vS2[g].StoreA(m_S2 + (G_BEGIN + g) * LANES);
+	});
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::ProcessRuns(const f32* pfInput, uint uCount, uint uRunLength)
+{
+	//	The first run carries on from the current state, and the rest start from 0. The few samples left over go first,
+	// so the runs are all the same length.
+	const uint uLead = uCount - uRunLength * RUNS;
+	ProcessGroups<0, GROUPS>(pfInput, uLead);
+	pfInput += uLead;
+
+	//	Chain j is group j % GROUPS of run j / GROUPS.
+	static_assert(RUNS * GROUPS == CHAINS && CHAINS == 4, "Step every chain below");
+	V vCoeff[GROUPS], vS1[CHAINS], vS2[CHAINS];
+	const f32* pfRun[RUNS];
+	constexpr_for<0u, CHAINS, 1>([&](auto j)
+	{
+		if constexpr (j < GROUPS)
+		{
+			vCoeff[j] = V::LoadA(m_Coeff + j * LANES);
+			vS1[j] = V::LoadA(m_S1 + j * LANES);
+			vS2[j] = V::LoadA(m_S2 + j * LANES);
+		}
+		else
+		{
+			vS1[j] = V::Zero();
+			vS2[j] = V::Zero();
+		}
+	});
+	constexpr_for<0u, RUNS, 1>([&](auto r)
+	{
+		pfRun[r] = pfInput + r * uRunLength;
+	});
+
+	for (uint n = 0; n < uRunLength; ++n)
+	{
+		Step(V::Splat(pfRun[0] + n), vCoeff[0], vS1[0], vS2[0]);
+		Step(V::Splat(pfRun[1 / GROUPS] + n), vCoeff[1 % GROUPS], vS1[1], vS2[1]);
+		Step(V::Splat(pfRun[2 / GROUPS] + n), vCoeff[2 % GROUPS], vS1[2], vS2[2]);
+		Step(V::Splat(pfRun[3 / GROUPS] + n), vCoeff[3 % GROUPS], vS1[3], vS2[3]);
+	}
+
+	FixedArray_Aligned32<f32, CHAINS * LANES> fRunS1, fRunS2;
+	constexpr_for<0u, CHAINS, 1>([&](auto j)
+	{
+		vS1[j].StoreA(fRunS1 + j * LANES);
+		vS2[j].StoreA(fRunS2 + j * LANES);
+	});
+
+	//	With no input, L steps of the recurrence take (s1, s2) to (U[L] * s1 - U[L-1] * s2, U[L-1] * s1 - U[L-2] * s2),
+	// where U are the Chebyshev polynomials of the 2nd kind at cos(w). Jumping each run's state over the runs after it
+	// and adding them up gives the same state as running them one after another. U[L] and U[L-1] come from squaring
+	// that matrix, starting from the same f32 coefficient the recurrence uses, with
+	// U[m+n] = U[m] * U[n] - U[m-1] * U[n-1] and U[m+n-1] = U[m] * U[n-1] - U[m-1] * U[n-2].
+	// Near w = 0 and pi the state is far larger than the DFT it holds, and the jump makes products L times larger still,
+	// so it's all done in f64 and the state is only rounded once, like a single step.
+	FixedArray<f64, K_PADDED> fU0, fU1, fP0, fP1;
+	for (uint k = 0; k < K_PADDED; ++k)
+	{
+		fU0[k] = 1;	// (U[L], U[L-1]) for the bits of L so far, from A^0
+		fU1[k] = 0;
+		fP0[k] = m_Coeff[k];	// The same for A^1, A^2, A^4...
+		fP1[k] = 1;
+	}
+	for (uint l = uRunLength; ; )
+	{
+		//	Bins on the inside, so their multiplies overlap
+		for (uint k = 0; k < K_PADDED; ++k)
+		{
+			const f64 fC = m_Coeff[k];
+			if (l & 1)
+			{
+				const f64 fT = fU0[k] * fP0[k] - fU1[k] * fP1[k];
+				fU1[k] = fU0[k] * fP1[k] - fU1[k] * (fC * fP1[k] - fP0[k]);
+				fU0[k] = fT;
+			}
+			const f64 fT = fP0[k] * fP0[k] - fP1[k] * fP1[k];
+			fP1[k] = fP0[k] * fP1[k] - fP1[k] * (fC * fP1[k] - fP0[k]);
+			fP0[k] = fT;
+		}
+		l >>= 1;
+		if (l == 0)
+			break;
+	}
+
+	for (uint k = 0; k < K_PADDED; ++k)
+	{
+		const f64 fU2 = m_Coeff[k] * fU1[k] - fU0[k];
+		f64 fSum1 = fRunS1[k];
+		f64 fSum2 = fRunS2[k];
+		for (uint r = 1; r < RUNS; ++r)
+		{
+			const f64 fJump1 = fU0[k] * fSum1 - fU1[k] * fSum2;
+			const f64 fJump2 = fU1[k] * fSum1 - fU2 * fSum2;
+			fSum1 = fJump1 + fRunS1[r * K_PADDED + k];
+			fSum2 = fJump2 + fRunS2[r * K_PADDED + k];
+		}
+		m_S1[k] = static_cast<f32>(fSum1);
+		m_S2[k] = static_cast<f32>(fSum2);
+	}
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::GetResult(FixedArray<f32, K>& fOutR, FixedArray<f32, K>& fOutI) const
+{
+	//	s[N - 1] - e^(-iw) * s[N - 2] is the DFT sum rotated by e^(iw * (N - 1)), so rotate it back.
+	for (uint k = 0; k < K; ++k)
+	{
+		const f64 fS1 = m_S1[k];
+		const f64 fS2 = m_S2[k];
+		const f64 fR = fS1 - m_Cos[k] * fS2;
+		const f64 fI = m_Sin[k] * fS2;
+
+		const f64 fPhase = -m_Angle[k] * (static_cast<f64>(m_uSampleCount) - 1);
+		const f64 fRotR = Cos(fPhase);
+		const f64 fRotI = Sin(fPhase);
+
+		fOutR[k] = static_cast<f32>(fR * fRotR - fI * fRotI);
+		fOutI[k] = static_cast<f32>(fR * fRotI + fI * fRotR);
+	}
+}
+
+template <uint K>
+void FFT_GoertzelBank<K>::GetPower(FixedArray<f32, K>& fOut) const
+{
+	for (uint k = 0; k < K; ++k)
+	{
+		const f32 fS1 = m_S1[k];
+		const f32 fS2 = m_S2[k];
+		fOut[k] = fS1 * fS1 + fS2 * fS2 - m_Coeff[k] * fS1 * fS2;
+	}
+}
+
+
+template <uint M, uint K>
+FFT_SlidingDFT<M, K>::FFT_SlidingDFT()
+{
+	for (uint j = 0; j < N; ++j)
+	{
+		const f64 fAngle = -2 * PI_64 * j / N;
+		m_TwiddleR[j] = static_cast<f32>(Cos(fAngle));
+		m_TwiddleI[j] = static_cast<f32>(Sin(fAngle));
+	}
+
+	MemZero(m_Bins);
+	Reset();
+}
+
+template <uint M, uint K>
+void FFT_SlidingDFT<M, K>::Init(const FixedArray<uint, K>& uBins)
+{
+	for (uint k = 0; k < K; ++k)
+	{
+		FFTL_ASSERT(uBins[k] < N);
+		m_Bins[k] = uBins[k];
+	}
+	Reset();
+}
+
+template <uint M, uint K>
+void FFT_SlidingDFT<M, K>::Reset()
+{
+	MemZero(m_History);
+	MemZero(m_AR);
+	MemZero(m_AI);
+	MemZero(m_BR);
+	MemZero(m_BI);
+	MemZero(m_Index);
+	m_uPos = 0;
+}
+
+template <uint M, uint K>
+FFTL_FORCEINLINE auto FFT_SlidingDFT<M, K>::GatherTwiddles(const f32* pfTable, uint g) const -> V
+{
+	const uint* pIdx = m_Index + g;
+#if FFTL_SIMD_F32x8
+	return V8fSet(pfTable[pIdx[0]], pfTable[pIdx[1]], pfTable[pIdx[2]], pfTable[pIdx[3]], pfTable[pIdx[4]], pfTable[pIdx[5]], pfTable[pIdx[6]], pfTable[pIdx[7]]);
+#else
+	return V4fSet(pfTable[pIdx[0]], pfTable[pIdx[1]], pfTable[pIdx[2]], pfTable[pIdx[3]]);
+#endif
+}
+
+template <uint M, uint K>
+void FFT_SlidingDFT<M, K>::Process(const f32* pfInput, uint uCount)
+{
+	for (uint n = 0; n < uCount; ++n)
+	{
+		const f32 fIn = pfInput[n];
+		const V vIn = V::Splat(fIn);
+		const V vDelta = V::Splat(fIn - m_History[m_uPos]);
+		m_History[m_uPos] = fIn;
+
+		for (uint g = 0; g < K_PADDED; g += LANES)
+		{
+			const V vWR = GatherTwiddles(m_TwiddleR.data(), g);
+			const V vWI = GatherTwiddles(m_TwiddleI.data(), g);
+
+			AddMul(V::LoadA(m_AR + g), vDelta, vWR).StoreA(m_AR + g);
+			AddMul(V::LoadA(m_AI + g), vDelta, vWI).StoreA(m_AI + g);
+			AddMul(V::LoadA(m_BR + g), vIn, vWR).StoreA(m_BR + g);
+			AddMul(V::LoadA(m_BI + g), vIn, vWI).StoreA(m_BI + g);
+		}
+
+		for (uint k = 0; k < K_PADDED; ++k)
+			m_Index[k] = (m_Index[k] + m_Bins[k]) & (N - 1);
+
+		//	The fresh sum now covers exactly the current window, so it takes over from the running one.
+		if (++m_uPos == N)
+		{
+			m_uPos = 0;
+			m_AR = m_BR;
+			m_AI = m_BI;
+			MemZero(m_BR);
+			MemZero(m_BI);
+		}
+	}
+}
+
+template <uint M, uint K>
+void FFT_SlidingDFT<M, K>::GetResult(FixedArray<f32, K>& fOutR, FixedArray<f32, K>& fOutI) const
+{
+	//	m_Index is k * (n + 1) mod N, so multiplying by the conjugate twiddle there undoes the modulation.
+	for (uint k = 0; k < K; ++k)
+	{
+		const f32 fWR = m_TwiddleR[m_Index[k]];
+		const f32 fWI = m_TwiddleI[m_Index[k]];
+		fOutR[k] = m_AR[k] * fWR + m_AI[k] * fWI;
+		fOutI[k] = m_AI[k] * fWR - m_AR[k] * fWI;
+	}
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,82 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+
+
+namespace FFTL
+{
+
+
+//	Stockham auto-sort FFT. Each radix 2 stage reads one buffer and writes the other, reordering as it goes, so the output
+// comes out in natural order without a bit reversal pass or table:
+//
+//		y[q + s * 2p] = x[q + s * p] + x[q + s * (p + m)]
+//		y[q + s * (2p + 1)] = (x[q + s * p] - x[q + s * (p + m)]) * W_2m^p
+//
+// with stride s doubling and half length m halving each stage. All loads and stores are unit stride in q, so large
+// transforms avoid the scattered gathers of the bit reversed stage 0 in FFT. Stages with s of 1 and 2 are vectorized
+// across p instead, interleaving the results in registers. The caller provides a work buffer to ping pong with, and the
+// stages are arranged so that the last one lands in the output. The input is not modified.
+template <uint M, typename T = f32>
+class FFTL_NODISCARD FFT_Stockham
+{
+	static_assert(M >= 3, "FFT_Stockham needs at least 8 elements");
+
+public:
+	//	Precomputed constants
+	static constexpr uint N = 1 << M;
+	static constexpr uint N_2 = N >> 1;
+
+	FFT_Stockham() = delete;
+
+	static void TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI);
+
+	//	No divide by N.
+	static void TransformInverse(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+	{
+		//	Swap the real and imaginary parts.
+		TransformForward(fInI, fInR, fOutI, fOutR, fWorkI, fWorkR);
+	}
+
+private:
+	template <uint STAGE> static void Transform_Stage(const T* pfInR, const T* pfInI, T* pfOutR, T* pfOutI);
+};
+
+
+} // namespace FFTL
+
+
+#include "FFT_Stockham.inl"
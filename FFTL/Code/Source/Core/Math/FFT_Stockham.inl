@@ -0,0 +1,190 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, typename T>
+FFTL_COND_INLINE void FFT_Stockham<M, T>::TransformForward(const FixedArray<T, N>& fInR, const FixedArray<T, N>& fInI, FixedArray<T, N>& fOutR, FixedArray<T, N>& fOutI, FixedArray<T, N>& fWorkR, FixedArray<T, N>& fWorkI)
+{
+	FFTL_ASSERT(fInR.data() != fOutR.data() && fInR.data() != fWorkR.data());
+
+	//	Every stage swaps buffers, so start in whichever one makes the last stage write the output.
+	constexpr_for<0u, M, +1>([&](auto STAGE)
+	{
+		constexpr bool bToOut = ((M - 1 - STAGE) & 1) == 0;
+		T* pfOutR = bToOut ? fOutR.data() : fWorkR.data();
+		T* pfOutI = bToOut ? fOutI.data() : fWorkI.data();
+
+		if constexpr (STAGE == 0)
+			Transform_Stage<STAGE>(fInR.data(), fInI.data(), pfOutR, pfOutI);
+		else
+			Transform_Stage<STAGE>(bToOut ? fWorkR.data() : fOutR.data(), bToOut ? fWorkI.data() : fOutI.data(), pfOutR, pfOutI);
+	});
+}
+
+template <uint M, typename T>
+template <uint STAGE>
+FFTL_FORCEINLINE void FFT_Stockham<M, T>::Transform_Stage(const T* pfInR, const T* pfInI, T* pfOutR, T* pfOutI)
+{
+	constexpr uint S = 1 << STAGE;
+	constexpr uint HALF = N_2 >> STAGE;
+
+	//	W_2m^p, for p < m
+	const T* pfTwR = FFT_Twiddles<M - 1 - STAGE, T>::GetCplxR().data();
+	const T* pfTwI = FFT_Twiddles<M - 1 - STAGE, T>::GetCplxI().data();
+
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T, f32>)
+	{
+		if constexpr (S == 1)
+		{
+			//	Vectorize across p. The sums and differences are interleaved on the way out.
+			for (uint p = 0; p < HALF; p += 4)
+			{
+				const f32x4 vAR = f32x4::LoadA(pfInR + p);
+				const f32x4 vAI = f32x4::LoadA(pfInI + p);
+				const f32x4 vBR = f32x4::LoadA(pfInR + p + HALF);
+				const f32x4 vBI = f32x4::LoadA(pfInI + p + HALF);
+				const f32x4 vWR = f32x4::LoadA(pfTwR + p);
+				const f32x4 vWI = f32x4::LoadA(pfTwI + p);
+
+				const f32x4 vSumR = vAR + vBR;
+				const f32x4 vSumI = vAI + vBI;
+				const f32x4 vDifR = vAR - vBR;
+				const f32x4 vDifI = vAI - vBI;
+				const f32x4 vTwR = vDifR * vWR - vDifI * vWI;
+				const f32x4 vTwI = vDifR * vWI + vDifI * vWR;
+
+				MergeXY(vSumR, vTwR).StoreA(pfOutR + 2 * p + 0);
+				MergeZW(vSumR, vTwR).StoreA(pfOutR + 2 * p + 4);
+				MergeXY(vSumI, vTwI).StoreA(pfOutI + 2 * p + 0);
+				MergeZW(vSumI, vTwI).StoreA(pfOutI + 2 * p + 4);
+			}
+			return;
+		}
+		else if constexpr (S == 2)
+		{
+			//	Vectorize across pairs of p, each holding both values of q.
+			for (uint p = 0; p < HALF; p += 2)
+			{
+				const f32x4 vAR = f32x4::LoadA(pfInR + 2 * p);
+				const f32x4 vAI = f32x4::LoadA(pfInI + 2 * p);
+				const f32x4 vBR = f32x4::LoadA(pfInR + 2 * (p + HALF));
+				const f32x4 vBI = f32x4::LoadA(pfInI + 2 * (p + HALF));
+				const f32x4 vWR = Permute<0, 0, 1, 1>(f32x4::Load2(pfTwR + p));
+				const f32x4 vWI = Permute<0, 0, 1, 1>(f32x4::Load2(pfTwI + p));
+
+				const f32x4 vSumR = vAR + vBR;
+				const f32x4 vSumI = vAI + vBI;
+				const f32x4 vDifR = vAR - vBR;
+				const f32x4 vDifI = vAI - vBI;
+				const f32x4 vTwR = vDifR * vWR - vDifI * vWI;
+				const f32x4 vTwI = vDifR * vWI + vDifI * vWR;
+
+				Permute<0, 1, 4, 5>(vSumR, vTwR).StoreA(pfOutR + 4 * p + 0);
+				Permute<2, 3, 6, 7>(vSumR, vTwR).StoreA(pfOutR + 4 * p + 4);
+				Permute<0, 1, 4, 5>(vSumI, vTwI).StoreA(pfOutI + 4 * p + 0);
+				Permute<2, 3, 6, 7>(vSumI, vTwI).StoreA(pfOutI + 4 * p + 4);
+			}
+			return;
+		}
+		else
+		{
+#if FFTL_SIMD_F32x8
+			using V = std::conditional_t<(S >= 8), f32x8, f32x4>;
+#else
+			using V = f32x4;
+#endif
+			constexpr uint W = V::GetSize();
+
+			//	Unit stride across q with a single twiddle for each p.
+			for (uint p = 0; p < HALF; ++p)
+			{
+				const V vWR = V::Splat(pfTwR + p);
+				const V vWI = V::Splat(pfTwI + p);
+
+				const T* pfAR = pfInR + S * p;
+				const T* pfAI = pfInI + S * p;
+				const T* pfBR = pfInR + S * (p + HALF);
+				const T* pfBI = pfInI + S * (p + HALF);
+				T* pfSumR = pfOutR + S * 2 * p;
+				T* pfSumI = pfOutI + S * 2 * p;
+				T* pfDifR = pfSumR + S;
+				T* pfDifI = pfSumI + S;
+
+				for (uint q = 0; q < S; q += W)
+				{
+					const V vAR = V::LoadA(pfAR + q);
+					const V vAI = V::LoadA(pfAI + q);
+					const V vBR = V::LoadA(pfBR + q);
+					const V vBI = V::LoadA(pfBI + q);
+
+					const V vDifR = vAR - vBR;
+					const V vDifI = vAI - vBI;
+
+					(vAR + vBR).StoreA(pfSumR + q);
+					(vAI + vBI).StoreA(pfSumI + q);
+					(vDifR * vWR - vDifI * vWI).StoreA(pfDifR + q);
+					(vDifR * vWI + vDifI * vWR).StoreA(pfDifI + q);
+				}
+			}
+			return;
+		}
+	}
+#endif
+
+	for (uint p = 0; p < HALF; ++p)
+	{
+		const T fWR = pfTwR[p];
+		const T fWI = pfTwI[p];
+
+		for (uint q = 0; q < S; ++q)
+		{
+			const T fAR = pfInR[q + S * p];
+			const T fAI = pfInI[q + S * p];
+			const T fBR = pfInR[q + S * (p + HALF)];
+			const T fBI = pfInI[q + S * (p + HALF)];
+
+			const T fDifR = fAR - fBR;
+			const T fDifI = fAI - fBI;
+
+			pfOutR[q + S * 2 * p] = fAR + fBR;
+			pfOutI[q + S * 2 * p] = fAI + fBI;
+			pfOutR[q + S * (2 * p + 1)] = fDifR * fWR - fDifI * fWI;
+			pfOutI[q + S * (2 * p + 1)] = fDifR * fWI + fDifI * fWR;
+		}
+	}
+}
+
+
+} // namespace FFTL
@@ -0,0 +1,91 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "FFT.h"
+#include "../Platform/Mutex.h"
+
+#include <memory>
+#include <new>
+#include <vector>
+
+
+namespace FFTL
+{
+
+
+//	Process wide cache of window tables. Every analyzer asking for the same window gets a reference to one shared table
+// instead of computing and storing its own. The key is the window type, width and parameter, and N and the coefficient
+// type through the template arguments. The cache is never destroyed, so returned references stay valid even from static
+// destructors.
+// Lookups take a lock, so call Get() once at init time and keep the reference rather than calling it per frame.
+template <uint M, typename T = f32, typename T_Twiddle = T>
+class FFTL_NODISCARD FFT_WindowCache
+{
+public:
+	using WindowCoefficients = typename FFT_Base<M, T, T_Twiddle>::WindowCoefficients;
+
+	static constexpr uint N = 1 << M;
+
+	FFT_WindowCache() = delete;
+
+	FFTL_NODISCARD static const WindowCoefficients& Get(enFftWindowType windowType, uint uWidth = N, f64 fParam = kFftWindowDefaultParam);
+
+	FFTL_NODISCARD static uint GetEntryCount();
+
+private:
+	struct Entry
+	{
+		Entry(enFftWindowType _windowType, uint _uWidth, f64 _fParam) : windowType(_windowType), uWidth(_uWidth), fParam(_fParam), coeff(_windowType, _uWidth, _fParam) {}
+
+		enFftWindowType windowType;
+		uint uWidth;
+		f64 fParam;
+		WindowCoefficients coeff;
+	};
+
+	struct Cache
+	{
+		Mutex mutex;
+		std::vector<std::unique_ptr<Entry>> entries;
+	};
+
+	static Cache& GetCache();
+};
+
+
+} // namespace FFTL
+
+
+#include "FFT_WindowCache.inl"
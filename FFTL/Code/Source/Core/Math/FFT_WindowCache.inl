@@ -0,0 +1,74 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+namespace FFTL
+{
+
+
+template <uint M, typename T, typename T_Twiddle>
+auto FFT_WindowCache<M, T, T_Twiddle>::GetCache() -> Cache&
+{
+	//	Placement new into static storage, as in FFT_LazyTable, so the cache is never destroyed. Static destructors in other
+	// translation units can then still use the references they were given.
+	alignas(Cache) static unsigned char s_Storage[sizeof(Cache)];
+	static Cache* const s_pCache = new (s_Storage) Cache();
+	return *s_pCache;
+}
+
+template <uint M, typename T, typename T_Twiddle>
+auto FFT_WindowCache<M, T, T_Twiddle>::Get(enFftWindowType windowType, uint uWidth, f64 fParam) -> const WindowCoefficients&
+{
+	fParam = FFT_GetWindowParam(windowType, fParam);
+
+	Cache& cache = GetCache();
+	MutexScopedLock lock(&cache.mutex);
+
+	for (const std::unique_ptr<Entry>& pEntry : cache.entries)
+	{
+		if (pEntry->windowType == windowType && pEntry->uWidth == uWidth && pEntry->fParam == fParam)
+			return pEntry->coeff;
+	}
+
+	//	Computed under the lock, so two threads asking for the same new window don't both build it.
+	cache.entries.push_back(std::make_unique<Entry>(windowType, uWidth, fParam));
+	return cache.entries.back()->coeff;
+}
+
+template <uint M, typename T, typename T_Twiddle>
+uint FFT_WindowCache<M, T, T_Twiddle>::GetEntryCount()
+{
+	Cache& cache = GetCache();
+	MutexScopedLock lock(&cache.mutex);
+	return static_cast<uint>(cache.entries.size());
+}
+
+
+} // namespace FFTL
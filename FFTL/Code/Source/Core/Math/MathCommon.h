@@ -62,6 +62,9 @@ OTHER DEALINGS IN THE SOFTWARE.
 #if defined(FFTL_FMA3)
 #	include <immintrin.h>
 #endif
+#if defined(FFTL_F16C)
+#	include <immintrin.h>
+#endif
 #if defined(FFTL_FMA4)
 #	include <ammintrin.h>
 #endif
@@ -114,25 +117,30 @@ struct alignas(16) Vec2d { f64 x, y; };
 	
 #if defined(FFTL_AVX)
 typedef __m256 Vec8f;
+typedef __m256d Vec4d;
 #else
 struct alignas(32) Vec8f { Vec4f a, b; };
+struct alignas(32) Vec4d { Vec2d a, b; };
 #endif
 
 
 class f32x4;
 class f64x2;
 class f32x8;
+class f64x4;
 class mask32x4;
 class mask32x8;
 
 typedef const Vec4f& Vec4f_In;
 typedef const Vec2d& Vec2d_In;
 typedef const Vec8f& Vec8f_In;
+typedef const Vec4d& Vec4d_In;
 typedef const Vec4u& Vec4u_In;
 typedef const Vec4i& Vec4i_In;
 typedef const f32x4& f32x4_In;
 typedef const f64x2& f64x2_In;
 typedef const f32x8& f32x8_In;
+typedef const f64x4& f64x4_In;
 typedef const mask32x4& mask32x4_In;
 
 //	Deprecated aliases
@@ -417,6 +425,22 @@ FFTL_NODISCARD FFTL_FORCEINLINE T Exp(T r)
 	return std::exp(r);
 }
 
+//	Modified Bessel function of the first kind, order 0, from its power series. Every term is positive, so summing until
+// the terms stop contributing is accurate for any x, just slower as x grows.
+template <typename T>
+FFTL_NODISCARD inline T BesselI0(T x)
+{
+	const T xx_4 = x * x / 4;
+	T fTerm = 1;
+	T fSum = 1;
+	for (uint k = 1; fTerm > fSum * std::numeric_limits<T>::epsilon(); ++k)
+	{
+		fTerm *= xx_4 / static_cast<T>(k * k);
+		fSum += fTerm;
+	}
+	return fSum;
+}
+
 template <typename FLOAT>
 FFTL_NODISCARD constexpr FLOAT FastNormalizedSin( const FLOAT x )
 {
@@ -741,6 +765,43 @@ FFTL_NODISCARD FFTL_FORCEINLINE FFTL_BIT_CAST_CONSTEXPR f64 bit_cast(const u64&
 }
 #endif
 
+//	Half precision conversions, rounding to nearest even in the same way as the F16C instructions, so the scalar and vector
+// paths always agree. Magnitudes of 65520 and up become infinity, and NaNs stay quiet NaNs.
+FFTL_NODISCARD FFTL_FORCEINLINE f32 F16ToF32(f16 h)
+{
+#if defined(FFTL_F16C)
+	return _cvtsh_ss(static_cast<u16>(h));
+#else
+	const u32 uHalf = static_cast<u16>(h);
+	u32 uBits = (uHalf & 0x7fff) << 13;
+	const u32 uExp = uBits & 0x0f800000;
+	uBits += (127 - 15) << 23;
+	if (uExp == 0x0f800000)
+		uBits = (uBits + ((128 - 16) << 23)) | ((uHalf & 0x3ff) ? 0x00400000 : 0); // Inf, or NaN made quiet
+	else if (uExp == 0)
+		uBits = bit_cast<u32>(bit_cast<f32>(uBits + (1 << 23)) - bit_cast<f32>(113u << 23)); // Zero or subnormal, renormalized by the FPU
+	return bit_cast<f32>(uBits | ((uHalf & 0x8000) << 16));
+#endif
+}
+
+FFTL_NODISCARD FFTL_FORCEINLINE f16 F32ToF16(f32 f)
+{
+#if defined(FFTL_F16C)
+	return static_cast<f16>(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+#else
+	const u32 uBits = bit_cast<u32>(f);
+	const u32 uAbs = uBits & 0x7fffffff;
+	u32 uHalf;
+	if (uAbs >= 0x47800000)
+		uHalf = uAbs > 0x7f800000 ? 0x7e00 | ((uAbs >> 13) & 0x3ff) : 0x7c00; // NaN, or too big for a half
+	else if (uAbs < 0x38800000)
+		uHalf = bit_cast<u32>(bit_cast<f32>(uAbs) + 0.5f) - 0x3f000000; // Subnormal, where adding 0.5 lines the mantissa up and rounds it
+	else
+		uHalf = (uAbs + ((15u - 127u) << 23) + 0xfff + ((uAbs >> 13) & 1)) >> 13;
+	return static_cast<f16>(uHalf | ((uBits >> 16) & 0x8000));
+#endif
+}
+
 template <typename T>
 FFTL_NODISCARD FFTL_FORCEINLINE constexpr typename std::enable_if<std::numeric_limits<T>::is_integer && std::numeric_limits<T>::is_signed, T>::type Wrap(T val, T range)
 {
@@ -1345,6 +1406,8 @@ void V4fStoreU(f32* pf, Vec4f_In v);
 void V4fStore1(f32* pf, Vec4f_In v);
 void V4fStore2(f32* pf, Vec4f_In v);
 void V4fStore3(f32* pf, Vec4f_In v);
+FFTL_NODISCARD Vec4f V4fLoadF16(const f16* ph); // Widens 4 halfs, no alignment needed.
+void V4fStoreF16(f16* ph, Vec4f_In v); // Rounds to 4 halfs, no alignment needed.
 void V4fScatter(f32* pf, Vec4f_In v, int iA, int iB, int iC, int iD);
 FFTL_NODISCARD Vec4f V4fSet(f32 x, f32 y, f32 z, f32 w);
 FFTL_NODISCARD Vec4f V4fSet1(f32 x);
@@ -1414,6 +1477,8 @@ FFTL_NODISCARD Vec2d V2dLoadU(const f64* pf);
 void V2dStoreA(f64* pf, Vec2d v);
 void V2dStoreU(f64* pf, Vec2d_In v);
 FFTL_NODISCARD Vec2d V2dSet(f64 x, f64 y);
+FFTL_NODISCARD Vec2d V2dSplat(f64 f);
+FFTL_NODISCARD Vec2d V2dSplat(const f64* pf);
 FFTL_NODISCARD Vec2d V2dAnd(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD Vec2d V2dAndNot(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD Vec2d V2dOr(Vec2d_In a, Vec2d_In b);
@@ -1422,13 +1487,49 @@ FFTL_NODISCARD Vec2d V2dAdd(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD Vec2d V2dSub(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD Vec2d V2dMul(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD Vec2d V2dDiv(Vec2d_In a, Vec2d_In b);
+FFTL_NODISCARD Vec2d V2dAddMul(Vec2d_In a, Vec2d_In b, Vec2d_In c); // a+b*c
+FFTL_NODISCARD Vec2d V2dSubMul(Vec2d_In a, Vec2d_In b, Vec2d_In c); // a-b*c
 FFTL_NODISCARD Vec2d V2dSqrt(Vec2d_In v);
+FFTL_NODISCARD Vec2d V2dReverse(Vec2d_In v);
+FFTL_NODISCARD Vec2d V2dInterleaveLo(Vec2d_In a, Vec2d_In b); // a.x, b.x
+FFTL_NODISCARD Vec2d V2dInterleaveHi(Vec2d_In a, Vec2d_In b); // a.y, b.y
 FFTL_NODISCARD bool V2dIsEqual(Vec2d_In a, Vec2d_In b);
 FFTL_NODISCARD bool V2dIsAllZero(Vec2d_In v);
 
 
 
 
+FFTL_NODISCARD Vec4d V4dZero();
+FFTL_NODISCARD Vec4d V4dLoadA(const f64* pf);
+FFTL_NODISCARD Vec4d V4dLoadU(const f64* pf);
+void V4dStoreA(f64* pf, Vec4d_In v);
+void V4dStoreU(f64* pf, Vec4d_In v);
+FFTL_NODISCARD Vec4d V4dSet(f64 x, f64 y, f64 z, f64 w);
+FFTL_NODISCARD Vec4d V4dSet(Vec2d_In a, Vec2d_In b);
+FFTL_NODISCARD Vec4d V4dSplat(f64 f);
+FFTL_NODISCARD Vec4d V4dSplat(const f64* pf);
+FFTL_NODISCARD Vec4d V4dAnd(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dAndNot(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dOr(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dXOr(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dAdd(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dSub(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dMul(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dDiv(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD Vec4d V4dAddMul(Vec4d_In a, Vec4d_In b, Vec4d_In c); // a+b*c
+FFTL_NODISCARD Vec4d V4dSubMul(Vec4d_In a, Vec4d_In b, Vec4d_In c); // a-b*c
+FFTL_NODISCARD Vec4d V4dSqrt(Vec4d_In v);
+FFTL_NODISCARD Vec4d V4dReverse(Vec4d_In v);
+FFTL_NODISCARD Vec4d V4dInterleaveLo(Vec4d_In a, Vec4d_In b); // a.x, b.x, a.y, b.y
+FFTL_NODISCARD Vec4d V4dInterleaveHi(Vec4d_In a, Vec4d_In b); // a.z, b.z, a.w, b.w
+FFTL_NODISCARD Vec2d V4dGet01(Vec4d_In v);
+FFTL_NODISCARD Vec2d V4dGet23(Vec4d_In v);
+FFTL_NODISCARD bool V4dIsEqual(Vec4d_In a, Vec4d_In b);
+FFTL_NODISCARD bool V4dIsAllZero(Vec4d_In v);
+
+
+
+
 FFTL_NODISCARD Vec8f V8fZero();
 FFTL_NODISCARD Vec8f V8fLoadA(const f32* pf);
 FFTL_NODISCARD Vec8f V8fLoadU(const f32* pf);
@@ -1446,6 +1547,8 @@ void V8fStore2(f32* pf, Vec8f_In v);
 void V8fStore3(f32* pf, Vec8f_In v);
 void V8fStore4(f32* pf, Vec8f_In v);
 void V8fStore6(f32* pf, Vec8f_In v);
+FFTL_NODISCARD Vec8f V8fLoadF16(const f16* ph);
+void V8fStoreF16(f16* ph, Vec8f_In v);
 FFTL_NODISCARD Vec8f V8fSet(f32 x, f32 y, f32 z, f32 w, f32 a, f32 b, f32 c, f32 d);
 FFTL_NODISCARD Vec8f V8fSet(Vec4f_In a, Vec4f_In b);
 FFTL_NODISCARD Vec8f V8fSet0123(Vec8f_In a, Vec4f_In b);
@@ -1478,6 +1581,14 @@ FFTL_NODISCARD int V8fToIntMask(Vec8f_In v);
 FFTL_NODISCARD bool V8fIsEqual(Vec8f_In a, Vec8f_In b);
 FFTL_NODISCARD bool V8fIsAllZero(Vec8f_In v);
 FFTL_NODISCARD Vec8f V8fReverse(Vec8f_In v);
+
+//	Same as V4fPermute(a, b), applied independently to each 128 bit half
+template <int T0, int T1, int T2, int T3>
+FFTL_NODISCARD Vec8f V8fPermute(Vec8f_In a, Vec8f_In b);
+
+//	Selects whole 128 bit halves. 0,1 = lower and upper half of a. 2,3 = lower and upper half of b.
+template <int T_LO, int T_HI>
+FFTL_NODISCARD Vec8f V8fPermute128(Vec8f_In a, Vec8f_In b);
 FFTL_NODISCARD Vec4f V8fAsV4f(Vec8f_In v);
 FFTL_NODISCARD Vec4f V8fGet4567(Vec8f_In v);
 FFTL_NODISCARD Vec8f V8fSin(Vec8f_In r);
@@ -1532,6 +1643,7 @@ public:
 	FFTL_FORCEINLINE static f32x4 Load1(const f32* pf)	{ return f32x4(V4fLoad1(pf)); }
 	FFTL_FORCEINLINE static f32x4 Load2(const f32* pf)	{ return f32x4(V4fLoad2(pf)); }
 	FFTL_FORCEINLINE static f32x4 Load3(const f32* pf)	{ return f32x4(V4fLoad3(pf)); }
+	FFTL_FORCEINLINE static f32x4 LoadF16(const f16* ph)	{ return f32x4(V4fLoadF16(ph)); }
 	FFTL_FORCEINLINE static f32x4 Set1(f32 f)			{ return f32x4(V4fSet1(f)); }
 	FFTL_FORCEINLINE static f32x4 Set2(f32 x, f32 y);
 	FFTL_FORCEINLINE static f32x4 Splat(const f32* pf)	{ return f32x4(V4fSplat(pf)); }
@@ -1543,6 +1655,7 @@ public:
 	FFTL_FORCEINLINE void Store1(f32* pf) const			{ V4fStore1(pf, m_v); }
 	FFTL_FORCEINLINE void Store2(f32* pf) const			{ V4fStore2(pf, m_v); }
 	FFTL_FORCEINLINE void Store3(f32* pf) const			{ V4fStore3(pf, m_v); }
+	FFTL_FORCEINLINE void StoreF16(f16* ph) const		{ V4fStoreF16(ph, m_v); }
 	FFTL_FORCEINLINE void Scatter(f32* pf, int iA, int iB, int iC, int iD) const	{ V4fScatter(pf, m_v, iA, iB, iC, iD); }
 
 	template<enMoveAlignment _A> FFTL_FORCEINLINE static f32x4 Load(const f32* pf)	{ return _A == kAligned ? LoadA(pf) : LoadU(pf); }
@@ -1703,6 +1816,7 @@ public:
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Load3(const f32* pf)	{ return f32x8(V8fLoad3(pf)); }
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Load4(const f32* pf)	{ return f32x8(V8fLoad4(pf)); }
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Load6(const f32* pf)	{ return f32x8(V8fLoad6(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 LoadF16(const f16* ph)	{ return f32x8(V8fLoadF16(ph)); }
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Splat(const f32* pf)	{ return f32x8(V8fSplat(pf)); }
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Splat(f32 f)			{ return f32x8(V8fSplat(f)); }
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Splat(f32x4_In v)		{ return f32x8(V8fSplat(v.GetNative())); }
@@ -1714,6 +1828,7 @@ public:
 	FFTL_FORCEINLINE void Store3(f32* pf) const			{ V8fStore3(pf, m_v); }
 	FFTL_FORCEINLINE void Store4(f32* pf) const			{ V8fStore4(pf, m_v); }
 	FFTL_FORCEINLINE void Store6(f32* pf) const			{ V8fStore6(pf, m_v); }
+	FFTL_FORCEINLINE void StoreF16(f16* ph) const		{ V8fStoreF16(ph, m_v); }
 
 	template<enMoveAlignment _A>
 	FFTL_NODISCARD FFTL_FORCEINLINE static f32x8 Load(const f32* pf)	{ return f32x8(_A==kAligned ? V8fLoadA(pf) : V8fLoadU(pf)); }
@@ -1840,6 +1955,40 @@ template<> FFTL_FORCEINLINE f32 Splat<f32>(const f32* pf) { return *pf; }
 template<> FFTL_FORCEINLINE f32 Splat<f32>(f32 f) { return f; }
 template<> FFTL_FORCEINLINE void Store<1, f32>(f32* pf, const f32& v) { *pf = v; }
 
+template<typename T> FFTL_FORCEINLINE T LoadF16(const f16* ph) { return T::LoadF16(ph); }
+template<typename T> FFTL_FORCEINLINE void StoreF16(f16* ph, const T& v) { v.StoreF16(ph); }
+template<> FFTL_FORCEINLINE f32 LoadF16<f32>(const f16* ph) { return F16ToF32(*ph); }
+template<> FFTL_FORCEINLINE void StoreF16<f32>(f16* ph, const f32& v) { *ph = F32ToF16(v); }
+
+//	Whole array conversions to and from half precision storage. No alignment is needed for either array.
+inline void ConvertF32ToF16(f16* pOut, const f32* pIn, size_t uCount)
+{
+	size_t n = 0;
+#if FFTL_SIMD_F32x8
+	for (; n < (uCount & ~size_t(7)); n += 8)
+		f32x8::LoadU(pIn + n).StoreF16(pOut + n);
+#elif FFTL_SIMD_F32x4
+	for (; n < (uCount & ~size_t(3)); n += 4)
+		f32x4::LoadU(pIn + n).StoreF16(pOut + n);
+#endif
+	for (; n < uCount; ++n)
+		pOut[n] = F32ToF16(pIn[n]);
+}
+
+inline void ConvertF16ToF32(f32* pOut, const f16* pIn, size_t uCount)
+{
+	size_t n = 0;
+#if FFTL_SIMD_F32x8
+	for (; n < (uCount & ~size_t(7)); n += 8)
+		f32x8::LoadF16(pIn + n).StoreU(pOut + n);
+#elif FFTL_SIMD_F32x4
+	for (; n < (uCount & ~size_t(3)); n += 4)
+		f32x4::LoadF16(pIn + n).StoreU(pOut + n);
+#endif
+	for (; n < uCount; ++n)
+		pOut[n] = F16ToF32(pIn[n]);
+}
+
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Min(f32x8_In a, f32x8_In b)		{ return f32x8(V8fMin(a.GetNative(), b.GetNative())); }
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Max(f32x8_In a, f32x8_In b)		{ return f32x8(V8fMax(a.GetNative(), b.GetNative())); }
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Sqrt(f32x8_In v)					{ return f32x8(V8fSqrt(v.GetNative())); }
@@ -1847,6 +1996,11 @@ FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Abs(f32x8_In v)					{ return f32x8(V8fAbs(
 
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Reverse(f32x8_In v)				{ return f32x8(V8fReverse(v.GetNative())); }
 
+template<int T0, int T1, int T2, int T3>
+FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Permute(f32x8_In a, f32x8_In b)	{ return f32x8(V8fPermute<T0,T1,T2,T3>(a.GetNative(), b.GetNative())); }
+template<int T_LO, int T_HI>
+FFTL_NODISCARD FFTL_FORCEINLINE f32x8 Permute128(f32x8_In a, f32x8_In b)	{ return f32x8(V8fPermute128<T_LO,T_HI>(a.GetNative(), b.GetNative())); }
+
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 AddMul(f32x8_In a, f32x8_In b, f32x8_In c) { return V8fAddMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a+b*c
 FFTL_NODISCARD FFTL_FORCEINLINE f32x8 SubMul(f32x8_In a, f32x8_In b, f32x8_In c) { return V8fSubMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a-b*c
 
@@ -1864,6 +2018,153 @@ template<> FFTL_FORCEINLINE void SinCos(const f32x8 r, f32x8& s, f32x8& c) { V8f
 
 
 
+class FFTL_NODISCARD f64x2
+{
+public:
+	using InType = f64x2_In;
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static constexpr size_t GetSize() { return 2; }
+
+	FFTL_FORCEINLINE f64x2() = default;
+	constexpr FFTL_FORCEINLINE f64x2(f64x2_In v) = default;
+	constexpr FFTL_FORCEINLINE f64x2(Vec2d_In v) : m_v(v) {}
+	FFTL_FORCEINLINE f64x2(f64 x, f64 y) : m_v(V2dSet(x, y)) {}
+	FFTL_FORCEINLINE f64x2& operator=(f64x2_In v) = default;
+	FFTL_NODISCARD FFTL_FORCEINLINE operator const Vec2d&() const	{ return GetNative(); }
+	FFTL_NODISCARD FFTL_FORCEINLINE operator Vec2d&()				{ return GetNative(); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x2 Zero()					{ return f64x2(V2dZero()); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x2 LoadA(const f64* pf)	{ return f64x2(V2dLoadA(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x2 LoadU(const f64* pf)	{ return f64x2(V2dLoadU(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x2 Splat(const f64* pf)	{ return f64x2(V2dSplat(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x2 Splat(f64 f)			{ return f64x2(V2dSplat(f)); }
+
+	FFTL_FORCEINLINE void StoreA(f64* pf) const			{ V2dStoreA(pf, m_v); }
+	FFTL_FORCEINLINE void StoreU(f64* pf) const			{ V2dStoreU(pf, m_v); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator+(f64x2_In b) const	{ return f64x2(V2dAdd(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator-(f64x2_In b) const	{ return f64x2(V2dSub(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator*(f64x2_In b) const	{ return f64x2(V2dMul(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator/(f64x2_In b) const	{ return f64x2(V2dDiv(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator&(f64x2_In b) const	{ return f64x2(V2dAnd(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator|(f64x2_In b) const	{ return f64x2(V2dOr(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator^(f64x2_In b) const	{ return f64x2(V2dXOr(m_v, b.m_v)); }
+
+	FFTL_FORCEINLINE f64x2& operator+=(f64x2_In b)		{ m_v = V2dAdd(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x2& operator-=(f64x2_In b)		{ m_v = V2dSub(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x2& operator*=(f64x2_In b)		{ m_v = V2dMul(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x2& operator/=(f64x2_In b)		{ m_v = V2dDiv(m_v, b.m_v);	return *this; }
+
+	//	Scalar methods
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator*(f64 b) const		{ return f64x2(V2dMul(m_v, V2dSplat(b))); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator/(f64 b) const		{ return f64x2(V2dDiv(m_v, V2dSplat(b))); }
+	FFTL_FORCEINLINE f64x2& operator*=(f64 b)			{ m_v = V2dMul(m_v, V2dSplat(b));	return *this; }
+	FFTL_FORCEINLINE f64x2& operator/=(f64 b)			{ m_v = V2dDiv(m_v, V2dSplat(b));	return *this; }
+
+	//	Unary operators
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator+() const			{ return *this; }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 operator-() const			{ return Zero() - *this; }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE bool operator==(f64x2_In b) const	{ return V2dIsEqual(m_v, b.m_v); }
+	FFTL_NODISCARD FFTL_FORCEINLINE bool IsAllZero() const				{ return V2dIsAllZero(m_v); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE const Vec2d& GetNative() const		{ return m_v; }
+	FFTL_NODISCARD FFTL_FORCEINLINE Vec2d& GetNative()					{ return m_v; }
+private:
+	Vec2d m_v;
+};
+
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 Sqrt(f64x2_In v)					{ return f64x2(V2dSqrt(v.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 Reverse(f64x2_In v)				{ return f64x2(V2dReverse(v.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 InterleaveLo(f64x2_In a, f64x2_In b)	{ return f64x2(V2dInterleaveLo(a.GetNative(), b.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 InterleaveHi(f64x2_In a, f64x2_In b)	{ return f64x2(V2dInterleaveHi(a.GetNative(), b.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 AddMul(f64x2_In a, f64x2_In b, f64x2_In c) { return V2dAddMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a+b*c
+FFTL_NODISCARD FFTL_FORCEINLINE f64x2 SubMul(f64x2_In a, f64x2_In b, f64x2_In c) { return V2dSubMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a-b*c
+
+
+
+class FFTL_NODISCARD f64x4
+{
+public:
+	using InType = f64x4_In;
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static constexpr size_t GetSize() { return 4; }
+
+	FFTL_FORCEINLINE f64x4() = default;
+	constexpr FFTL_FORCEINLINE f64x4(f64x4_In v) = default;
+	constexpr FFTL_FORCEINLINE f64x4(Vec4d_In v) : m_v(v) {}
+	FFTL_FORCEINLINE f64x4(f64x2_In a, f64x2_In b) : m_v(V4dSet(a.GetNative(), b.GetNative())) {}
+	FFTL_FORCEINLINE f64x4(f64 x, f64 y, f64 z, f64 w) : m_v(V4dSet(x, y, z, w)) {}
+	FFTL_FORCEINLINE f64x4& operator=(f64x4_In v) = default;
+	FFTL_NODISCARD FFTL_FORCEINLINE operator const Vec4d&() const	{ return GetNative(); }
+	FFTL_NODISCARD FFTL_FORCEINLINE operator Vec4d&()				{ return GetNative(); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x4 Zero()					{ return f64x4(V4dZero()); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x4 LoadA(const f64* pf)	{ return f64x4(V4dLoadA(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x4 LoadU(const f64* pf)	{ return f64x4(V4dLoadU(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x4 Splat(const f64* pf)	{ return f64x4(V4dSplat(pf)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE static f64x4 Splat(f64 f)			{ return f64x4(V4dSplat(f)); }
+
+	FFTL_FORCEINLINE void StoreA(f64* pf) const			{ V4dStoreA(pf, m_v); }
+	FFTL_FORCEINLINE void StoreU(f64* pf) const			{ V4dStoreU(pf, m_v); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 Get01() const				{ return V4dGet01(m_v); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x2 Get23() const				{ return V4dGet23(m_v); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator+(f64x4_In b) const	{ return f64x4(V4dAdd(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator-(f64x4_In b) const	{ return f64x4(V4dSub(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator*(f64x4_In b) const	{ return f64x4(V4dMul(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator/(f64x4_In b) const	{ return f64x4(V4dDiv(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator&(f64x4_In b) const	{ return f64x4(V4dAnd(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator|(f64x4_In b) const	{ return f64x4(V4dOr(m_v, b.m_v)); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator^(f64x4_In b) const	{ return f64x4(V4dXOr(m_v, b.m_v)); }
+
+	FFTL_FORCEINLINE f64x4& operator+=(f64x4_In b)		{ m_v = V4dAdd(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x4& operator-=(f64x4_In b)		{ m_v = V4dSub(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x4& operator*=(f64x4_In b)		{ m_v = V4dMul(m_v, b.m_v);	return *this; }
+	FFTL_FORCEINLINE f64x4& operator/=(f64x4_In b)		{ m_v = V4dDiv(m_v, b.m_v);	return *this; }
+
+	//	Scalar methods
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator*(f64 b) const		{ return f64x4(V4dMul(m_v, V4dSplat(b))); }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator/(f64 b) const		{ return f64x4(V4dDiv(m_v, V4dSplat(b))); }
+	FFTL_FORCEINLINE f64x4& operator*=(f64 b)			{ m_v = V4dMul(m_v, V4dSplat(b));	return *this; }
+	FFTL_FORCEINLINE f64x4& operator/=(f64 b)			{ m_v = V4dDiv(m_v, V4dSplat(b));	return *this; }
+
+	//	Unary operators
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator+() const			{ return *this; }
+	FFTL_NODISCARD FFTL_FORCEINLINE f64x4 operator-() const			{ return Zero() - *this; }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE bool operator==(f64x4_In b) const	{ return V4dIsEqual(m_v, b.m_v); }
+	FFTL_NODISCARD FFTL_FORCEINLINE bool IsAllZero() const				{ return V4dIsAllZero(m_v); }
+
+	FFTL_NODISCARD FFTL_FORCEINLINE const Vec4d& GetNative() const		{ return m_v; }
+	FFTL_NODISCARD FFTL_FORCEINLINE Vec4d& GetNative()					{ return m_v; }
+private:
+	Vec4d m_v;
+};
+
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 Sqrt(f64x4_In v)					{ return f64x4(V4dSqrt(v.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 Reverse(f64x4_In v)				{ return f64x4(V4dReverse(v.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 InterleaveLo(f64x4_In a, f64x4_In b)	{ return f64x4(V4dInterleaveLo(a.GetNative(), b.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 InterleaveHi(f64x4_In a, f64x4_In b)	{ return f64x4(V4dInterleaveHi(a.GetNative(), b.GetNative())); }
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 AddMul(f64x4_In a, f64x4_In b, f64x4_In c) { return V4dAddMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a+b*c
+FFTL_NODISCARD FFTL_FORCEINLINE f64x4 SubMul(f64x4_In a, f64x4_In b, f64x4_In c) { return V4dSubMul(a.GetNative(), b.GetNative(), c.GetNative()); } // a-b*c
+
+template<typename T> FFTL_FORCEINLINE T LoadA(const f64* pf) { return T::LoadA(pf); }
+template<typename T> FFTL_FORCEINLINE T LoadU(const f64* pf) { return T::LoadU(pf); }
+template<typename T> FFTL_FORCEINLINE T Splat(const f64* pf) { return T::Splat(pf); }
+template<typename T> FFTL_FORCEINLINE T Splat(f64 f) { return T::Splat(f); }
+template<typename T> FFTL_FORCEINLINE void StoreA(f64* pf, const T& v) { v.StoreA(pf); }
+template<typename T> FFTL_FORCEINLINE void StoreU(f64* pf, const T& v) { v.StoreU(pf); }
+
+//	f64 specializations
+template<> FFTL_FORCEINLINE f64 Splat<f64>(const f64* pf) { return *pf; }
+template<> FFTL_FORCEINLINE f64 Splat<f64>(f64 f) { return f; }
+
+
+
 // Purpose: mask32x4 - Holds a vector comparison result, or used to mask vectors using bitwise logical operators.
 class mask32x4
 {
@@ -113,6 +113,25 @@ FFTL_FORCEINLINE void V4fStore3(f32* pf, Vec4f_In v)
 	vst1_f32(pf, vget_low_f32(v));
 	vst1q_lane_f32(pf+2, v, 2);
 }
+FFTL_FORCEINLINE Vec4f V4fLoadF16(const f16* ph)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+	return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(reinterpret_cast<const u16*>(ph))));
+#else
+	return V4fSet(F16ToF32(ph[0]), F16ToF32(ph[1]), F16ToF32(ph[2]), F16ToF32(ph[3]));
+#endif
+}
+FFTL_FORCEINLINE void V4fStoreF16(f16* ph, Vec4f_In v)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+	vst1_u16(reinterpret_cast<u16*>(ph), vreinterpret_u16_f16(vcvt_f16_f32(v)));
+#else
+	ph[0] = F32ToF16(vgetq_lane_f32(v, 0));
+	ph[1] = F32ToF16(vgetq_lane_f32(v, 1));
+	ph[2] = F32ToF16(vgetq_lane_f32(v, 2));
+	ph[3] = F32ToF16(vgetq_lane_f32(v, 3));
+#endif
+}
 FFTL_FORCEINLINE void V4fScatter(f32* pf, Vec4f_In v, int iA, int iB, int iC, int iD)
 {
 	vst1q_lane_f32(pf+iA, v, 0);
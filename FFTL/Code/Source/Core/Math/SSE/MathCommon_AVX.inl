@@ -127,6 +127,23 @@ FFTL_FORCEINLINE void V8fStore6(f32* pf, Vec8f_In v)
 	V4fStoreU(pf+0, _mm256_castps256_ps128(v));
 	V4fStore2(pf+4, V8fGet4567(v));
 }
+FFTL_FORCEINLINE Vec8f V8fLoadF16(const f16* ph)
+{
+#if defined(FFTL_F16C)
+	return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ph)));
+#else
+	return V8fSet(V4fLoadF16(ph+0), V4fLoadF16(ph+4));
+#endif
+}
+FFTL_FORCEINLINE void V8fStoreF16(f16* ph, Vec8f_In v)
+{
+#if defined(FFTL_F16C)
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(ph), _mm256_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+	V4fStoreF16(ph+0, _mm256_castps256_ps128(v));
+	V4fStoreF16(ph+4, V8fGet4567(v));
+#endif
+}
 FFTL_FORCEINLINE Vec8f V8fSet(f32 x, f32 y, f32 z, f32 w, f32 a, f32 b, f32 c, f32 d)
 {
 	return _mm256_setr_ps(x, y, z, w, a, b, c, d);
@@ -277,6 +294,39 @@ FFTL_FORCEINLINE Vec8f V8fReverse(Vec8f_In v)
 	r = _mm256_permute2f128_ps(r, r, 1);
 	return r;
 }
+template <int T0, int T1, int T2, int T3>
+FFTL_FORCEINLINE Vec8f V8fPermute(Vec8f_In a, Vec8f_In b)
+{
+	static_assert(T0 >= 0 && T0 < 8 && T1 >= 0 && T1 < 8 && T2 >= 0 && T2 < 8 && T3 >= 0 && T3 < 8, "Permute indices out of range");
+
+	if constexpr (T0 == 0 && T1 == 4 && T2 == 1 && T3 == 5)
+		return _mm256_unpacklo_ps(a, b);
+	else if constexpr (T0 == 2 && T1 == 6 && T2 == 3 && T3 == 7)
+		return _mm256_unpackhi_ps(a, b);
+	else if constexpr (T0 == 4 && T1 == 0 && T2 == 5 && T3 == 1)
+		return _mm256_unpacklo_ps(b, a);
+	else if constexpr (T0 == 6 && T1 == 2 && T2 == 7 && T3 == 3)
+		return _mm256_unpackhi_ps(b, a);
+	else if constexpr (T0 < 4 && T1 < 4 && T2 >= 4 && T3 >= 4)
+		return _mm256_shuffle_ps(a, b, FFTL_MM_SHUFFLE_XYZW(T0, T1, T2 & 3, T3 & 3));
+	else if constexpr (T0 >= 4 && T1 >= 4 && T2 < 4 && T3 < 4)
+		return _mm256_shuffle_ps(b, a, FFTL_MM_SHUFFLE_XYZW(T0 & 3, T1 & 3, T2, T3));
+	else
+	{
+		//	Generic case, shuffle both sources the same way, then blend in the components taken from b.
+		constexpr int nShuf = FFTL_MM_SHUFFLE_XYZW(T0 & 3, T1 & 3, T2 & 3, T3 & 3);
+		constexpr int nBlend4 = (T0 >> 2) | ((T1 >> 2) << 1) | ((T2 >> 2) << 2) | ((T3 >> 2) << 3);
+		const Vec8f va = _mm256_permute_ps(a, nShuf);
+		const Vec8f vb = _mm256_permute_ps(b, nShuf);
+		return _mm256_blend_ps(va, vb, nBlend4 | (nBlend4 << 4));
+	}
+}
+template <int T_LO, int T_HI>
+FFTL_FORCEINLINE Vec8f V8fPermute128(Vec8f_In a, Vec8f_In b)
+{
+	static_assert(T_LO >= 0 && T_LO < 4 && T_HI >= 0 && T_HI < 4, "Permute128 indices out of range");
+	return _mm256_permute2f128_ps(a, b, T_LO | (T_HI << 4));
+}
 FFTL_FORCEINLINE Vec4f V8fAsV4f(Vec8f_In v)
 {
 	return _mm256_castps256_ps128(v);
@@ -666,6 +716,139 @@ inline void V8fSinCos(Vec8f_In r, Vec8f& s, Vec8f& c)
 }
 
 
+
+
+
+
+FFTL_FORCEINLINE Vec4d V4dZero()
+{
+	return _mm256_setzero_pd();
+}
+FFTL_FORCEINLINE Vec4d V4dLoadA(const f64* pf)
+{
+	FFTL_ASSERT(((size_t)pf & 31) == 0);
+	return _mm256_load_pd(pf);
+}
+FFTL_FORCEINLINE Vec4d V4dLoadU(const f64* pf)
+{
+	return _mm256_loadu_pd(pf);
+}
+FFTL_FORCEINLINE void V4dStoreA(f64* pf, Vec4d_In v)
+{
+	FFTL_ASSERT(((size_t)pf & 31) == 0);
+	_mm256_store_pd(pf, v);
+}
+FFTL_FORCEINLINE void V4dStoreU(f64* pf, Vec4d_In v)
+{
+	_mm256_storeu_pd(pf, v);
+}
+FFTL_FORCEINLINE Vec4d V4dSet(f64 x, f64 y, f64 z, f64 w)
+{
+	return _mm256_setr_pd(x, y, z, w);
+}
+FFTL_FORCEINLINE Vec4d V4dSet(Vec2d_In a, Vec2d_In b)
+{
+	return _mm256_insertf128_pd(_mm256_castpd128_pd256(a), b, 1);
+}
+FFTL_FORCEINLINE Vec4d V4dSplat(f64 f)
+{
+	return _mm256_set1_pd(f);
+}
+FFTL_FORCEINLINE Vec4d V4dSplat(const f64* pf)
+{
+	return _mm256_broadcast_sd(pf);
+}
+FFTL_FORCEINLINE Vec4d V4dAnd(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_and_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dAndNot(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_andnot_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dOr(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_or_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dXOr(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_xor_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dAdd(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_add_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dSub(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_sub_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dMul(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_mul_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dDiv(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_div_pd(a, b);
+}
+FFTL_FORCEINLINE Vec4d V4dAddMul(Vec4d_In a, Vec4d_In b, Vec4d_In c)
+{
+#if defined(FFTL_FMA4)
+	return _mm256_macc_pd(b, c, a);
+#elif defined(FFTL_FMA3)
+	return _mm256_fmadd_pd(b, c, a);
+#else
+	return _mm256_add_pd(a, _mm256_mul_pd(b, c));
+#endif
+}
+FFTL_FORCEINLINE Vec4d V4dSubMul(Vec4d_In a, Vec4d_In b, Vec4d_In c)
+{
+#if defined(FFTL_FMA4)
+	return _mm256_nmacc_pd(b, c, a);
+#elif defined(FFTL_FMA3)
+	return _mm256_fnmadd_pd(b, c, a);
+#else
+	return _mm256_sub_pd(a, _mm256_mul_pd(b, c));
+#endif
+}
+FFTL_FORCEINLINE Vec4d V4dSqrt(Vec4d_In v)
+{
+	return _mm256_sqrt_pd(v);
+}
+FFTL_FORCEINLINE Vec4d V4dReverse(Vec4d_In v)
+{
+	const __m256d r = _mm256_permute2f128_pd(v, v, 1); // z, w, x, y
+	return _mm256_permute_pd(r, 5); // w, z, y, x
+}
+FFTL_FORCEINLINE Vec4d V4dInterleaveLo(Vec4d_In a, Vec4d_In b)
+{
+	const __m256d lo = _mm256_unpacklo_pd(a, b); // a.x, b.x, a.z, b.z
+	const __m256d hi = _mm256_unpackhi_pd(a, b); // a.y, b.y, a.w, b.w
+	return _mm256_permute2f128_pd(lo, hi, 0x20);
+}
+FFTL_FORCEINLINE Vec4d V4dInterleaveHi(Vec4d_In a, Vec4d_In b)
+{
+	const __m256d lo = _mm256_unpacklo_pd(a, b);
+	const __m256d hi = _mm256_unpackhi_pd(a, b);
+	return _mm256_permute2f128_pd(lo, hi, 0x31);
+}
+FFTL_FORCEINLINE Vec2d V4dGet01(Vec4d_In v)
+{
+	return _mm256_castpd256_pd128(v);
+}
+FFTL_FORCEINLINE Vec2d V4dGet23(Vec4d_In v)
+{
+	return _mm256_extractf128_pd(v, 1);
+}
+FFTL_FORCEINLINE bool V4dIsEqual(Vec4d_In a, Vec4d_In b)
+{
+	return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)) == 15;
+}
+FFTL_FORCEINLINE bool V4dIsAllZero(Vec4d_In v)
+{
+	return _mm256_movemask_pd(_mm256_cmp_pd(v, _mm256_setzero_pd(), _CMP_EQ_OQ)) == 15;
+}
+
+
 } // namespace FFTL
 
 #endif //_FFTL_MATH_AVX_INL
@@ -185,6 +185,35 @@ FFTL_FORCEINLINE void V4fStore3(f32* pf, Vec4f_In v)
 	_mm_storel_pi((__m64*)pf, v);
 	_mm_store_ss(pf+2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2,2,2,2)));
 }
+FFTL_FORCEINLINE Vec4f V4fLoadF16(const f16* ph)
+{
+#if defined(FFTL_F16C)
+	return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ph)));
+#elif defined(FFTL_SSE2)
+	//	Moving the exponent and mantissa into place and scaling by 2^112 rebiases normals and renormalizes subnormals in one
+	// multiply. Inf and NaN then only need their exponent filled in, and NaNs made quiet like F16C does.
+	const __m128i vHalf = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ph)), _mm_setzero_si128());
+	const __m128i vExpMant = _mm_and_si128(vHalf, _mm_set1_epi32(0x7fff));
+	const __m128 vScaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(vExpMant, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+	const __m128i vInf = _mm_and_si128(_mm_cmpgt_epi32(vExpMant, _mm_set1_epi32(0x7bff)), _mm_set1_epi32(255 << 23));
+	const __m128i vNaN = _mm_and_si128(_mm_cmpgt_epi32(vExpMant, _mm_set1_epi32(0x7c00)), _mm_set1_epi32(0x00400000));
+	const __m128i vSign = _mm_slli_epi32(_mm_xor_si128(vHalf, vExpMant), 16);
+	return _mm_or_ps(vScaled, _mm_castsi128_ps(_mm_or_si128(_mm_or_si128(vInf, vNaN), vSign)));
+#else
+	return V4fSet(F16ToF32(ph[0]), F16ToF32(ph[1]), F16ToF32(ph[2]), F16ToF32(ph[3]));
+#endif
+}
+FFTL_FORCEINLINE void V4fStoreF16(f16* ph, Vec4f_In v)
+{
+#if defined(FFTL_F16C)
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(ph), _mm_cvtps_ph(v, _MM_FROUND_TO_NEAREST_INT));
+#else
+	alignas(16) f32 f[4];
+	_mm_store_ps(f, v);
+	for (uint i = 0; i < 4; ++i)
+		ph[i] = F32ToF16(f[i]);
+#endif
+}
 FFTL_FORCEINLINE void V4fScatter(f32* pf, Vec4f_In v, int iA, int iB, int iC, int iD)
 {
 #if defined(FFTL_SSE4)
@@ -853,6 +882,14 @@ FFTL_FORCEINLINE Vec2d V2dSet(f64 x, f64 y)
 {
 	return _mm_setr_pd(x, y);
 }
+FFTL_FORCEINLINE Vec2d V2dSplat(f64 f)
+{
+	return _mm_set1_pd(f);
+}
+FFTL_FORCEINLINE Vec2d V2dSplat(const f64* pf)
+{
+	return _mm_load1_pd(pf);
+}
 FFTL_FORCEINLINE Vec2d V2dAnd(Vec2d_In a, Vec2d_In b)
 {
 	return _mm_and_pd(a, b);
@@ -885,10 +922,42 @@ FFTL_FORCEINLINE Vec2d V2dDiv(Vec2d_In a, Vec2d_In b)
 {
 	return _mm_div_pd(a, b);
 }
+FFTL_FORCEINLINE Vec2d V2dAddMul(Vec2d_In a, Vec2d_In b, Vec2d_In c)
+{
+#if defined(FFTL_FMA4)
+	return _mm_macc_pd(b, c, a);
+#elif defined(FFTL_FMA3)
+	return _mm_fmadd_pd(b, c, a);
+#else
+	return _mm_add_pd(a, _mm_mul_pd(b, c));
+#endif
+}
+FFTL_FORCEINLINE Vec2d V2dSubMul(Vec2d_In a, Vec2d_In b, Vec2d_In c)
+{
+#if defined(FFTL_FMA4)
+	return _mm_nmacc_pd(b, c, a);
+#elif defined(FFTL_FMA3)
+	return _mm_fnmadd_pd(b, c, a);
+#else
+	return _mm_sub_pd(a, _mm_mul_pd(b, c));
+#endif
+}
 FFTL_FORCEINLINE Vec2d V2dSqrt(Vec2d_In v)
 {
 	return _mm_sqrt_pd(v);
 }
+FFTL_FORCEINLINE Vec2d V2dReverse(Vec2d_In v)
+{
+	return _mm_shuffle_pd(v, v, _MM_SHUFFLE2(0, 1));
+}
+FFTL_FORCEINLINE Vec2d V2dInterleaveLo(Vec2d_In a, Vec2d_In b)
+{
+	return _mm_unpacklo_pd(a, b);
+}
+FFTL_FORCEINLINE Vec2d V2dInterleaveHi(Vec2d_In a, Vec2d_In b)
+{
+	return _mm_unpackhi_pd(a, b);
+}
 FFTL_FORCEINLINE bool V2dIsEqual(Vec2d_In a, Vec2d_In b)
 {
 	return _mm_movemask_pd( _mm_cmpeq_pd(a, b) ) == 3;
@@ -0,0 +1,116 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "MathCommon.h"
+
+
+namespace FFTL
+{
+
+
+#if FFTL_SIMD_F32x4
+//	Transposes 4 rows of 4 in registers, so that v[k] ends up holding element k of every row.
+FFTL_FORCEINLINE void Transpose4x4(f32x4 (&v)[4])
+{
+	const f32x4 v01Lo = MergeXY(v[0], v[1]);
+	const f32x4 v23Lo = MergeXY(v[2], v[3]);
+	const f32x4 v01Hi = MergeZW(v[0], v[1]);
+	const f32x4 v23Hi = MergeZW(v[2], v[3]);
+
+	v[0] = Permute<0, 1, 4, 5>(v01Lo, v23Lo);
+	v[1] = Permute<2, 3, 6, 7>(v01Lo, v23Lo);
+	v[2] = Permute<0, 1, 4, 5>(v01Hi, v23Hi);
+	v[3] = Permute<2, 3, 6, 7>(v01Hi, v23Hi);
+}
+#endif
+
+//	Transposes a single TILE x TILE tile. Rows of the input are uInStride elements apart, and rows of the output uOutStride apart. For
+// f32, 4x4 blocks are transposed in registers, which needs TILE to be a multiple of 4 and every row to be 16 byte aligned.
+template <uint TILE, typename T>
+FFTL_FORCEINLINE void TransposeTile(const T* pIn, uint uInStride, T* pOut, uint uOutStride)
+{
+#if FFTL_SIMD_F32x4
+	if constexpr (std::is_same_v<T, f32> && TILE % 4 == 0)
+	{
+		for (uint tr = 0; tr < TILE; tr += 4)
+		{
+			for (uint tc = 0; tc < TILE; tc += 4)
+			{
+				f32x4 v[4] =
+				{
+					f32x4::LoadA(pIn + (tr + 0) * uInStride + tc),
+					f32x4::LoadA(pIn + (tr + 1) * uInStride + tc),
+					f32x4::LoadA(pIn + (tr + 2) * uInStride + tc),
+					f32x4::LoadA(pIn + (tr + 3) * uInStride + tc),
+				};
+				Transpose4x4(v);
+
+				v[0].StoreA(pOut + (tc + 0) * uOutStride + tr);
+				v[1].StoreA(pOut + (tc + 1) * uOutStride + tr);
+				v[2].StoreA(pOut + (tc + 2) * uOutStride + tr);
+				v[3].StoreA(pOut + (tc + 3) * uOutStride + tr);
+			}
+		}
+		return;
+	}
+#endif
+	for (uint tr = 0; tr < TILE; ++tr)
+	{
+		for (uint tc = 0; tc < TILE; ++tc)
+		{
+			pOut[tc * uOutStride + tr] = pIn[tr * uInStride + tc];
+		}
+	}
+}
+
+//	Transposes a ROWS x COLS row major matrix into a COLS x ROWS one, a TILE x TILE tile at a time so that both the reads and the writes
+// stay within a few cache lines per tile row. Only the rows of tiles uTileRowBegin to uTileRowEnd are done, so the work can be split
+// into independent ranges.
+template <uint ROWS, uint COLS, uint TILE, typename T>
+FFTL_FORCEINLINE void TransposeTiled(const T* pIn, T* pOut, uint uTileRowBegin, uint uTileRowEnd)
+{
+	static_assert(ROWS % TILE == 0 && COLS % TILE == 0, "Tiles must evenly divide the matrix");
+
+	for (uint r = uTileRowBegin * TILE; r < uTileRowEnd * TILE; r += TILE)
+	{
+		for (uint c = 0; c < COLS; c += TILE)
+		{
+			TransposeTile<TILE>(pIn + r * COLS + c, COLS, pOut + c * ROWS + r, ROWS);
+		}
+	}
+}
+
+
+} // namespace FFTL
@@ -70,7 +70,7 @@ private:
 // Event is all we really need in this case because otherwise we'd just use a semaphore with a single token.
 
 inline ThreadEvent::ThreadEvent(const char* pszName)
-	: m_Handle( ::CreateEventA(nullptr, FALSE, FALSE, pszName != nullptr ? pszName : "ThreadEvent") )
+	: m_Handle( ::CreateEventA(nullptr, FALSE, FALSE, pszName) )
 {
 	FFTL_ASSERT_MSG(m_Handle, "ThreadEvent() : CreateEvent failed!");
 }
@@ -144,7 +144,7 @@ inline void ThreadEvent::Unsignal()
 #elif defined(FFTL_THREAD_USE_POSIX)
 
 inline ThreadEvent::ThreadEvent(const char* pszName)
-	: m_Handle{ ::eventfd(POLLIN | POLLOUT, 0), 0, 0 }
+	: m_Handle{ ::eventfd(0, 0), POLLIN, 0 }
 {
 	(void)pszName;
 	FFTL_ASSERT_MSG(m_Handle.fd, "ThreadEvent() : eventfd failed!");
@@ -163,14 +163,15 @@ inline void ThreadEvent::Wait()
 }
 inline bool ThreadEvent::Wait(u32 timeOut_mS)
 {
+	const int result = ::poll(&m_Handle, 1, static_cast<int>(timeOut_mS));
+	FFTL_ASSERT_MSG( result == 0 || result == 1, "ThreadEvent::Wait() : poll failed!" );
+	if (result == 0)
+		return true;
+
 	uint64_t value;
 	FFTL_VERIFY_EQ_MSG( sizeof(value), ::read(m_Handle.fd, &value, sizeof(value)), "ThreadEvent::Wait() : read failed!" );
 	return false;
 
-//	const int result = ::poll(&m_Handle, 1, timeOut_mS);
-//	FFTL_ASSERT_MSG( result == 0 || result == 1, "ThreadEvent::Wait() : poll failed!" );
-//	return result == 0;
-
 //	timespec myTimer;
 //	myTimer.tv_sec = timeOut_mS / 1000;
 //	myTimer.tv_nsec = (timeOut_mS % 1000) * 1000000;
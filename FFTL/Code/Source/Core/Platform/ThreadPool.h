@@ -0,0 +1,175 @@
+/*
+
+Original author:
+Corey Shay
+corey@signalflowtechnologies.com
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+*/
+
+#pragma once
+
+#include "../defs.h"
+
+#include "Thread.h"
+#include "ThreadEvent.h"
+
+#include <memory>
+
+
+namespace FFTL
+{
+
+
+//	A fixed set of worker threads for splitting one job across cores, such as the passes of a large FFT. The calling thread
+// takes a share of the work as well, so a pool of N threads creates N - 1 workers. Only 1 job runs at a time, and
+// ParallelFor() doesn't return until every share of it is done, so it should be called from a single thread.
+class FFTL_NODISCARD ThreadPool
+{
+public:
+	explicit ThreadPool(uint uThreadCount);
+	~ThreadPool();
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	FFTL_NODISCARD uint GetThreadCount() const { return m_uWorkerCount + 1; }
+
+	//	Calls func(uBegin, uEnd) on contiguous ranges that together cover 0 to uCount, 1 range per thread.
+	template <typename T_Functor>
+	void ParallelFor(uint uCount, const T_Functor& func)
+	{
+		Dispatch(uCount, &func, [](const void* pFunc, uint, uint uBegin, uint uEnd) { (*static_cast<const T_Functor*>(pFunc))(uBegin, uEnd); });
+	}
+
+	//	Same, but calls func(uThread, uBegin, uEnd), with uThread from 0 to GetThreadCount() - 1, for jobs that need per thread scratch memory.
+	template <typename T_Functor>
+	void ParallelForThreads(uint uCount, const T_Functor& func)
+	{
+		Dispatch(uCount, &func, [](const void* pFunc, uint uThread, uint uBegin, uint uEnd) { (*static_cast<const T_Functor*>(pFunc))(uThread, uBegin, uEnd); });
+	}
+
+private:
+	using JobFunction = void (*)(const void* pFunc, uint uThread, uint uBegin, uint uEnd);
+
+	class Worker : public ThreadOwner
+	{
+	public:
+		Worker() : m_Thread(ThreadOwner::ToRunFunction(&Worker::Run)) {}
+
+		ThreadResult Run();
+
+		ThreadMember m_Thread;
+		ThreadEvent m_StartEvent;
+		ThreadEvent m_DoneEvent;
+		ThreadPool* m_pPool = nullptr;
+		uint m_uIndex = 0;
+	};
+
+	void Dispatch(uint uCount, const void* pFunc, JobFunction pfnJob);
+	void RunShare(uint uIndex) const;
+
+	std::unique_ptr<Worker[]> m_pWorkers;
+	uint m_uWorkerCount = 0;
+
+	//	The current job
+	const void* m_pJobFunc = nullptr;
+	JobFunction m_pfnJob = nullptr;
+	uint m_uJobCount = 0;
+};
+
+
+inline ThreadPool::ThreadPool(uint uThreadCount)
+	: m_uWorkerCount(uThreadCount > 1 ? uThreadCount - 1 : 0)
+{
+	if (m_uWorkerCount == 0)
+		return;
+
+	m_pWorkers = std::make_unique<Worker[]>(m_uWorkerCount);
+	for (uint i = 0; i < m_uWorkerCount; ++i)
+	{
+		Worker& worker = m_pWorkers[i];
+		worker.m_pPool = this;
+		worker.m_uIndex = i + 1;
+		worker.m_Thread.Start(&worker, "FFTL ThreadPool");
+	}
+}
+
+inline ThreadPool::~ThreadPool()
+{
+	for (uint i = 0; i < m_uWorkerCount; ++i)
+	{
+		Worker& worker = m_pWorkers[i];
+		worker.m_Thread.FlagForStop();
+		worker.m_StartEvent.Signal();
+		worker.m_Thread.Join();
+	}
+}
+
+inline void ThreadPool::Dispatch(uint uCount, const void* pFunc, JobFunction pfnJob)
+{
+	m_pJobFunc = pFunc;
+	m_pfnJob = pfnJob;
+	m_uJobCount = uCount;
+
+	for (uint i = 0; i < m_uWorkerCount; ++i)
+		m_pWorkers[i].m_StartEvent.Signal();
+
+	//	The calling thread takes share 0
+	RunShare(0);
+
+	for (uint i = 0; i < m_uWorkerCount; ++i)
+		m_pWorkers[i].m_DoneEvent.Wait();
+
+	m_pJobFunc = nullptr;
+	m_pfnJob = nullptr;
+}
+
+inline void ThreadPool::RunShare(uint uIndex) const
+{
+	const uint uThreadCount = GetThreadCount();
+	const uint uBegin = static_cast<uint>(static_cast<u64>(m_uJobCount) * uIndex / uThreadCount);
+	const uint uEnd = static_cast<uint>(static_cast<u64>(m_uJobCount) * (uIndex + 1) / uThreadCount);
+	if (uBegin < uEnd)
+		m_pfnJob(m_pJobFunc, uIndex, uBegin, uEnd);
+}
+
+inline ThreadResult ThreadPool::Worker::Run()
+{
+	for (;;)
+	{
+		m_StartEvent.Wait();
+		if (m_Thread.GetIsFlaggedForStop())
+			break;
+
+		m_pPool->RunShare(m_uIndex);
+		m_DoneEvent.Signal();
+	}
+
+	return ReturnCode::OK;
+}
+
+
+} // namespace FFTL
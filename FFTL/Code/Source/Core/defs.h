@@ -169,6 +169,10 @@ OTHER DEALINGS IN THE SOFTWARE.
 #if !defined(FFTL_FMA4) && (defined(FFTL_USE_FMA4) || defined(__FMA4__))
 #	define FFTL_FMA4 1
 #endif
+//	Half precision conversion instructions. MSVC doesn't gate the intrinsics on /arch, and every AVX2 CPU has them.
+#if !defined(FFTL_F16C) && (defined(FFTL_USE_F16C) || defined(__F16C__) || (defined(_MSC_VER) && defined(FFTL_AVX2)))
+#	define FFTL_F16C 1
+#endif
 
 #if defined(FFTL_SSE)
 #	define FFTL_SSE_ONLY(__stuff__) __stuff__
@@ -234,6 +238,12 @@ OTHER DEALINGS IN THE SOFTWARE.
 #if defined(FFTL_AVX2)
 #	define FFTL_SIMD_I32x8 1
 #endif
+#if defined(FFTL_SSE2)
+#	define FFTL_SIMD_F64x2 1
+#endif
+#if defined(FFTL_AVX)
+#	define FFTL_SIMD_F64x4 1
+#endif
 
 #if defined(FFTL_SIMD_F32x8)
 #	define FFTL_SIMD_F32_WIDTH 8
@@ -497,6 +507,7 @@ typedef uint64_t		u64;
 typedef int64_t			s64;
 typedef float			f32;
 typedef double			f64;
+enum class f16 : u16 {};	// IEEE half precision, storage only. Convert with F16ToF32 and F32ToF16.
 
 //	Aliases and shorthands
 typedef u8				byte;
@@ -35,11 +35,27 @@ OTHER DEALINGS IN THE SOFTWARE.
 
 #include "../Core/defs.h"
 #include "../Core/Math/FFT.h"
+#include "../Core/Math/FFT_Plan.h"
+#include "../Core/Math/FFT2D.h"
+#include "../Core/Math/FFT3D.h"
+#include "../Core/Math/FFT_Batch.h"
+#include "../Core/Math/FFT_ChirpZ.h"
+#include "../Core/Math/FFT_DCT.h"
+#include "../Core/Math/FFT_Fixed.h"
+#include "../Core/Math/FFT_FourStep.h"
+#include "../Core/Math/FFT_MixedRadix.h"
+#include "../Core/Math/FFT_NonUniformConvolver.h"
+#include "../Core/Math/FFT_Pruned.h"
+#include "../Core/Math/FFT_RealPair.h"
+#include "../Core/Math/FFT_SparseDFT.h"
+#include "../Core/Math/FFT_Stockham.h"
+#include "../Core/Math/FFT_WindowCache.h"
 #include "../Core/Containers/ListAtomic.h"
 #include "../Core/Containers/MemPoolFixedBlock.h"
 #include "../Core/Platform/CpuInfo.h"
 #include "../Core/Platform/Log.h"
 #include "../Core/Platform/Thread.h"
+#include "../Core/Platform/ThreadPool.h"
 #include "../Core/Platform/Timer.h"
 #include "../Core/Math/Vector.h"
 #include "../Core/Platform/Atomic.h"
@@ -61,6 +77,7 @@ unsigned int sceLibcHeapExtendedAlloc = 1;
 #include <iostream>
 #include <stdio.h>
 #include <string>
+#include <vector>
 #include "rlutil.h"
 
 #if defined(_MSC_VER)
@@ -436,7 +453,7 @@ void verifyFFT()
 	typedef FFT<_M, float> fftScalar;
 	typedef FFT<_M, float, float> fftSimd;
 
-	dit4l_fft(cxIn.data(), _M, 1);
+	dit4l_fft(cxIn.data(), _M, -1);
 
 	fftScalar::TransformForward_InPlace_DIF(fTimeOutput1, fTimeOutput2);
 	fftScalar::TransformInverse_InPlace_DIT(fTimeOutput1, fTimeOutput2);
@@ -462,6 +479,15 @@ void verifyFFT()
 	}
 
 	fftSimd::TransformForward(fInput1, fInput2, fOutput1, fOutput2);
+
+	//	Compare against the reference transform
+	for (uint n = 0; n < _N; ++n)
+	{
+		const float fDiffR = fOutput1[n] - cxIn[n].r;
+		const float fDiffI = fOutput2[n] - cxIn[n].i;
+		FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 4096.f && Abs(fDiffI) <= 1 / 4096.f);
+	}
+
 //	fftSimd::TransformInverse(fOutput1, fOutput2, fTimeOutput1, fTimeOutput2);
 
 	for (uint n = 0; n < _N; ++n)
@@ -562,6 +588,1541 @@ void verifyRealFFT()
 
 	FFTL_LOG_MSG("verifyRealFFT: PASS\n");
 }
+
+//	Random value in [-1, 1)
+FFTL_NODISCARD inline f32 GetRandomSample()
+{
+	return (float(rand() % 32768) / 16384.f) - 1.f;
+}
+
+template <typename T>
+void FillRandom(T* p, size_t uCount)
+{
+	for (size_t n = 0; n < uCount; ++n)
+		p[n] = static_cast<T>(GetRandomSample());
+}
+
+template <typename T, size_t N>
+void FillRandom(FixedArray<T, N>& a)
+{
+	FillRandom(a.data(), N);
+}
+
+template <typename T, size_t N>
+void FillRandom(FixedArray<cxNumber<T>, N>& a)
+{
+	for (cxNumber<T>& cx : a)
+	{
+		cx.r = static_cast<T>(GetRandomSample());
+		cx.i = static_cast<T>(GetRandomSample());
+	}
+}
+
+//	Test arrays go on the heap, since the larger sizes don't fit on the stack.
+template <typename T, uint N>
+FFTL_NODISCARD std::unique_ptr< FixedArray_Aligned32<T, N> > MakeTestArray()
+{
+	return std::make_unique< FixedArray_Aligned32<T, N> >();
+}
+
+//	Error allowed when comparing unnormalized transforms and round trips of N random samples, which grows with N.
+constexpr f32 GetTransformTolerance(uint N)
+{
+	return N / 16384.f;
+}
+
+void verifyFFTPlan()
+{
+	FFT_Plan plan;
+	FFTL_ASSERT_ALWAYS(plan.Init(_N + 1, FFT_Plan::Type::COMPLEX, FFT_Plan::Direction::FORWARD) == ReturnCode::ERROR_INVALID_BUFFER_SIZE);
+	FFTL_ASSERT_ALWAYS(!plan.IsValid());
+
+	for (const uint M : { FFT_Plan::MIN_M, 4u, _M })
+	{
+		const uint N = 1 << M;
+
+		FillRandom(fInput1.data(), N);
+		FillRandom(fInput2.data(), N);
+		for (uint n = 0; n < N; ++n)
+			cxIn[n].Set(fInput1[n], fInput2[n]);
+		dit4l_fft(cxIn.data(), M, -1);
+
+		//	Complex forward against the reference, then back again
+		FFTL_ASSERT_ALWAYS(plan.Init(N, FFT_Plan::Type::COMPLEX, FFT_Plan::Direction::FORWARD) == ReturnCode::OK);
+		FFTL_ASSERT_ALWAYS(plan.GetN() == N && plan.GetM() == M);
+		FFTL_ASSERT_ALWAYS(!plan.GetIsSimd() || M >= 3);
+		plan.Execute(fInput1.data(), fInput2.data(), fOutput1.data(), fOutput2.data());
+		for (uint n = 0; n < N; ++n)
+		{
+			const float fDiffR = fOutput1[n] - cxIn[n].r;
+			const float fDiffI = fOutput2[n] - cxIn[n].i;
+			FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 4096.f && Abs(fDiffI) <= 1 / 4096.f);
+		}
+
+		FFTL_ASSERT_ALWAYS(plan.Init(N, FFT_Plan::Type::COMPLEX, FFT_Plan::Direction::INVERSE) == ReturnCode::OK);
+		plan.Execute(fOutput1.data(), fOutput2.data(), fTimeOutput1.data(), fTimeOutput2.data());
+		for (uint n = 0; n < N; ++n)
+		{
+			const float fDiffR = fInput1[n] - (fTimeOutput1[n] / N);
+			const float fDiffI = fInput2[n] - (fTimeOutput2[n] / N);
+			FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 16384.f && Abs(fDiffI) <= 1 / 16384.f);
+		}
+
+		//	Real forward against the reference, then back again
+		kiss_fftr_cfg cfgF = kiss_fftr_alloc(N, false, 0, 0);
+		FixedArray<kiss_fft_cpx, _N / 2 + 1> kissOut;
+		kiss_fftr(cfgF, fInput1.data(), kissOut.data());
+		kiss_fftr_free(cfgF);
+
+		FFTL_ASSERT_ALWAYS(plan.Init(N, FFT_Plan::Type::REAL, FFT_Plan::Direction::FORWARD) == ReturnCode::OK);
+		FFTL_ASSERT_ALWAYS(!plan.GetIsSimd() || M >= 5);
+		plan.ExecuteRealForward(fInput1.data(), fOutput1.data(), fOutput2.data());
+		FFTL_ASSERT_ALWAYS(Abs(fOutput2[0] - kissOut[N / 2].r) <= 1 / 4096.f);
+		for (uint n = 0; n < N / 2; ++n)
+		{
+			const float fDiffR = fOutput1[n] - kissOut[n].r;
+			const float fDiffI = n == 0 ? 0 : fOutput2[n] - kissOut[n].i;
+			FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 4096.f && Abs(fDiffI) <= 1 / 4096.f);
+		}
+
+		FFTL_ASSERT_ALWAYS(plan.Init(N, FFT_Plan::Type::REAL, FFT_Plan::Direction::INVERSE) == ReturnCode::OK);
+		plan.ExecuteRealInverse(fOutput1.data(), fOutput2.data(), fTimeOutput1.data());
+		for (uint n = 0; n < N; ++n)
+		{
+			const float fDiff = fTimeOutput1[n] - fInput1[n];
+			FFTL_ASSERT_ALWAYS(Abs(fDiff) <= 1 / 16384.f);
+		}
+	}
+
+	FFTL_LOG_MSG("verifyFFTPlan: PASS\n");
+}
+
+template <uint N>
+void verifyMixedRadixFFT_N()
+{
+	typedef FFT_MixedRadix<N> fftMixed;
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	auto cxInput = MakeTestArray<cxNumber<f32>, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+	for (uint n = 0; n < N; ++n)
+		(*cxInput)[n].Set((*fInR)[n], (*fInI)[n]);
+
+	fftMixed::TransformForward(*fInR, *fInI, *fOutR, *fOutI);
+
+	//	Compare against a direct DFT
+	for (uint k = 0; k < N; ++k)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint n = 0; n < N; ++n)
+		{
+			const f64 fAngle = -2 * PI_64 * static_cast<f64>((k * n) % N) / N;
+			fSumR += (*fInR)[n] * Cos(fAngle) - (*fInI)[n] * Sin(fAngle);
+			fSumI += (*fInR)[n] * Sin(fAngle) + (*fInI)[n] * Cos(fAngle);
+		}
+		const f64 fDiffR = (*fOutR)[k] - fSumR;
+		const f64 fDiffI = (*fOutI)[k] - fSumI;
+		FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 4096. && Abs(fDiffI) <= 1 / 4096.);
+	}
+
+	fftMixed::TransformForward(*cxInput, *fInR, *fInI);
+	for (uint k = 0; k < N; ++k)
+	{
+		FFTL_ASSERT_ALWAYS((*fInR)[k] == (*fOutR)[k] && (*fInI)[k] == (*fOutI)[k]);
+	}
+
+	fftMixed::TransformInverse(*fOutR, *fOutI, *fInR, *fInI);
+	for (uint n = 0; n < N; ++n)
+	{
+		const float fDiffR = (*cxInput)[n].r - (*fInR)[n] / N;
+		const float fDiffI = (*cxInput)[n].i - (*fInI)[n] / N;
+		FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 16384.f && Abs(fDiffI) <= 1 / 16384.f);
+	}
+
+	//	Compare the inverse of a random spectrum against a direct inverse DFT
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	fftMixed::TransformInverse(*fInR, *fInI, *fOutR, *fOutI);
+	for (uint n = 0; n < N; ++n)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint k = 0; k < N; ++k)
+		{
+			const f64 fAngle = 2 * PI_64 * static_cast<f64>((k * n) % N) / N;
+			fSumR += (*fInR)[k] * Cos(fAngle) - (*fInI)[k] * Sin(fAngle);
+			fSumI += (*fInR)[k] * Sin(fAngle) + (*fInI)[k] * Cos(fAngle);
+		}
+		const f64 fDiffR = (*fOutR)[n] - fSumR;
+		const f64 fDiffI = (*fOutI)[n] - fSumI;
+		FFTL_ASSERT_ALWAYS(Abs(fDiffR) <= 1 / 4096. && Abs(fDiffI) <= 1 / 4096.);
+	}
+}
+
+void verifyMixedRadixFFT()
+{
+	//	10ms at 48kHz, which has factors of 2, 3 and 5
+	verifyMixedRadixFFT_N<480>();
+
+	//	Sizes with factors of 7, from the bare radix 7 butterfly up to every radix in one transform
+	verifyMixedRadixFFT_N<7>();
+	verifyMixedRadixFFT_N<49>();
+	verifyMixedRadixFFT_N<448>();
+	verifyMixedRadixFFT_N<2 * 3 * 5 * 7 * 4>();
+
+	FFTL_LOG_MSG("verifyMixedRadixFFT: PASS\n");
+}
+
+void verifyChirpZ()
+{
+	//	Prime length, so neither power of 2 nor mixed radix transforms can handle it
+	constexpr uint N = 257;
+	constexpr uint K = 64;
+	auto chirpDFT = std::make_unique< FFT_ChirpZ<N> >();
+	auto chirpZoom = std::make_unique< FFT_ChirpZ<N, K> >();
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	auto& fZoomR = *reinterpret_cast<FixedArray_Aligned32<f32, K>*>(fOutR.get());
+	auto& fZoomI = *reinterpret_cast<FixedArray_Aligned32<f32, K>*>(fOutI.get());
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	chirpDFT->Transform(*fInR, *fInI, *fOutR, *fOutI);
+	for (uint k = 0; k < N; ++k)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint n = 0; n < N; ++n)
+		{
+			const f64 fAngle = -2 * PI_64 * static_cast<f64>((k * n) % N) / N;
+			fSumR += (*fInR)[n] * Cos(fAngle) - (*fInI)[n] * Sin(fAngle);
+			fSumI += (*fInR)[n] * Sin(fAngle) + (*fInI)[n] * Cos(fAngle);
+		}
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[k] - fSumR) <= 1 / 4096. && Abs((*fOutI)[k] - fSumI) <= 1 / 4096.);
+	}
+
+	//	Zoom in on 1kHz to 1.063kHz in 1Hz steps at 48kHz, real input
+	constexpr f64 fStartFreq = 1000, fStepFreq = 1, fSampleRate = 48000;
+	chirpZoom->InitZoom(fStartFreq, fStepFreq, fSampleRate);
+	chirpZoom->Transform(*fInR, fZoomR, fZoomI);
+	for (uint k = 0; k < K; ++k)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint n = 0; n < N; ++n)
+		{
+			const f64 fAngle = -2 * PI_64 * n * (fStartFreq + k * fStepFreq) / fSampleRate;
+			fSumR += (*fInR)[n] * Cos(fAngle);
+			fSumI += (*fInR)[n] * Sin(fAngle);
+		}
+		FFTL_ASSERT_ALWAYS(Abs(fZoomR[k] - fSumR) <= 1 / 4096. && Abs(fZoomI[k] - fSumI) <= 1 / 4096.);
+	}
+
+	FFTL_LOG_MSG("verifyChirpZ: PASS\n");
+}
+
+template <uint M>
+void verifyFFT64_Size()
+{
+	constexpr uint N = 1 << M;
+	constexpr f64 fTol = 1e-9;
+	using fft = FFT<M, f64>;
+	using fftReal = FFT_Real<M + 1, f64>;
+
+	auto fInR = MakeTestArray<f64, N>();
+	auto fInI = MakeTestArray<f64, N>();
+	auto fOutR = MakeTestArray<f64, N>();
+	auto fOutI = MakeTestArray<f64, N>();
+	auto fRefR = MakeTestArray<f64, N>();
+	auto fRefI = MakeTestArray<f64, N>();
+	auto fInvR = MakeTestArray<f64, N>();
+	auto fInvI = MakeTestArray<f64, N>();
+	auto fTime = MakeTestArray<f64, 2 * N>();
+	auto fTimeOut = MakeTestArray<f64, 2 * N>();
+	auto cxIn = MakeTestArray<cxNumber<f64>, N>();
+	auto cxOut = MakeTestArray<cxNumber<f64>, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+	for (uint n = 0; n < N; ++n)
+		(*cxIn)[n].Set((*fInR)[n], (*fInI)[n]);
+
+	for (uint k = 0; k < N; ++k)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint n = 0; n < N; ++n)
+		{
+			const f64 fAngle = -2 * PI_64 * static_cast<f64>((k * n) % N) / N;
+			fSumR += (*fInR)[n] * Cos(fAngle) - (*fInI)[n] * Sin(fAngle);
+			fSumI += (*fInR)[n] * Sin(fAngle) + (*fInI)[n] * Cos(fAngle);
+		}
+		(*fRefR)[k] = fSumR;
+		(*fRefI)[k] = fSumI;
+	}
+
+	//	Out of place forward, then unnormalized inverse back to the input
+	fft::TransformForward(*fInR, *fInI, *fOutR, *fOutI);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[k] - (*fRefR)[k]) <= fTol && Abs((*fOutI)[k] - (*fRefI)[k]) <= fTol);
+	fft::TransformInverse(*fOutR, *fOutI, *fInvR, *fInvI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fInvR)[n] / N - (*fInR)[n]) <= fTol && Abs((*fInvI)[n] / N - (*fInI)[n]) <= fTol);
+
+	//	In place DIF gives bit reversed output, which DIT takes straight back
+	*fOutR = *fInR;
+	*fOutI = *fInI;
+	fft::TransformForward_InPlace_DIF(*fOutR, *fOutI);
+	for (uint k = 0; k < N; ++k)
+	{
+		const uint kR = fft::GetBitReverseIndex(k);
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[kR] - (*fRefR)[k]) <= fTol && Abs((*fOutI)[kR] - (*fRefI)[k]) <= fTol);
+	}
+	fft::TransformInverse_InPlace_DIT(*fOutR, *fOutI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] / N - (*fInR)[n]) <= fTol && Abs((*fOutI)[n] / N - (*fInI)[n]) <= fTol);
+
+	//	Interleaved complex in and out
+	fft::TransformForward(*cxIn, *cxOut);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs((*cxOut)[k].r - (*fRefR)[k]) <= fTol && Abs((*cxOut)[k].i - (*fRefI)[k]) <= fTol);
+	*cxOut = *cxIn;
+	fft::TransformForward_InPlace_DIF(*cxOut);
+	for (uint k = 0; k < N; ++k)
+	{
+		const uint kR = fft::GetBitReverseIndex(k);
+		FFTL_ASSERT_ALWAYS(Abs((*cxOut)[kR].r - (*fRefR)[k]) <= fTol && Abs((*cxOut)[kR].i - (*fRefI)[k]) <= fTol);
+	}
+	fft::TransformInverse_InPlace_DIT(*cxOut);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*cxOut)[n].r / N - (*fInR)[n]) <= fTol && Abs((*cxOut)[n].i / N - (*fInI)[n]) <= fTol);
+
+	//	Real FFT of twice the size, with the Nyquist bin packed into the imaginary DC bin
+	FillRandom(*fTime);
+	fftReal::TransformForward(*fTime, *fOutR, *fOutI);
+	for (uint k = 0; k <= N; ++k)
+	{
+		f64 fSumR = 0, fSumI = 0;
+		for (uint n = 0; n < 2 * N; ++n)
+		{
+			const f64 fAngle = -2 * PI_64 * static_cast<f64>((k * n) % (2 * N)) / (2 * N);
+			fSumR += (*fTime)[n] * Cos(fAngle);
+			fSumI += (*fTime)[n] * Sin(fAngle);
+		}
+		if (k == 0)
+			FFTL_ASSERT_ALWAYS(Abs((*fOutR)[0] - fSumR) <= fTol);
+		else if (k == N)
+			FFTL_ASSERT_ALWAYS(Abs((*fOutI)[0] - fSumR) <= fTol);
+		else
+			FFTL_ASSERT_ALWAYS(Abs((*fOutR)[k] - fSumR) <= fTol && Abs((*fOutI)[k] - fSumI) <= fTol);
+	}
+	fftReal::TransformInverse(*fOutR, *fOutI, *fTimeOut);
+	for (uint n = 0; n < 2 * N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fTimeOut)[n] - (*fTime)[n]) <= fTol);
+	fftReal::TransformInverse_ClobberInput(*fOutR, *fOutI, *fTimeOut);
+	for (uint n = 0; n < 2 * N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fTimeOut)[n] - (*fTime)[n]) <= fTol);
+}
+
+void verifyFFT64()
+{
+	verifyFFT64_Size<1>();
+	verifyFFT64_Size<2>();
+	verifyFFT64_Size<3>();
+	verifyFFT64_Size<4>();
+	verifyFFT64_Size<5>();
+	verifyFFT64_Size<10>();
+
+	FFTL_LOG_MSG("verifyFFT64: PASS\n");
+}
+
+template <uint M>
+void verifyFFTInterleaved_Size()
+{
+	constexpr uint N = 1 << M;
+	using fftRef = FFT_Base<M, f32>;
+	using fft = FFT<M, f32>;
+
+	auto cxIn = MakeTestArray<cxNumber<f32>, N>();
+	auto cxRef = MakeTestArray<cxNumber<f32>, N>();
+	auto cxOut = MakeTestArray<cxNumber<f32>, N>();
+
+	FillRandom(*cxIn);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+	auto verifyEqual = [&]()
+	{
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs((*cxOut)[n].r - (*cxRef)[n].r) <= fTol && Abs((*cxOut)[n].i - (*cxRef)[n].i) <= fTol);
+	};
+
+	fftRef::TransformForward(*cxIn, *cxRef);
+	fft::TransformForward(*cxIn, *cxOut);
+	verifyEqual();
+
+	*cxRef = *cxIn;
+	*cxOut = *cxIn;
+	fftRef::TransformForward_InPlace_DIF(*cxRef);
+	fft::TransformForward_InPlace_DIF(*cxOut);
+	verifyEqual();
+
+	fftRef::TransformInverse_InPlace_DIT(*cxRef);
+	fft::TransformInverse_InPlace_DIT(*cxOut);
+	verifyEqual();
+}
+
+void verifyFFTInterleaved()
+{
+	verifyFFTInterleaved_Size<3>();
+	verifyFFTInterleaved_Size<4>();
+	verifyFFTInterleaved_Size<5>();
+	verifyFFTInterleaved_Size<10>();
+#if !FFTL_SHARED_TWIDDLES || FFTL_SHARED_TWIDDLES_MAX_M >= 17
+	verifyFFTInterleaved_Size<18>();
+#endif
+
+	FFTL_LOG_MSG("verifyFFTInterleaved: PASS\n");
+}
+
+template <uint M>
+void verifyStockham_Size()
+{
+	constexpr uint N = 1 << M;
+	using fftRef = FFT<M, f32>;
+	using fft = FFT_Stockham<M>;
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	auto fWorkR = MakeTestArray<f32, N>();
+	auto fWorkI = MakeTestArray<f32, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	fftRef::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+	fft::TransformForward(*fInR, *fInI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*fRefR)[n]) <= fTol && Abs((*fOutI)[n] - (*fRefI)[n]) <= fTol);
+
+	fft::TransformInverse(*fRefR, *fRefI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - N * (*fInR)[n]) <= fTol && Abs((*fOutI)[n] - N * (*fInI)[n]) <= fTol);
+}
+
+void verifyStockham()
+{
+	verifyStockham_Size<3>();
+	verifyStockham_Size<4>();
+	verifyStockham_Size<5>();
+	verifyStockham_Size<10>();
+	verifyStockham_Size<11>();
+
+	FFTL_LOG_MSG("verifyStockham: PASS\n");
+}
+
+template <uint M>
+void verifyBlockedBitreversal_Size()
+{
+	constexpr uint N = 1 << M;
+
+	auto uIn = std::make_unique< FixedArray<u32, N> >();
+	auto uOut = std::make_unique< FixedArray<u32, N> >();
+	for (uint n = 0; n < N; ++n)
+		(*uIn)[n] = n;
+
+	FFT_BitreversalBlocked<M>::Permute(uIn->data(), uOut->data());
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS((*uOut)[FFT_BitreversalBlocked<M>::ReverseBits(n, M)] == n);
+}
+
+//	Large enough that FFT_UseBlockedBitreversal selects it, compared against the table driven scalar FFT
+template <typename T>
+void verifyBlockedBitreversal_FFT(T fTol)
+{
+	constexpr uint M = 15;
+	constexpr uint N = 1 << M;
+	static_assert(FFT_UseBlockedBitreversal<M>::value);
+
+	auto fInR = MakeTestArray<T, N>();
+	auto fInI = MakeTestArray<T, N>();
+	auto fRefR = MakeTestArray<T, N>();
+	auto fRefI = MakeTestArray<T, N>();
+	auto fOutR = MakeTestArray<T, N>();
+	auto fOutI = MakeTestArray<T, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	FFT_Base<M, T>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+	FFT<M, T>::TransformForward(*fInR, *fInI, *fOutR, *fOutI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*fRefR)[n]) <= fTol && Abs((*fOutI)[n] - (*fRefI)[n]) <= fTol);
+}
+
+void verifyBlockedBitreversal()
+{
+	verifyBlockedBitreversal_Size<2>();
+	verifyBlockedBitreversal_Size<3>();
+	verifyBlockedBitreversal_Size<7>();
+	verifyBlockedBitreversal_Size<10>();
+	verifyBlockedBitreversal_Size<15>();
+
+	verifyBlockedBitreversal_FFT<f32>(1 / 16.f);
+	verifyBlockedBitreversal_FFT<f64>(1 / 65536.0);
+
+	FFTL_LOG_MSG("verifyBlockedBitreversal: PASS\n");
+}
+
+template <uint M>
+void verifyFourStep_Size()
+{
+	constexpr uint N = 1 << M;
+	using fftRef = FFT<M, f32>;
+	auto fft = std::make_unique< FFT_FourStep<M> >();
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	auto fWorkR = MakeTestArray<f32, N>();
+	auto fWorkI = MakeTestArray<f32, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	fftRef::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+	fft->TransformForward(*fInR, *fInI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*fRefR)[n]) <= fTol && Abs((*fOutI)[n] - (*fRefI)[n]) <= fTol);
+
+	fft->TransformInverse(*fRefR, *fRefI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - N * (*fInR)[n]) <= fTol && Abs((*fOutI)[n] - N * (*fInI)[n]) <= fTol);
+}
+
+void verifyFourStep()
+{
+	verifyFourStep_Size<6>();
+	verifyFourStep_Size<7>();
+	verifyFourStep_Size<12>();
+	verifyFourStep_Size<15>();
+
+	//	Spreading the passes across threads has to give exactly the same result
+	{
+		constexpr uint M = 16;
+		constexpr uint N = 1 << M;
+		auto fft = std::make_unique< FFT_FourStep<M> >();
+		ThreadPool pool(4);
+
+		auto fInR = MakeTestArray<f32, N>();
+		auto fInI = MakeTestArray<f32, N>();
+		auto fRefR = MakeTestArray<f32, N>();
+		auto fRefI = MakeTestArray<f32, N>();
+		auto fOutR = MakeTestArray<f32, N>();
+		auto fOutI = MakeTestArray<f32, N>();
+		auto fWorkR = MakeTestArray<f32, N>();
+		auto fWorkI = MakeTestArray<f32, N>();
+
+		FillRandom(*fInR);
+		FillRandom(*fInI);
+
+		fft->TransformForward(*fInR, *fInI, *fRefR, *fRefI, *fWorkR, *fWorkI);
+		fft->TransformForward(*fInR, *fInI, *fOutR, *fOutI, *fWorkR, *fWorkI, pool);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS((*fOutR)[n] == (*fRefR)[n] && (*fOutI)[n] == (*fRefI)[n]);
+	}
+
+	FFTL_LOG_MSG("verifyFourStep: PASS\n");
+}
+
+template <uint M>
+void verifyFFTBatch_Count(uint uChannelCount)
+{
+	constexpr uint N = 1 << M;
+	using fftRef = FFT<M, f32>;
+	auto fft = std::make_unique< FFT_Batch<M> >();
+
+	std::vector<f32> fIn(2 * N * uChannelCount);
+	std::vector<f32> fOut(2 * N * uChannelCount);
+	for (f32& f : fIn)
+		f = GetRandomSample();
+
+	std::vector<const f32*> ppInR(uChannelCount), ppInI(uChannelCount);
+	std::vector<f32*> ppOutR(uChannelCount), ppOutI(uChannelCount);
+	for (uint c = 0; c < uChannelCount; ++c)
+	{
+		ppInR[c] = fIn.data() + 2 * N * c;
+		ppInI[c] = fIn.data() + 2 * N * c + N;
+		ppOutR[c] = fOut.data() + 2 * N * c;
+		ppOutI[c] = fOut.data() + 2 * N * c + N;
+	}
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	//	Every channel has to match a transform of that channel on its own, including the leftovers past the last full group.
+	fft->TransformForward(ppInR.data(), ppInI.data(), ppOutR.data(), ppOutI.data(), uChannelCount);
+	for (uint c = 0; c < uChannelCount; ++c)
+	{
+		MemCopy(fInR->data(), ppInR[c], N);
+		MemCopy(fInI->data(), ppInI[c], N);
+		fftRef::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs(ppOutR[c][n] - (*fRefR)[n]) <= fTol && Abs(ppOutI[c][n] - (*fRefI)[n]) <= fTol);
+	}
+
+	//	In place inverse
+	fft->TransformInverse(ppOutR.data(), ppOutI.data(), ppOutR.data(), ppOutI.data(), uChannelCount);
+	for (uint c = 0; c < uChannelCount; ++c)
+	{
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs(ppOutR[c][n] - N * ppInR[c][n]) <= fTol && Abs(ppOutI[c][n] - N * ppInI[c][n]) <= fTol);
+	}
+
+	//	Real input
+	fft->TransformForward(ppInR.data(), nullptr, ppOutR.data(), ppOutI.data(), uChannelCount);
+	MemZero(*fInI);
+	for (uint c = 0; c < uChannelCount; ++c)
+	{
+		MemCopy(fInR->data(), ppInR[c], N);
+		fftRef::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs(ppOutR[c][n] - (*fRefR)[n]) <= fTol && Abs(ppOutI[c][n] - (*fRefI)[n]) <= fTol);
+	}
+}
+
+void verifyFFTBatch()
+{
+	verifyFFTBatch_Count<3>(1);
+	verifyFFTBatch_Count<6>(11);
+	verifyFFTBatch_Count<6>(13);
+	verifyFFTBatch_Count<10>(16);
+
+	FFTL_LOG_MSG("verifyFFTBatch: PASS\n");
+}
+
+template <uint MX, uint MY>
+void verifyFFT2D_Size()
+{
+	constexpr uint NX = 1 << MX;
+	constexpr uint NY = 1 << MY;
+	constexpr uint N = NX * NY;
+	using fft = FFT2D<MX, MY>;
+	using fftReal = FFT2D_Real<MX, MY>;
+	using fftX = FFT<MX, f32>;
+	using fftY = FFT<MY, f32>;
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	auto fWorkR = MakeTestArray<f32, N>();
+	auto fWorkI = MakeTestArray<f32, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	//	Reference is the 1D transforms on every row, then on strided copies of every column.
+	{
+		FixedArray_Aligned32<f32, NX> fRowR, fRowI;
+		FixedArray_Aligned32<f32, NY> fColR, fColI, fColOutR, fColOutI;
+		for (uint y = 0; y < NY; ++y)
+		{
+			MemCopy(fRowR.data(), *fInR + y * NX, NX);
+			MemCopy(fRowI.data(), *fInI + y * NX, NX);
+			fftX::TransformForward(fRowR, fRowI, *reinterpret_cast<FixedArray<f32, NX>*>(*fRefR + y * NX), *reinterpret_cast<FixedArray<f32, NX>*>(*fRefI + y * NX));
+		}
+		for (uint x = 0; x < NX; ++x)
+		{
+			for (uint y = 0; y < NY; ++y)
+			{
+				fColR[y] = (*fRefR)[y * NX + x];
+				fColI[y] = (*fRefI)[y * NX + x];
+			}
+			fftY::TransformForward(fColR, fColI, fColOutR, fColOutI);
+			for (uint y = 0; y < NY; ++y)
+			{
+				(*fRefR)[y * NX + x] = fColOutR[y];
+				(*fRefI)[y * NX + x] = fColOutI[y];
+			}
+		}
+	}
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	fft::TransformForward(*fInR, *fInI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*fRefR)[n]) <= fTol && Abs((*fOutI)[n] - (*fRefI)[n]) <= fTol);
+
+	fft::TransformInverse(*fRefR, *fRefI, *fOutR, *fOutI, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - N * (*fInR)[n]) <= fTol && Abs((*fOutI)[n] - N * (*fInI)[n]) <= fTol);
+
+	//	Real input has to match the first half of each row of the complex transform with zero imaginary input, plus the Nyquist column.
+	{
+		auto fHalfR = MakeTestArray<f32, N / 2>();
+		auto fHalfI = MakeTestArray<f32, N / 2>();
+		auto fHalfWorkR = MakeTestArray<f32, N / 2>();
+		auto fHalfWorkI = MakeTestArray<f32, N / 2>();
+		FixedArray_Aligned32<f32, NY> fNyquistR, fNyquistI;
+
+		MemZero(*fInI);
+		fft::TransformForward(*fInR, *fInI, *fRefR, *fRefI, *fWorkR, *fWorkI);
+		fftReal::TransformForward(*fInR, *fHalfR, *fHalfI, fNyquistR, fNyquistI, *fHalfWorkR, *fHalfWorkI);
+		for (uint y = 0; y < NY; ++y)
+		{
+			for (uint x = 0; x < NX / 2; ++x)
+			{
+				FFTL_ASSERT_ALWAYS(Abs((*fHalfR)[y * NX / 2 + x] - (*fRefR)[y * NX + x]) <= fTol);
+				FFTL_ASSERT_ALWAYS(Abs((*fHalfI)[y * NX / 2 + x] - (*fRefI)[y * NX + x]) <= fTol);
+			}
+			FFTL_ASSERT_ALWAYS(Abs(fNyquistR[y] - (*fRefR)[y * NX + NX / 2]) <= fTol && Abs(fNyquistI[y] - (*fRefI)[y * NX + NX / 2]) <= fTol);
+		}
+
+		fftReal::TransformInverse(*fHalfR, *fHalfI, fNyquistR, fNyquistI, *fOutR, *fHalfWorkR, *fHalfWorkI);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - NY * (*fInR)[n]) <= fTol);
+	}
+}
+
+void verifyFFT2D()
+{
+	verifyFFT2D_Size<5, 3>();
+	verifyFFT2D_Size<6, 7>();
+	verifyFFT2D_Size<9, 6>();
+
+	FFTL_LOG_MSG("verifyFFT2D: PASS\n");
+}
+
+template <uint MX, uint MY, uint MZ>
+void verifyFFT3D_Size()
+{
+	constexpr uint NX = 1 << MX;
+	constexpr uint NY = 1 << MY;
+	constexpr uint NZ = 1 << MZ;
+	constexpr uint NXY = NX * NY;
+	constexpr uint N = NXY * NZ;
+	using fft2D = FFT2D<MX, MY>;
+	using fftZ = FFT<MZ, f32>;
+	auto fft = std::make_unique< FFT3D<MX, MY, MZ> >(4);
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+
+	//	Reference is FFT2D on every slab, then the 1D transform on strided copies of every pencil.
+	{
+		using Slab = FixedArray<f32, NXY>;
+		auto fWorkR = MakeTestArray<f32, NXY>();
+		auto fWorkI = MakeTestArray<f32, NXY>();
+		FixedArray_Aligned32<f32, NZ> fColR, fColI, fColOutR, fColOutI;
+		for (uint z = 0; z < NZ; ++z)
+		{
+			fft2D::TransformForward(*reinterpret_cast<const Slab*>(*fInR + z * NXY), *reinterpret_cast<const Slab*>(*fInI + z * NXY),
+				*reinterpret_cast<Slab*>(*fRefR + z * NXY), *reinterpret_cast<Slab*>(*fRefI + z * NXY), *fWorkR, *fWorkI);
+		}
+		for (uint n = 0; n < NXY; ++n)
+		{
+			for (uint z = 0; z < NZ; ++z)
+			{
+				fColR[z] = (*fRefR)[z * NXY + n];
+				fColI[z] = (*fRefI)[z * NXY + n];
+			}
+			fftZ::TransformForward(fColR, fColI, fColOutR, fColOutI);
+			for (uint z = 0; z < NZ; ++z)
+			{
+				(*fRefR)[z * NXY + n] = fColOutR[z];
+				(*fRefI)[z * NXY + n] = fColOutI[z];
+			}
+		}
+	}
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	MemCopy(*fOutR, *fInR);
+	MemCopy(*fOutI, *fInI);
+	fft->TransformForward(*fOutR, *fOutI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*fRefR)[n]) <= fTol && Abs((*fOutI)[n] - (*fRefI)[n]) <= fTol);
+
+	fft->TransformInverse(*fOutR, *fOutI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - N * (*fInR)[n]) <= fTol && Abs((*fOutI)[n] - N * (*fInI)[n]) <= fTol);
+
+	//	Spreading the passes across threads has to give exactly the same result
+	{
+		ThreadPool pool(4);
+		MemCopy(*fRefR, *fInR);
+		MemCopy(*fRefI, *fInI);
+		fft->TransformForward(*fRefR, *fRefI);
+		MemCopy(*fOutR, *fInR);
+		MemCopy(*fOutI, *fInI);
+		fft->TransformForward(*fOutR, *fOutI, pool);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS((*fOutR)[n] == (*fRefR)[n] && (*fOutI)[n] == (*fRefI)[n]);
+	}
+}
+
+void verifyFFT3D()
+{
+	verifyFFT3D_Size<3, 3, 3>();
+	verifyFFT3D_Size<4, 5, 3>();
+	verifyFFT3D_Size<6, 4, 5>();
+
+	FFTL_LOG_MSG("verifyFFT3D: PASS\n");
+}
+
+template <uint M>
+void verifyDCT_Size()
+{
+	constexpr uint N = 1 << M;
+	auto dct2 = std::make_unique< FFT_DCT2<M> >();
+	auto dct4 = std::make_unique< FFT_DCT4<M> >();
+	auto mdct = std::make_unique< FFT_MDCT<M> >();
+
+	FixedArray_Aligned32<f32, N> fIn, fOut, fOut2;
+	FixedArray_Aligned32<f64, N> fRef;
+	FillRandom(fIn);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	//	DCT-II and its inverse
+	for (uint k = 0; k < N; ++k)
+	{
+		fRef[k] = 0;
+		for (uint n = 0; n < N; ++n)
+			fRef[k] += fIn[n] * Cos(PI_64 / N * (n + 0.5) * k);
+	}
+	dct2->TransformForward(fIn, fOut);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fOut[k] - fRef[k]) <= fTol);
+	dct2->TransformInverse(fOut, fOut2);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs(fOut2[n] - fIn[n]) <= fTol);
+
+	//	DCT-IV, which is its own inverse
+	for (uint k = 0; k < N; ++k)
+	{
+		fRef[k] = 0;
+		for (uint n = 0; n < N; ++n)
+			fRef[k] += fIn[n] * Cos(PI_64 / N * (n + 0.5) * (k + 0.5));
+	}
+	dct4->Transform(fIn, fOut);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fOut[k] - fRef[k]) <= fTol);
+	dct4->Transform(fOut, fOut2);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs(fOut2[n] - N / 2 * fIn[n]) <= fTol);
+
+	//	MDCT and IMDCT
+	FixedArray_Aligned32<f32, N / 2> fCoeffs;
+	for (uint k = 0; k < N / 2; ++k)
+	{
+		fRef[k] = 0;
+		for (uint n = 0; n < N; ++n)
+			fRef[k] += fIn[n] * Cos(2 * PI_64 / N * (n + 0.5 + N / 4) * (k + 0.5));
+	}
+	mdct->TransformForward(fIn, fCoeffs);
+	for (uint k = 0; k < N / 2; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fCoeffs[k] - fRef[k]) <= fTol);
+
+	for (uint n = 0; n < N; ++n)
+	{
+		fRef[n] = 0;
+		for (uint k = 0; k < N / 2; ++k)
+			fRef[n] += fCoeffs[k] * Cos(2 * PI_64 / N * (n + 0.5 + N / 4) * (k + 0.5));
+	}
+	mdct->TransformInverse(fCoeffs, fOut);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs(fOut[n] - fRef[n]) <= fTol);
+}
+
+void verifyDCT()
+{
+	verifyDCT_Size<5>();
+	verifyDCT_Size<6>();
+	verifyDCT_Size<9>();
+
+	FFTL_LOG_MSG("verifyDCT: PASS\n");
+}
+
+template <uint M>
+void verifyRealPair_Size()
+{
+	constexpr uint N = 1 << M;
+	using fft = FFT_RealPair<M>;
+	using fftReal = FFT_Real<M, f32>;
+
+	auto fInA = MakeTestArray<f32, N>();
+	auto fInB = MakeTestArray<f32, N>();
+	auto fOutA = MakeTestArray<f32, N>();
+	auto fOutB = MakeTestArray<f32, N>();
+	auto fWorkR = MakeTestArray<f32, N>();
+	auto fWorkI = MakeTestArray<f32, N>();
+	FixedArray_Aligned32<f32, N / 2> fAR, fAI, fBR, fBI, fRefR, fRefI;
+
+	FillRandom(*fInA);
+	FillRandom(*fInB);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	//	Each half has to match FFT_Real on that signal alone
+	fft::TransformForward(*fInA, *fInB, fAR, fAI, fBR, fBI, *fWorkR, *fWorkI);
+	fftReal::TransformForward(*fInA, fRefR, fRefI);
+	for (uint k = 0; k < N / 2; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fAR[k] - fRefR[k]) <= fTol && Abs(fAI[k] - fRefI[k]) <= fTol);
+	fftReal::TransformForward(*fInB, fRefR, fRefI);
+	for (uint k = 0; k < N / 2; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fBR[k] - fRefR[k]) <= fTol && Abs(fBI[k] - fRefI[k]) <= fTol);
+
+	fft::TransformInverse(fAR, fAI, fBR, fBI, *fOutA, *fOutB, *fWorkR, *fWorkI);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutA)[n] - (*fInA)[n]) <= 1 / 1024.f && Abs((*fOutB)[n] - (*fInB)[n]) <= 1 / 1024.f);
+}
+
+void verifyRealPair()
+{
+	verifyRealPair_Size<5>();
+	verifyRealPair_Size<8>();
+	verifyRealPair_Size<11>();
+
+	FFTL_LOG_MSG("verifyRealPair: PASS\n");
+}
+
+template <uint M>
+void verifyRealFFTWindowed_Size()
+{
+	constexpr uint N = 1 << M;
+	using fft = FFT_Real<M, f32>;
+
+	const typename fft::WindowCoefficients window(kWindowVorbis);
+
+	FixedArray_Aligned32<f32, N> fIn, fWindowed, fOla, fRef, fTime;
+	FixedArray_Aligned32<f32, N / 2> fOutR, fOutI, fRefR, fRefI;
+
+	FillRandom(fIn);
+	FillRandom(fOla);
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	//	Must match windowing as a separate pass
+	fWindowed = fIn;
+	FFT_Base<M, f32>::ApplyWindow(fWindowed, window);
+	fft::TransformForward(fWindowed, fRefR, fRefI);
+	fft::TransformForwardApplyWindow(fIn, fOutR, fOutI, window);
+	for (uint k = 0; k < N / 2; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fOutR[k] - fRefR[k]) <= fTol && Abs(fOutI[k] - fRefI[k]) <= fTol);
+
+	fft::TransformInverse(fOutR, fOutI, fTime);
+	for (uint n = 0; n < N; ++n)
+		fRef[n] = fOla[n] + fTime[n] * window.m_C[n];
+	fft::TransformInverseApplyWindow_Accumulate(fOutR, fOutI, fOla, window);
+	for (uint n = 0; n < N; ++n)
+		FFTL_ASSERT_ALWAYS(Abs(fOla[n] - fRef[n]) <= 1 / 1024.f);
+}
+
+void verifyRealFFTWindowed()
+{
+	verifyRealFFTWindowed_Size<5>();
+	verifyRealFFTWindowed_Size<8>();
+	verifyRealFFTWindowed_Size<11>();
+
+	FFTL_LOG_MSG("verifyRealFFTWindowed: PASS\n");
+}
+
+void verifyWindows()
+{
+	constexpr uint M = 8;
+	constexpr uint N = 1 << M;
+	using cache = FFT_WindowCache<M, f32>;
+	using coeff64 = FFT_Base<M, f64>::WindowCoefficients;
+
+	for (uint w = 0; w < kFftNumWindowTypes; ++w)
+	{
+		const enFftWindowType type = static_cast<enFftWindowType>(w);
+
+		//	Odd width so the SIMD loops have a scalar tail and the center sample is exercised
+		for (uint uWidth : { N, N - 3 })
+		{
+			const FixedArray<f32, N>& c = cache::Get(type, uWidth).m_C;
+			const auto pRef = std::make_unique<coeff64>(type, uWidth);
+
+			f32 fPeak = 0;
+			for (uint n = 0; n < uWidth; ++n)
+			{
+				//	The SIMD f32 trig has to agree with the scalar f64 version, and every window is symmetric
+				FFTL_ASSERT_ALWAYS(Abs(c[n] - static_cast<f32>(pRef->m_C[n])) <= 1 / 65536.f);
+				FFTL_ASSERT_ALWAYS(c[n] == c[uWidth - n - 1]);
+				fPeak = Max(fPeak, c[n]);
+			}
+			for (uint n = uWidth; n < N; ++n)
+				FFTL_ASSERT_ALWAYS(c[n] == 0);
+
+			if (type != kWindowTriangular)
+				FFTL_ASSERT_ALWAYS(Abs(fPeak - 1) <= 1 / 256.f);
+		}
+	}
+
+	//	Spot checks against closed forms
+	{
+		const FixedArray<f32, N>& c = cache::Get(kWindowKaiser, N, 6.0).m_C;
+		FFTL_ASSERT_ALWAYS(Abs(c[0] - static_cast<f32>(1 / BesselI0(6.0))) <= 1 / 65536.f);
+
+		const FixedArray<f32, N>& g = cache::Get(kWindowGaussian, N - 1, 0.5).m_C;
+		FFTL_ASSERT_ALWAYS(Abs(g[0] - static_cast<f32>(Exp(-2.0))) <= 1 / 65536.f && g[N / 2 - 1] == 1);
+
+		const FixedArray<f32, N>& t = cache::Get(kWindowTukey, N, 0.25).m_C;
+		for (uint n = N / 8; n < N - N / 8; ++n)
+			FFTL_ASSERT_ALWAYS(t[n] == 1);
+	}
+
+	//	Identical requests share one table, and the default parameter is keyed by its actual value
+	const uint uCount = cache::GetEntryCount();
+	FFTL_ASSERT_ALWAYS(&cache::Get(kWindowHanning) == &cache::Get(kWindowHanning, N));
+	FFTL_ASSERT_ALWAYS(&cache::Get(kWindowKaiser) == &cache::Get(kWindowKaiser, N, 8.6));
+	FFTL_ASSERT_ALWAYS(&cache::Get(kWindowKaiser) != &cache::Get(kWindowKaiser, N, 6.0));
+	FFTL_ASSERT_ALWAYS(cache::GetEntryCount() == uCount);
+
+	FFTL_LOG_MSG("verifyWindows: PASS\n");
+}
+
+template <uint M, uint K>
+void verifyPrunedFFT_Size()
+{
+	using fft = FFT_Pruned<M, K>;
+	constexpr uint N = fft::N;
+	constexpr uint L = fft::L;
+
+	auto fInR = MakeTestArray<f32, N>();
+	auto fInI = MakeTestArray<f32, N>();
+	auto fRefR = MakeTestArray<f32, N>();
+	auto fRefI = MakeTestArray<f32, N>();
+	auto fOutR = MakeTestArray<f32, N>();
+	auto fOutI = MakeTestArray<f32, N>();
+	FixedArray_Aligned32<f32, L> fWorkR, fWorkI, fBandR, fBandI;
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	//	Input pruning against the full transform of the zero padded input
+	MemZero(*fInR);
+	MemZero(*fInI);
+	FillRandom(fInR->data(), L);
+	FillRandom(fInI->data(), L);
+	FFT<M, f32>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+
+	fft::TransformForward_PrunedInput(*reinterpret_cast<const FixedArray<f32, L>*>(fInR.get()), *reinterpret_cast<const FixedArray<f32, L>*>(fInI.get()), *fOutR, *fOutI, fWorkR, fWorkI);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[k] - (*fRefR)[k]) <= fTol && Abs((*fOutI)[k] - (*fRefI)[k]) <= fTol);
+
+	MemZero(*fInI);
+	FFT<M, f32>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+	fft::TransformForward_PrunedInput(*reinterpret_cast<const FixedArray<f32, L>*>(fInR.get()), *fOutR, *fOutI, fWorkR, fWorkI);
+	for (uint k = 0; k < N; ++k)
+		FFTL_ASSERT_ALWAYS(Abs((*fOutR)[k] - (*fRefR)[k]) <= fTol && Abs((*fOutI)[k] - (*fRefI)[k]) <= fTol);
+
+	//	Output pruning on a full length input, for bands that do and don't wrap around a multiple of L
+	FillRandom(*fInR);
+	FillRandom(*fInI);
+	FFT<M, f32>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+
+	const uint bands[][2] = { { 0, L }, { 3, 3 + L / 3 }, { L - 5, 2 * L - 5 }, { N - L / 2, N } };
+	for (const auto& band : bands)
+	{
+		fft::TransformForward_PrunedOutput(*fInR, *fInI, fBandR, fBandI, band[0], band[1], fWorkR, fWorkI);
+		for (uint k = band[0]; k < band[1]; ++k)
+			FFTL_ASSERT_ALWAYS(Abs(fBandR[k - band[0]] - (*fRefR)[k]) <= fTol && Abs(fBandI[k - band[0]] - (*fRefI)[k]) <= fTol);
+	}
+}
+
+void verifyPrunedFFT()
+{
+	verifyPrunedFFT_Size<6, 1>();
+	verifyPrunedFFT_Size<8, 3>();
+	verifyPrunedFFT_Size<11, 3>();
+	verifyPrunedFFT_Size<12, 6>();
+
+	FFTL_LOG_MSG("verifyPrunedFFT: PASS\n");
+}
+
+void verifySparseDFT()
+{
+	constexpr uint M = 10;
+	constexpr uint N = 1 << M;
+	constexpr uint K = 11; // Not a multiple of the lane count
+	constexpr uint SIGNAL_LENGTH = 5 * N + 123;
+
+	FixedArray<uint, K> uBins;
+	FixedArray<f64, K> fAngles;
+	for (uint k = 0; k < K; ++k)
+	{
+		uBins[k] = k == 0 ? 0 : 1 + (k * 97) % (N / 2 - 1);
+		fAngles[k] = 2 * PI_64 * uBins[k] / N;
+	}
+
+	auto fSignal = MakeTestArray<f32, SIGNAL_LENGTH>();
+	for (uint n = 0; n < SIGNAL_LENGTH; ++n)
+		(*fSignal)[n] = GetRandomSample() + 0.5f * Sin(0.3f * n);
+
+	FixedArray_Aligned32<f32, N / 2> fRefR, fRefI;
+	FixedArray<f32, K> fOutR, fOutI, fPower;
+
+	constexpr f32 fTol = GetTransformTolerance(N);
+
+	auto CheckAgainstRealFFT = [&](uint uEnd)
+	{
+		FFT_Real<M, f32>::TransformForward(*reinterpret_cast<const FixedArray<f32, N>*>(fSignal->data() + uEnd - N), fRefR, fRefI);
+		for (uint k = 0; k < K; ++k)
+		{
+			const uint b = uBins[k];
+			const f32 fR = fRefR[b];
+			const f32 fI = b == 0 ? 0.f : fRefI[b]; // Imaginary DC holds the Nyquist bin
+			FFTL_ASSERT_ALWAYS(Abs(fOutR[k] - fR) <= fTol && Abs(fOutI[k] - fI) <= fTol);
+		}
+	};
+
+	//	Goertzel over one block, against the full transform, in uneven pieces
+	FFT_GoertzelBank<K> goertzel;
+	goertzel.Init(fAngles);
+	goertzel.Process(fSignal->data() + 7, 100);
+	goertzel.Process(fSignal->data() + 107, N - 100);
+	FFTL_ASSERT_ALWAYS(goertzel.GetSampleCount() == N);
+	goertzel.GetResult(fOutR, fOutI);
+	CheckAgainstRealFFT(N + 7);
+	goertzel.GetPower(fPower);
+	for (uint k = 0; k < K; ++k)
+		FFTL_ASSERT_ALWAYS(Abs(fPower[k] - (fOutR[k] * fOutR[k] + fOutI[k] * fOutI[k])) <= fTol * N);
+
+	//	So few bins that every SIMD width splits the block into runs, with a piece too short to split, at DC and Nyquist
+	{
+		constexpr uint K_FEW = 3;
+		const uint uFewBins[K_FEW] = { 0, 5, N / 2 };
+		FixedArray<f64, K_FEW> fFewAngles;
+		for (uint k = 0; k < K_FEW; ++k)
+			fFewAngles[k] = 2 * PI_64 * uFewBins[k] / N;
+
+		FFT_GoertzelBank<K_FEW> goertzelFew;
+		goertzelFew.Init(fFewAngles);
+		goertzelFew.Process(fSignal->data(), 601);
+		goertzelFew.Process(fSignal->data() + 601, 20);
+		goertzelFew.Process(fSignal->data() + 621, N - 621);
+		FixedArray<f32, K_FEW> fFewR, fFewI;
+		goertzelFew.GetResult(fFewR, fFewI);
+
+		FFT_Real<M, f32>::TransformForward(*reinterpret_cast<const FixedArray<f32, N>*>(fSignal->data()), fRefR, fRefI);
+		FFTL_ASSERT_ALWAYS(Abs(fFewR[0] - fRefR[0]) <= fTol && Abs(fFewI[0]) <= fTol);
+		FFTL_ASSERT_ALWAYS(Abs(fFewR[1] - fRefR[5]) <= fTol && Abs(fFewI[1] - fRefI[5]) <= fTol);
+		FFTL_ASSERT_ALWAYS(Abs(fFewR[2] - fRefI[0]) <= fTol && Abs(fFewI[2]) <= fTol);
+	}
+
+	//	Sliding DFT after every hop, including before the first full window and across many period swaps
+	auto pSliding = std::make_unique< FFT_SlidingDFT<M, K> >();
+	pSliding->Init(uBins);
+	uint uPos = 0;
+	for (uint uHop : { 1u, 37u, N - 38, 1u, 200u, 2 * N + 5, N - 1, 300u })
+	{
+		pSliding->Process(fSignal->data() + uPos, uHop);
+		uPos += uHop;
+		if (uPos >= N)
+		{
+			pSliding->GetResult(fOutR, fOutI);
+			CheckAgainstRealFFT(uPos);
+		}
+	}
+
+	FFTL_LOG_MSG("verifySparseDFT: PASS\n");
+}
+
+struct LazyTableCounter
+{
+	LazyTableCounter() { ++s_uConstructCount; }
+	static inline std::atomic<uint> s_uConstructCount{ 0 };
+	uint m_uValue = 1234;
+};
+
+void verifyLazyTables()
+{
+	//	The recurrence has to stay within a few ulps of the exact values all the way through a large table
+	{
+		constexpr uint N = 1 << 16;
+		const f64 fStep = PI_64 / N;
+		auto fCos = std::make_unique< FixedArray<f64, N + 3> >();
+		auto fSin = std::make_unique< FixedArray<f64, N + 3> >();
+		FFT_ComputeCosSin(fCos->data(), fSin->data(), N + 3, fStep, 1.0, -1.0);
+		for (uint n = 0; n < N + 3; ++n)
+		{
+			FFTL_ASSERT_ALWAYS(Abs((*fCos)[n] - std::cos(fStep * n)) <= 1e-14);
+			FFTL_ASSERT_ALWAYS(Abs((*fSin)[n] + std::sin(fStep * n)) <= 1e-14);
+		}
+	}
+
+	//	Every thread racing through the first use gets the same single instance
+	{
+		ThreadPool pool(4);
+		const LazyTableCounter* pTables[4] = {};
+		pool.ParallelForThreads(4, [&](uint uThread, uint, uint)
+		{
+			pTables[uThread] = &FFT_LazyTable<LazyTableCounter>::Get();
+		});
+		for (uint i = 0; i < pool.GetThreadCount(); ++i)
+			FFTL_ASSERT_ALWAYS(pTables[i] == pTables[0] && pTables[i]->m_uValue == 1234);
+		FFTL_ASSERT_ALWAYS(&FFT_LazyTable<LazyTableCounter>::Get() == pTables[0]);
+		FFTL_ASSERT_ALWAYS(LazyTableCounter::s_uConstructCount == 1);
+	}
+
+	//	Sizes past the constexpr cutoffs, built on first use, against the scalar reference transform
+	{
+		constexpr uint M = FFT_MAX_TWIDDLES_CONSTEXPR + 2;
+		constexpr uint N = 1 << M;
+		static_assert(M > FFT_MAX_BITREVERSE_CONSTEXPR);
+
+		auto fInR = MakeTestArray<f32, N>();
+		auto fInI = MakeTestArray<f32, N>();
+		auto fOutR = MakeTestArray<f32, N>();
+		auto fOutI = MakeTestArray<f32, N>();
+		auto kissIn = std::make_unique< FixedArray<kiss_fft_cpx, N> >();
+		auto kissOut = std::make_unique< FixedArray<kiss_fft_cpx, N> >();
+
+		for (uint n = 0; n < N; ++n)
+		{
+			(*fInR)[n] = (*kissIn)[n].r = GetRandomSample();
+			(*fInI)[n] = (*kissIn)[n].i = GetRandomSample();
+		}
+
+		kiss_fft_cfg cfg = kiss_fft_alloc(N, false, 0, 0);
+		kiss_fft(cfg, kissIn->data(), kissOut->data());
+		kiss_fft_free(cfg);
+
+		FFT<M, f32>::TransformForward(*fInR, *fInI, *fOutR, *fOutI);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*kissOut)[n].r) <= 1 / 16.f && Abs((*fOutI)[n] - (*kissOut)[n].i) <= 1 / 16.f);
+	}
+
+	//	Same for a mixed radix size past the constexpr cutoff
+	{
+		constexpr uint N = 3 << FFT_MAX_TWIDDLES_CONSTEXPR;
+
+		auto fInR = MakeTestArray<f32, N>();
+		auto fInI = MakeTestArray<f32, N>();
+		auto fOutR = MakeTestArray<f32, N>();
+		auto fOutI = MakeTestArray<f32, N>();
+		auto kissIn = std::make_unique< FixedArray<kiss_fft_cpx, N> >();
+		auto kissOut = std::make_unique< FixedArray<kiss_fft_cpx, N> >();
+
+		for (uint n = 0; n < N; ++n)
+		{
+			(*fInR)[n] = (*kissIn)[n].r = GetRandomSample();
+			(*fInI)[n] = (*kissIn)[n].i = GetRandomSample();
+		}
+
+		kiss_fft_cfg cfg = kiss_fft_alloc(N, false, 0, 0);
+		kiss_fft(cfg, kissIn->data(), kissOut->data());
+		kiss_fft_free(cfg);
+
+		FFT_MixedRadix<N>::TransformForward(*fInR, *fInI, *fOutR, *fOutI);
+		for (uint n = 0; n < N; ++n)
+			FFTL_ASSERT_ALWAYS(Abs((*fOutR)[n] - (*kissOut)[n].r) <= 1 / 16.f && Abs((*fOutI)[n] - (*kissOut)[n].i) <= 1 / 16.f);
+	}
+
+	FFTL_LOG_MSG("verifyLazyTables: PASS\n");
+}
+
+template <uint M, typename T>
+void verifyFixedFFT_Size(T nAmplitude, f64 fMinSnrDb)
+{
+	constexpr uint N = 1 << M;
+
+	auto nInR = std::make_unique< FixedArray<T, N> >();
+	auto nInI = std::make_unique< FixedArray<T, N> >();
+	auto nOutR = std::make_unique< FixedArray<T, N> >();
+	auto nOutI = std::make_unique< FixedArray<T, N> >();
+	auto nBackR = std::make_unique< FixedArray<T, N> >();
+	auto nBackI = std::make_unique< FixedArray<T, N> >();
+	auto fInR = MakeTestArray<f64, N>();
+	auto fInI = MakeTestArray<f64, N>();
+	auto fRefR = MakeTestArray<f64, N>();
+	auto fRefI = MakeTestArray<f64, N>();
+
+	for (uint n = 0; n < N; ++n)
+	{
+		(*nInR)[n] = static_cast<T>(nAmplitude * f64(GetRandomSample()));
+		(*nInI)[n] = static_cast<T>(nAmplitude * f64(GetRandomSample()));
+		(*fInR)[n] = (*nInR)[n];
+		(*fInI)[n] = (*nInI)[n];
+	}
+	FFT<M, f64>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+
+	//	Signal to noise ratio of the scaled output against the double precision transform
+	auto GetSnrDb = [](const T* pR, const T* pI, int nExponent, const f64* pRefR, const f64* pRefI, uint uCount, f64 fRefScale)
+	{
+		f64 fSignal = 0, fNoise = 0;
+		for (uint n = 0; n < uCount; ++n)
+		{
+			const f64 fRefR = pRefR[n] * fRefScale;
+			const f64 fRefI = pRefI[n] * fRefScale;
+			const f64 fErrR = std::ldexp(static_cast<f64>(pR[n]), nExponent) - fRefR;
+			const f64 fErrI = std::ldexp(static_cast<f64>(pI[n]), nExponent) - fRefI;
+			fSignal += fRefR * fRefR + fRefI * fRefI;
+			fNoise += fErrR * fErrR + fErrI * fErrI;
+		}
+		return 10 * std::log10(fSignal / fNoise);
+	};
+
+	const int nExponent = FFT_Fixed<M, T>::TransformForward(*nInR, *nInI, *nOutR, *nOutI);
+	FFTL_ASSERT_ALWAYS(nExponent >= 0 && nExponent <= int(2 * M));
+	FFTL_ASSERT_ALWAYS(GetSnrDb(nOutR->data(), nOutI->data(), nExponent, fRefR->data(), fRefI->data(), N, 1) >= fMinSnrDb);
+
+	//	The round trip gives N times the input
+	const int nExponentBack = nExponent + FFT_Fixed<M, T>::TransformInverse(*nOutR, *nOutI, *nBackR, *nBackI);
+	FFTL_ASSERT_ALWAYS(GetSnrDb(nBackR->data(), nBackI->data(), nExponentBack, fInR->data(), fInI->data(), N, N) >= fMinSnrDb - 6);
+
+	//	Real input, against the complex transform of the same samples with a zero imaginary part
+	if constexpr (M >= 3)
+	{
+		FixedArray<T, N / 2> nRealOutR, nRealOutI;
+		MemZero(*fInI);
+		FFT<M, f64>::TransformForward(*fInR, *fInI, *fRefR, *fRefI);
+		const int nExponentReal = FFT_Real_Fixed<M, T>::TransformForward(*nInR, nRealOutR, nRealOutI);
+
+		const f64 fNyquist = std::ldexp(static_cast<f64>(nRealOutI[0]), nExponentReal);
+		FFTL_ASSERT_ALWAYS(Abs(fNyquist - (*fRefR)[N / 2]) <= std::ldexp(1.0, nExponentReal) * M);
+		nRealOutI[0] = 0;
+		FFTL_ASSERT_ALWAYS(GetSnrDb(nRealOutR.data(), nRealOutI.data(), nExponentReal, fRefR->data(), fRefI->data(), N / 2, 1) >= fMinSnrDb - 3);
+	}
+}
+
+void verifyFixedFFT()
+{
+	verifyFixedFFT_Size<2, s16>(32767, 65);
+	verifyFixedFFT_Size<3, s16>(32767, 68);
+	verifyFixedFFT_Size<6, s16>(32767, 60);
+	verifyFixedFFT_Size<10, s16>(32767, 55);
+	verifyFixedFFT_Size<10, s16>(100, 45); // Quiet enough that the early stages don't scale
+	verifyFixedFFT_Size<13, s16>(32767, 52);
+
+	verifyFixedFFT_Size<2, s32>(2147483647, 160);
+	verifyFixedFFT_Size<6, s32>(2147483647, 155);
+	verifyFixedFFT_Size<10, s32>(2147483647, 150);
+	verifyFixedFFT_Size<13, s32>(2147483647, 148);
+
+	FFTL_LOG_MSG("verifyFixedFFT: PASS\n");
+}
+
+void verifyHalfPrecision()
+{
+	//	Every half widens the same way scalar and vectorized, and everything but NaNs survives the trip back
+	for (u32 u = 0; u < 65536; u += 8)
+	{
+		FixedArray<f16, 8> hIn, hBack8, hBack4;
+		FixedArray<f32, 8> fOut8, fOut4;
+		for (uint i = 0; i < 8; ++i)
+			hIn[i] = static_cast<f16>(u + i);
+
+		f32x8::LoadF16(hIn.data()).StoreU(fOut8.data());
+		f32x4::LoadF16(hIn.data() + 0).StoreU(fOut4.data() + 0);
+		f32x4::LoadF16(hIn.data() + 4).StoreU(fOut4.data() + 4);
+		f32x8::LoadU(fOut8.data()).StoreF16(hBack8.data());
+		f32x4::LoadU(fOut4.data() + 0).StoreF16(hBack4.data() + 0);
+		f32x4::LoadU(fOut4.data() + 4).StoreF16(hBack4.data() + 4);
+
+		for (uint i = 0; i < 8; ++i)
+		{
+			const u32 uRef = bit_cast<u32>(F16ToF32(hIn[i]));
+			FFTL_ASSERT_ALWAYS(bit_cast<u32>(fOut8[i]) == uRef && bit_cast<u32>(fOut4[i]) == uRef);
+			if (!std::isnan(fOut8[i]))
+				FFTL_ASSERT_ALWAYS(hBack8[i] == hIn[i] && hBack4[i] == hIn[i] && F32ToF16(fOut8[i]) == hIn[i]);
+		}
+	}
+
+	//	Rounding agrees between the scalar and vector paths, and is within half an ulp, from subnormal halfs through overflow
+	for (uint k = 0; k < 20000; ++k)
+	{
+		FixedArray<f32, 8> fIn;
+		FixedArray<f16, 8> hOut8, hOut4;
+		for (uint i = 0; i < 8; ++i)
+		{
+			const u32 uExp = 97 + rand() % 48;
+			const u32 uMant = ((u32(rand()) << 15) ^ u32(rand())) & 0x7fffff;
+			fIn[i] = bit_cast<f32>(((rand() & 1) ? 0x80000000 : 0) | (uExp << 23) | uMant);
+		}
+		f32x8::LoadU(fIn.data()).StoreF16(hOut8.data());
+		f32x4::LoadU(fIn.data() + 0).StoreF16(hOut4.data() + 0);
+		f32x4::LoadU(fIn.data() + 4).StoreF16(hOut4.data() + 4);
+
+		for (uint i = 0; i < 8; ++i)
+		{
+			FFTL_ASSERT_ALWAYS(hOut8[i] == F32ToF16(fIn[i]) && hOut4[i] == hOut8[i]);
+			const f32 fBack = F16ToF32(hOut8[i]);
+			if (Abs(fIn[i]) < 65520.f)
+				FFTL_ASSERT_ALWAYS(Abs(fBack - fIn[i]) <= Max(Abs(fIn[i]) * (1.f / 2048), 1.f / (1 << 25)));
+			else
+				FFTL_ASSERT_ALWAYS(std::isinf(fBack) && (fBack < 0) == (fIn[i] < 0));
+		}
+	}
+
+	//	Half precision spectra, against the full precision transform
+	{
+		constexpr uint M = 10;
+		constexpr uint N = 1 << M;
+		FixedArray_Aligned32<f32, N> fTimeIn, fTimeOut;
+		FixedArray_Aligned32<f32, N / 2> fFreqR, fFreqI;
+		FixedArray<f16, N / 2> hFreqR, hFreqI;
+		FillRandom(fTimeIn);
+
+		FFT_Real<M, f32>::TransformForward(fTimeIn, fFreqR, fFreqI);
+		FFT_Real<M, f32>::TransformForward(fTimeIn, hFreqR, hFreqI);
+		for (uint n = 0; n < N / 2; ++n)
+		{
+			FFTL_ASSERT_ALWAYS(hFreqR[n] == F32ToF16(fFreqR[n]));
+			FFTL_ASSERT_ALWAYS(hFreqI[n] == F32ToF16(fFreqI[n]));
+		}
+
+		FixedArray_Aligned32<f32, N / 2> fTimeHalf;
+		MemCopy(fTimeHalf.data(), fTimeIn.data(), N / 2);
+		FFT_Real<M, f32>::TransformForward_1stHalf(fTimeHalf, hFreqR, hFreqI);
+		MemZero(fTimeIn.data() + N / 2, N / 2);
+		FFT_Real<M, f32>::TransformForward(fTimeIn, fFreqR, fFreqI);
+		for (uint n = 0; n < N / 2; ++n)
+		{
+			FFTL_ASSERT_ALWAYS(Abs(F16ToF32(hFreqR[n]) - fFreqR[n]) <= Abs(fFreqR[n]) * (1.f / 2048) + 1e-3f);
+			FFTL_ASSERT_ALWAYS(Abs(F16ToF32(hFreqI[n]) - fFreqI[n]) <= Abs(fFreqI[n]) * (1.f / 2048) + 1e-3f);
+		}
+
+		FFT_Real<M, f32>::TransformInverse(hFreqR, hFreqI, fTimeOut);
+		f64 fSignal = 0, fNoise = 0;
+		for (uint n = 0; n < N; ++n)
+		{
+			fSignal += f64(fTimeIn[n]) * fTimeIn[n];
+			fNoise += f64(fTimeOut[n] - fTimeIn[n]) * (fTimeOut[n] - fTimeIn[n]);
+		}
+		FFTL_ASSERT_ALWAYS(10 * std::log10(fSignal / fNoise) >= 60);
+	}
+
+	//	Convolution with half precision kernels, against the same kernels in full precision
+	{
+		constexpr uint M = 8;
+		constexpr uint N = 1 << M;
+		constexpr uint uKernelCount = 6;
+		using ConvolverType = Convolver<M, uKernelCount, f32>;
+		static_assert(sizeof(ConvolverType::KernelF16) * 2 == sizeof(ConvolverType::Kernel));
+
+		auto pConvolver = std::make_unique<ConvolverType>();
+		auto pConvolverF16 = std::make_unique<ConvolverType>();
+		auto pKernels = std::make_unique< FixedArray<ConvolverType::Kernel, uKernelCount> >();
+		auto pKernelsF16 = std::make_unique< FixedArray<ConvolverType::KernelF16, uKernelCount> >();
+
+		//	A decaying noise tail, like a reverb response, that ends partway through the last partition
+		FixedArray<f32, N * uKernelCount> fImpulse;
+		const uint uImpulseLength = N * uKernelCount - N / 3;
+		for (uint n = 0; n < uImpulseLength; ++n)
+			fImpulse[n] = GetRandomSample() * std::exp(-4.f * n / uImpulseLength);
+
+		FFTL_ASSERT_ALWAYS(ConvolverType::InitKernel(pKernels->data(), fImpulse.data(), uImpulseLength) == uKernelCount);
+		FFTL_ASSERT_ALWAYS(ConvolverType::InitKernel(pKernelsF16->data(), fImpulse.data(), uImpulseLength) == uKernelCount);
+
+		f64 fSignal = 0, fNoise = 0;
+		FixedArray_Aligned32<f32, N> fIn, fOut, fOutF16;
+		for (uint uBlock = 0; uBlock < 2 * uKernelCount; ++uBlock)
+		{
+			FillRandom(fIn);
+
+			//	Alternate between the single and mixed kernel paths
+			if (uBlock & 1)
+			{
+				pConvolver->Convolve(fOut, fIn, pKernels->data(), uKernelCount, 0.75f, pKernels->data(), uKernelCount - 2, 0.5f);
+				pConvolverF16->Convolve(fOutF16, fIn, pKernelsF16->data(), uKernelCount, 0.75f, pKernelsF16->data(), uKernelCount - 2, 0.5f);
+			}
+			else
+			{
+				pConvolver->Convolve(fOut, fIn, pKernels->data(), uKernelCount);
+				pConvolverF16->Convolve(fOutF16, fIn, pKernelsF16->data(), uKernelCount);
+			}
+
+			for (uint n = 0; n < N; ++n)
+			{
+				fSignal += f64(fOut[n]) * fOut[n];
+				fNoise += f64(fOutF16[n] - fOut[n]) * (fOutF16[n] - fOut[n]);
+			}
+		}
+		FFTL_ASSERT_ALWAYS(10 * std::log10(fSignal / fNoise) >= 55);
+	}
+
+	FFTL_LOG_MSG("verifyHalfPrecision: PASS\n");
+}
+
+void verifyNonUniformConvolution()
+{
+	//	Blocks of 16, head partitions of 16, 32 and 64, and up to 3 tail partitions of 128
+	using ConvolverType = Convolver_NonUniform<4, 7, 3>;
+	constexpr uint N = ConvolverType::N;
+	constexpr uint L = static_cast<uint>(ConvolverType::MAX_KERNEL_LENGTH);
+	static_assert(L == 2 * (16 + 32 + 64) + 3 * 128);
+
+	//	The full length, one that ends early in stage 1, and one that ends partway through the tail
+	for (const uint uImpulseLength : { L, 40u, 300u })
+	{
+		auto pConvolver = std::make_unique<ConvolverType>();
+		auto pKernels = std::make_unique<ConvolverType::Kernels>();
+		auto pReference = std::make_unique< Convolver_Slow<f32, N, L> >();
+
+		FixedArray<f32, L> fImpulse;
+		MemZero(fImpulse);
+		for (uint n = 0; n < uImpulseLength; ++n)
+			fImpulse[n] = GetRandomSample() * std::exp(-3.f * n / uImpulseLength);
+
+		ConvolverType::InitKernel(*pKernels, fImpulse.data(), uImpulseLength);
+		pReference->SetKernel(fImpulse);
+		FFTL_ASSERT_ALWAYS(pKernels->m_Counts[0] == 2);
+		FFTL_ASSERT_ALWAYS(pKernels->m_Counts[3] == (uImpulseLength == L ? 3 : uImpulseLength == 300 ? 1 : 0));
+
+		//	An impulse first, so the response comes out with only a block of latency, then noise, then silence to flush the tail
+		FixedArray_Aligned32<f32, N> fIn, fOut, fRefOut;
+		for (uint uBlock = 0; uBlock < 4 * L / N; ++uBlock)
+		{
+			MemZero(fIn);
+			if (uBlock == 0)
+				fIn[0] = 1;
+			else if (uBlock < 2 * L / N)
+				FillRandom(fIn);
+
+			pReference->Convolve(fRefOut, fIn);
+			pConvolver->Convolve(fOut, fIn, *pKernels);
+
+			for (uint n = 0; n < N; ++n)
+				FFTL_ASSERT_ALWAYS(Abs(fOut[n] - fRefOut[n]) <= 1e-4f * (1 + Abs(fRefOut[n])));
+		}
+	}
+
+	FFTL_LOG_MSG("verifyNonUniformConvolution: PASS\n");
+}
+
 #if 1
 void verifyConvolution()
 {
@@ -795,6 +2356,50 @@ void perfTest()
 #endif
 	}
 
+	//	Tracking a handful of bins and a few dozen: Goertzel over a block, and a sliding DFT updated every sample, against one
+	// real FFT of the block.
+	auto PerfTestSparseDFT = [&](auto K_CONSTANT)
+	{
+		constexpr uint K = decltype(K_CONSTANT)::value;
+		FixedArray<f64, K> fAngles;
+		FixedArray<uint, K> uBins;
+		for (uint k = 0; k < K; ++k)
+		{
+			uBins[k] = 1 + k * 7;
+			fAngles[k] = 2 * PI_64 * uBins[k] / _N;
+		}
+		FixedArray<f32, K> fOutR, fOutI;
+
+		FFT_GoertzelBank<K> goertzel;
+		goertzel.Init(fAngles);
+
+		timer.Reset();
+		timer.Start();
+		for (int i = 0; i < loopCount; ++i)
+		{
+			goertzel.Reset();
+			goertzel.Process(fInput1.data(), _N);
+			goertzel.GetResult(fOutR, fOutI);
+		}
+		timer.PauseAccum();
+		FFTL_LOG_MSG("Goertzel bank %u bins, block size %u: %f us\n", K, _N, timer.GetMicroseconds() / loopCount);
+
+		auto pSliding = std::make_unique< FFT_SlidingDFT<_M, K> >();
+		pSliding->Init(uBins);
+
+		timer.Reset();
+		timer.Start();
+		for (int i = 0; i < loopCount; ++i)
+		{
+			pSliding->Process(fInput1.data(), _N);
+			pSliding->GetResult(fOutR, fOutI);
+		}
+		timer.PauseAccum();
+		FFTL_LOG_MSG("Sliding DFT %u bins, %u samples: %f us\n", K, _N, timer.GetMicroseconds() / loopCount);
+	};
+	PerfTestSparseDFT(std::integral_constant<uint, 8>());
+	PerfTestSparseDFT(std::integral_constant<uint, 32>());
+
 //	_getch();
 }
 
@@ -1112,6 +2717,27 @@ int RunTests()
 //	FFTL::convolutionTest();
 	FFTL::verifyFFT();
 	FFTL::verifyRealFFT();
+	FFTL::verifyFFTPlan();
+	FFTL::verifyMixedRadixFFT();
+	FFTL::verifyChirpZ();
+	FFTL::verifyFFT64();
+	FFTL::verifyFFTInterleaved();
+	FFTL::verifyStockham();
+	FFTL::verifyBlockedBitreversal();
+	FFTL::verifyFourStep();
+	FFTL::verifyFFTBatch();
+	FFTL::verifyFFT2D();
+	FFTL::verifyFFT3D();
+	FFTL::verifyDCT();
+	FFTL::verifyRealPair();
+	FFTL::verifyRealFFTWindowed();
+	FFTL::verifyWindows();
+	FFTL::verifyPrunedFFT();
+	FFTL::verifySparseDFT();
+	FFTL::verifyLazyTables();
+	FFTL::verifyFixedFFT();
+	FFTL::verifyHalfPrecision();
+	FFTL::verifyNonUniformConvolution();
 //	FFTL::perfTest();
 //	FFTL::LinkedListThreadSafetyTest();
 	FFTL::MemPoolThreadSafetyTest();
@@ -38,6 +38,27 @@ namespace FFTL
 void convolutionTest();
 void verifyFFT();
 void verifyRealFFT();
+void verifyFFTPlan();
+void verifyMixedRadixFFT();
+void verifyChirpZ();
+void verifyFFT64();
+void verifyFFTInterleaved();
+void verifyStockham();
+void verifyBlockedBitreversal();
+void verifyFourStep();
+void verifyFFTBatch();
+void verifyFFT2D();
+void verifyFFT3D();
+void verifyDCT();
+void verifyRealPair();
+void verifyRealFFTWindowed();
+void verifyWindows();
+void verifyPrunedFFT();
+void verifySparseDFT();
+void verifyLazyTables();
+void verifyFixedFFT();
+void verifyHalfPrecision();
+void verifyNonUniformConvolution();
 void verifyConvolution();
 void perfTest();
 int RunTests();